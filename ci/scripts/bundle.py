@@ -134,6 +134,7 @@ def bundle_nanoarrow(
             src_dir / "hpp" / "unique.hpp",
             src_dir / "hpp" / "array_stream.hpp",
             src_dir / "hpp" / "buffer.hpp",
+            src_dir / "hpp" / "builder.hpp",
             src_dir / "hpp" / "view.hpp",
         ]
     )
@@ -142,15 +143,26 @@ def bundle_nanoarrow(
     nanoarrow_hpp = namespace_nanoarrow_includes(nanoarrow_hpp, header_namespace)
     yield f"{output_include_dir}/nanoarrow.hpp", nanoarrow_hpp
 
+    # nanoarrow/nanoarrow_threads.hpp is opt-in and is not part of nanoarrow.hpp
+    nanoarrow_threads_hpp = read_content(src_dir / "nanoarrow_threads.hpp")
+    nanoarrow_threads_hpp = namespace_nanoarrow_includes(
+        nanoarrow_threads_hpp, header_namespace
+    )
+    yield f"{output_include_dir}/nanoarrow_threads.hpp", nanoarrow_threads_hpp
+
     # Generate nanoarrow/nanoarrow.c
     nanoarrow_c = concatenate_content(
         [
+            src_dir / "common" / "atomic_internal.h",
             src_dir / "common" / "utils.c",
             src_dir / "common" / "schema.c",
             src_dir / "common" / "array.c",
             src_dir / "common" / "array_stream.c",
         ]
     )
+    nanoarrow_c = nanoarrow_c.replace(
+        '#include "nanoarrow/common/atomic_internal.h"', ""
+    )
     nanoarrow_c = namespace_nanoarrow_includes(nanoarrow_c, header_namespace)
 
     if cpp:
@@ -209,6 +221,7 @@ def bundle_nanoarrow_ipc(
     nanoarrow_ipc_c = concatenate_content(
         [
             src_dir / "ipc" / "flatcc_generated.h",
+            src_dir / "common" / "atomic_internal.h",
             src_dir / "ipc" / "codecs.c",
             src_dir / "ipc" / "decoder.c",
             src_dir / "ipc" / "encoder.c",
@@ -219,6 +232,9 @@ def bundle_nanoarrow_ipc(
     nanoarrow_ipc_c = nanoarrow_ipc_c.replace(
         '#include "nanoarrow/ipc/flatcc_generated.h"', ""
     )
+    nanoarrow_ipc_c = nanoarrow_ipc_c.replace(
+        '#include "nanoarrow/common/atomic_internal.h"', ""
+    )
     nanoarrow_ipc_c = namespace_nanoarrow_includes(nanoarrow_ipc_c, header_namespace)
     yield f"{output_source_dir}/nanoarrow_ipc.c", nanoarrow_ipc_c
 
@@ -0,0 +1,433 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+"""
+Record and compare C benchmark results across nanoarrow checkouts
+
+The run subcommand builds the C benchmarks in this directory against a local
+nanoarrow checkout and stores the Google Benchmark JSON output under
+results/<commit>/. Benchmarks of features that the checkout lacks are not built
+(see NANOARROW_BENCHMARK_HAS_<FEATURE> in CMakeLists.txt). The compare
+subcommand compares the benchmarks two sets of results have in common using a
+Mann-Whitney U test across repetitions and exits with a non-zero status if any
+benchmark regressed.
+Only the Python standard library is used and nothing is downloaded if Google
+Benchmark is installed.
+
+Use `python benchmark_compare.py --help` for usage
+"""
+
+import argparse
+import functools
+import glob
+import json
+import math
+import os
+import re
+import statistics
+import subprocess
+import sys
+
+BENCHMARKS_DIR = os.path.dirname(os.path.abspath(__file__))
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+# Below this many repetitions per side a two-sided test at alpha = 0.05 cannot
+# reject the null hypothesis no matter how different the values are
+MIN_REPETITIONS = 4
+
+
+def git(*args, cwd=None):
+    out = subprocess.run(["git"] + list(args), cwd=cwd, stdout=subprocess.PIPE)
+    return out.stdout.decode().strip()
+
+
+def checkout_id(checkout):
+    """The commit of a checkout with a -dirty suffix if it has local changes"""
+    commit = git("rev-parse", "HEAD", cwd=checkout)
+    if not commit:
+        raise ValueError(f"'{checkout}' is not a git checkout")
+
+    if git("status", "--porcelain", "--untracked-files=no", cwd=checkout):
+        commit += "-dirty"
+    return commit
+
+
+def load_results(paths, metric="real_time"):
+    """Collects repetitions of each benchmark from Google Benchmark JSON output
+
+    paths may contain JSON files or directories, which are searched recursively.
+    Returns a dict of benchmark name to a list of times in nanoseconds.
+    Aggregate rows (mean, median, ...) and benchmarks that reported an error or
+    were skipped are ignored.
+    """
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            pattern = os.path.join(path, "**", "*.json")
+            files.extend(sorted(glob.glob(pattern, recursive=True)))
+        else:
+            files.append(path)
+
+    results = {}
+    for file in files:
+        # Google Benchmark writes an empty file if --benchmark_filter matched nothing
+        if os.path.getsize(file) == 0:
+            continue
+
+        with open(file) as f:
+            content = json.load(f)
+
+        for item in content.get("benchmarks", []):
+            if item.get("run_type", "iteration") != "iteration":
+                continue
+            if item.get("error_occurred", False) or item.get("skipped", False):
+                continue
+
+            name = item.get("run_name", item["name"])
+            unit = TIME_UNIT_NS[item.get("time_unit", "ns")]
+            results.setdefault(name, []).append(item[metric] * unit)
+
+    return results
+
+
+def mann_whitney_u(x, y):
+    """Two-sided Mann-Whitney U test
+
+    Returns the U statistic for x and the p-value. The p-value is exact when
+    there are no ties and both samples are small; otherwise the tie-corrected
+    normal approximation is used.
+    """
+    n, m = len(x), len(y)
+    if n == 0 or m == 0:
+        raise ValueError("Can't compute Mann-Whitney U for an empty sample")
+
+    # Assign average ranks to tied values
+    combined = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+    ranks = [0.0] * len(combined)
+    tie_sizes = []
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        tie_sizes.append(j - i + 1)
+        i = j + 1
+
+    rank_sum_x = sum(r for r, (_, group) in zip(ranks, combined) if group == 0)
+    u = rank_sum_x - n * (n + 1) / 2
+    u_tail = min(u, n * m - u)
+
+    has_ties = any(size > 1 for size in tie_sizes)
+    if not has_ties and n * m <= 400:
+        # counts[u] is the number of orderings of n + m distinct values for
+        # which the U statistic of the first sample is u
+        counts = _mann_whitney_u_counts(n, m)
+        total = sum(counts)
+        p = 2 * sum(counts[: int(u_tail) + 1]) / total
+        return u, min(p, 1.0)
+
+    mean = n * m / 2
+    tie_term = sum(t**3 - t for t in tie_sizes) / ((n + m) * (n + m - 1))
+    variance = n * m / 12 * ((n + m + 1) - tie_term)
+    if variance == 0:
+        return u, 1.0
+
+    # Continuity correction
+    z = (abs(u - mean) - 0.5) / math.sqrt(variance)
+    p = math.erfc(max(z, 0) / math.sqrt(2))
+    return u, min(p, 1.0)
+
+
+@functools.lru_cache(maxsize=None)
+def _mann_whitney_u_counts(n, m):
+    # Built up one sample size at a time using
+    # f(n, m, u) = f(n - 1, m, u - m) + f(n, m - 1, u)
+    table = [[[1] for _ in range(m + 1)] for _ in range(n + 1)]
+    for i in range(1, n + 1):
+        for j in range(1, m + 1):
+            counts = [0] * (i * j + 1)
+            for u, count in enumerate(table[i - 1][j]):
+                counts[u + j] += count
+            for u, count in enumerate(table[i][j - 1]):
+                counts[u] += count
+            table[i][j] = counts
+    return table[n][m]
+
+
+def filter_results(results, pattern):
+    """Keeps the benchmarks whose name matches a compiled regex"""
+    return {name: times for name, times in results.items() if pattern.search(name)}
+
+
+def parse_thresholds(values):
+    """Parses REGEX=THRESHOLD pairs into a list of (compiled regex, float)"""
+    thresholds = []
+    for value in values:
+        pattern, sep, threshold = value.rpartition("=")
+        if not sep or not pattern:
+            raise ValueError(f"Expected REGEX=THRESHOLD but got '{value}'")
+        thresholds.append((re.compile(pattern), float(threshold)))
+    return thresholds
+
+
+def compare_results(baseline, contender, threshold=0.05, alpha=0.05, overrides=()):
+    """Compares two dicts of benchmark name to repetition times
+
+    A benchmark is a regression (or improvement) if the median time changed by
+    more than its threshold (a fraction of the baseline median) and the
+    Mann-Whitney U test p-value is below alpha. The last override whose pattern
+    matches a benchmark name replaces the default threshold.
+    """
+    rows = []
+    for name in sorted(set(baseline) & set(contender)):
+        benchmark_threshold = threshold
+        for pattern, value in overrides:
+            if pattern.search(name):
+                benchmark_threshold = value
+
+        baseline_median = statistics.median(baseline[name])
+        contender_median = statistics.median(contender[name])
+        change = contender_median / baseline_median - 1
+        _, p_value = mann_whitney_u(baseline[name], contender[name])
+
+        if p_value >= alpha or abs(change) <= benchmark_threshold:
+            status = ""
+        elif change > 0:
+            status = "REGRESSION"
+        else:
+            status = "improvement"
+
+        rows.append(
+            {
+                "name": name,
+                "baseline": baseline_median,
+                "contender": contender_median,
+                "change": change,
+                "p_value": p_value,
+                "repetitions": min(len(baseline[name]), len(contender[name])),
+                "threshold": benchmark_threshold,
+                "status": status,
+            }
+        )
+
+    return rows
+
+
+def format_time(ns):
+    for unit in ("s", "ms", "us"):
+        if ns >= TIME_UNIT_NS[unit]:
+            return f"{ns / TIME_UNIT_NS[unit]:.3f} {unit}"
+    return f"{ns:.1f} ns"
+
+
+def format_table(rows):
+    header = ["benchmark", "baseline", "contender", "change", "p-value", "reps", ""]
+    lines = [header]
+    for row in rows:
+        lines.append(
+            [
+                row["name"],
+                format_time(row["baseline"]),
+                format_time(row["contender"]),
+                f"{row['change'] * 100:+.1f}%",
+                f"{row['p_value']:.4f}",
+                str(row["repetitions"]),
+                row["status"],
+            ]
+        )
+
+    widths = [max(len(line[i]) for line in lines) for i in range(len(header))]
+    out = []
+    for line in lines:
+        cells = [line[0].ljust(widths[0])]
+        cells += [cell.rjust(width) for cell, width in zip(line[1:-1], widths[1:-1])]
+        cells.append(line[-1])
+        out.append("  ".join(cells).rstrip())
+    out.insert(1, "  ".join("-" * width for width in widths[:-1]))
+    return "\n".join(out)
+
+
+def resolve_results(value, results_dir):
+    """A JSON file, a directory, or a (possibly abbreviated) recorded commit"""
+    if os.path.exists(value):
+        return value
+
+    matches = sorted(glob.glob(os.path.join(results_dir, value + "*")))
+    if len(matches) != 1:
+        raise ValueError(
+            f"'{value}' matched {len(matches)} recorded results in '{results_dir}'"
+        )
+    return matches[0]
+
+
+def run_benchmarks(
+    checkout, build_dir, out_dir, repetitions, benchmark_filter, cmake_args
+):
+    cmake = os.environ.get("CMAKE_BIN", "cmake")
+    subprocess.run(
+        [
+            cmake,
+            "-S",
+            BENCHMARKS_DIR,
+            "-B",
+            build_dir,
+            "-DCMAKE_BUILD_TYPE=Release",
+            f"-DNANOARROW_BENCHMARK_SOURCE_URL={checkout}",
+        ]
+        + list(cmake_args),
+        check=True,
+    )
+    subprocess.run([cmake, "--build", build_dir], check=True)
+
+    executables = sorted(glob.glob(os.path.join(build_dir, "*_benchmark")))
+    if not executables:
+        raise ValueError(f"No benchmark executables were built in '{build_dir}'")
+
+    os.makedirs(out_dir, exist_ok=True)
+    for executable in executables:
+        name = os.path.basename(executable)
+        args = [
+            executable,
+            f"--benchmark_repetitions={repetitions}",
+            f"--benchmark_out={os.path.join(out_dir, name + '.json')}",
+            "--benchmark_out_format=json",
+        ]
+        if benchmark_filter:
+            args.append(f"--benchmark_filter={benchmark_filter}")
+
+        # The working directory is where CMake copied the IPC fixtures
+        subprocess.run(args, cwd=build_dir, check=True)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument(
+        "--results-dir",
+        default=os.path.join(BENCHMARKS_DIR, "results"),
+        help="Directory in which results are stored per commit",
+    )
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run = subparsers.add_parser(
+        "run", help="Build and run the benchmarks against a local checkout"
+    )
+    run.add_argument("checkout", help="Path to a nanoarrow checkout")
+    run.add_argument("--build-dir", help="Defaults to build/compare/<commit>")
+    run.add_argument("--repetitions", type=int, default=10)
+    run.add_argument("--filter", default="", help="Passed as --benchmark_filter")
+    run.add_argument(
+        "--cmake-arg", action="append", default=[], help="Extra configure argument"
+    )
+
+    compare = subparsers.add_parser(
+        "compare", help="Compare two recorded commits, directories, or JSON files"
+    )
+    compare.add_argument("baseline")
+    compare.add_argument("contender")
+    compare.add_argument(
+        "--metric", choices=["real_time", "cpu_time"], default="real_time"
+    )
+    compare.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="Minimum relative change in median time to report (default 0.05)",
+    )
+    compare.add_argument(
+        "--threshold-for",
+        action="append",
+        default=[],
+        metavar="REGEX=THRESHOLD",
+        help="Override the threshold for benchmarks matching REGEX",
+    )
+    compare.add_argument(
+        "--alpha",
+        type=float,
+        default=0.05,
+        help="Significance level of the Mann-Whitney U test (default 0.05)",
+    )
+    compare.add_argument("--filter", default="", help="Only compare matching names")
+
+    args = parser.parse_args(argv)
+
+    if args.command == "run":
+        checkout = os.path.abspath(args.checkout)
+        commit = checkout_id(checkout)
+        build_dir = args.build_dir or os.path.join(
+            BENCHMARKS_DIR, "build", "compare", commit
+        )
+        out_dir = os.path.join(args.results_dir, commit)
+        run_benchmarks(
+            checkout, build_dir, out_dir, args.repetitions, args.filter, args.cmake_arg
+        )
+        print(f"Results for {commit} written to '{out_dir}'")
+        return 0
+
+    baseline = load_results(
+        [resolve_results(args.baseline, args.results_dir)], args.metric
+    )
+    contender = load_results(
+        [resolve_results(args.contender, args.results_dir)], args.metric
+    )
+    if args.filter:
+        pattern = re.compile(args.filter)
+        baseline = filter_results(baseline, pattern)
+        contender = filter_results(contender, pattern)
+
+    rows = compare_results(
+        baseline,
+        contender,
+        threshold=args.threshold,
+        alpha=args.alpha,
+        overrides=parse_thresholds(args.threshold_for),
+    )
+    if not rows:
+        print("No benchmarks in common", file=sys.stderr)
+        return 2
+
+    print(format_table(rows))
+
+    # e.g., benchmarks of a feature that only one of the checkouts has
+    for label, names in [
+        ("baseline", set(baseline) - set(contender)),
+        ("contender", set(contender) - set(baseline)),
+    ]:
+        if names:
+            print(
+                f"\nWarning: {len(names)} benchmark(s) only in the {label} "
+                "were not compared",
+                file=sys.stderr,
+            )
+
+    too_few = [row["name"] for row in rows if row["repetitions"] < MIN_REPETITIONS]
+    if too_few:
+        print(
+            f"\nWarning: {len(too_few)} benchmark(s) have fewer than "
+            f"{MIN_REPETITIONS} repetitions and cannot be flagged",
+            file=sys.stderr,
+        )
+
+    regressions = [row for row in rows if row["status"] == "REGRESSION"]
+    print(f"\n{len(regressions)} regression(s) in {len(rows)} benchmark(s)")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -19,6 +19,8 @@
 
 #include <nanoarrow/nanoarrow.hpp>
 
+#include "generated_fixtures.h"
+
 // The length of most arrays used in these benchmarks. Just big enough so
 // that the benchmark takes a non-trivial amount of time to run.
 static const int64_t kNumItemsPrettyBig = 1000000;
@@ -354,6 +356,107 @@ static void BenchmarkArrayAppendInt64(benchmark::State& state) {
   BaseBenchmarkArrayAppendInt<int64_t, NANOARROW_TYPE_INT64>(state);
 }
 
+#if defined(NANOARROW_BENCHMARK_HAS_ARRAY_BUILDER)
+
+/// \brief Use nanoarrow::StringBuilder<> to build a string array
+static void BenchmarkArrayBuilderAppendString(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::StringBuilder<> builder;
+
+  int64_t n_values = kNumItemsPrettyBig;
+  int64_t value_size = 7;
+
+  std::vector<std::string> values(n_values);
+  size_t alphabet_pos = 0;
+  for (std::string& value : values) {
+    if ((alphabet_pos + value_size) >= kAlphabet.size()) {
+      alphabet_pos = 0;
+    }
+
+    value.assign(kAlphabet.data() + alphabet_pos, value_size);
+    alphabet_pos += value_size;
+  }
+
+  for (auto _ : state) {
+    array.reset();
+    for (const std::string& value : values) {
+      NANOARROW_THROW_NOT_OK(builder.push_back(value));
+    }
+    NANOARROW_THROW_NOT_OK(builder.finish(array.get()));
+    benchmark::DoNotOptimize(array);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+template <typename CType>
+static void BaseBenchmarkArrayBuilderAppendInt(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::ArrayBuilder<CType> builder;
+
+  int64_t n_values = kNumItemsPrettyBig;
+
+  std::vector<CType> values(n_values);
+  for (int64_t i = 0; i < n_values; i++) {
+    values[i] = i % std::numeric_limits<CType>::max();
+  }
+
+  for (auto _ : state) {
+    array.reset();
+    for (CType value : values) {
+      NANOARROW_THROW_NOT_OK(builder.push_back(value));
+    }
+    NANOARROW_THROW_NOT_OK(builder.finish(array.get()));
+    benchmark::DoNotOptimize(array);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// \brief Use nanoarrow::ArrayBuilder<int8_t> to build an int8 array
+static void BenchmarkArrayBuilderAppendInt8(benchmark::State& state) {
+  BaseBenchmarkArrayBuilderAppendInt<int8_t>(state);
+}
+
+/// \brief Use nanoarrow::ArrayBuilder<int16_t> to build an int16 array
+static void BenchmarkArrayBuilderAppendInt16(benchmark::State& state) {
+  BaseBenchmarkArrayBuilderAppendInt<int16_t>(state);
+}
+
+/// \brief Use nanoarrow::ArrayBuilder<int32_t> to build an int32 array
+static void BenchmarkArrayBuilderAppendInt32(benchmark::State& state) {
+  BaseBenchmarkArrayBuilderAppendInt<int32_t>(state);
+}
+
+/// \brief Use nanoarrow::ArrayBuilder<int64_t> to build an int64 array
+static void BenchmarkArrayBuilderAppendInt64(benchmark::State& state) {
+  BaseBenchmarkArrayBuilderAppendInt<int64_t>(state);
+}
+
+/// \brief Use nanoarrow::ArrayBuilder<int64_t>::append_range() to build an int64 array
+static void BenchmarkArrayBuilderAppendRangeInt64(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::ArrayBuilder<int64_t> builder;
+
+  int64_t n_values = kNumItemsPrettyBig;
+
+  std::vector<int64_t> values(n_values);
+  for (int64_t i = 0; i < n_values; i++) {
+    values[i] = i;
+  }
+
+  for (auto _ : state) {
+    array.reset();
+    NANOARROW_THROW_NOT_OK(builder.append_range(values));
+    NANOARROW_THROW_NOT_OK(builder.finish(array.get()));
+    benchmark::DoNotOptimize(array);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+#endif
+
 template <typename CType, ArrowType type>
 static ArrowErrorCode CreateAndAppendIntWithNulls(ArrowArray* array,
                                                   const std::vector<int8_t>& validity) {
@@ -401,6 +504,786 @@ static void BenchmarkArrayAppendNulls(benchmark::State& state) {
 
 /// @}
 
+#if defined(NANOARROW_BENCHMARK_HAS_VIEW_ARRAY_AS_BLOCKS)
+
+/// \defgroup nanoarrow-benchmark-hpp-view C++ range helper benchmarks
+///
+/// Benchmarks for consuming ArrowArrays using `nanoarrow::ViewArrayAs<T>()`
+/// (one optional per element) versus `nanoarrow::ViewArrayAsBlocks<T>()`
+/// (one values span and validity word per 64 elements).
+///
+/// @{
+
+// Initialize an int64 array with state.range(0) percent of its values null
+static void InitInt64ArrayViewWithNulls(benchmark::State& state, ArrowArray* array,
+                                        ArrowArrayView* array_view) {
+  int64_t n_values = kNumItemsPrettyBig;
+
+  std::vector<int64_t> values(n_values);
+  for (int64_t i = 0; i < n_values; i++) {
+    values[i] = i % 1000;
+  }
+
+  std::vector<int8_t> validity;
+  if (state.range(0) > 0) {
+    int64_t null_spacing = 100 / state.range(0);
+    validity.resize(n_values);
+    for (int64_t i = 0; i < n_values; i++) {
+      validity[i] = i % null_spacing != 0;
+    }
+  }
+
+  NANOARROW_THROW_NOT_OK(InitArrayViewFromBuffers(NANOARROW_TYPE_INT64, array,
+                                                  array_view, validity, values));
+}
+
+static void BenchmarkViewArrayAsSum(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  InitInt64ArrayViewWithNulls(state, array.get(), array_view.get());
+
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (auto slot : nanoarrow::ViewArrayAs<int64_t>(array_view.get())) {
+      sum += slot.value_or(0);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(array_view->length * state.iterations());
+}
+
+static void BenchmarkViewArrayAsBlocksSum(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  InitInt64ArrayViewWithNulls(state, array.get(), array_view.get());
+
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (const auto& block : nanoarrow::ViewArrayAsBlocks<int64_t>(array_view.get())) {
+      if (block.all_valid()) {
+        for (int64_t i = 0; i < block.size; i++) {
+          sum += block.values[i];
+        }
+      } else {
+        for (int64_t i = 0; i < block.size; i++) {
+          sum += block.is_valid(i) ? block.values[i] : 0;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(array_view->length * state.iterations());
+}
+
+static void BenchmarkViewArrayAsFilterCount(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  InitInt64ArrayViewWithNulls(state, array.get(), array_view.get());
+
+  for (auto _ : state) {
+    int64_t count = 0;
+    for (auto slot : nanoarrow::ViewArrayAs<int64_t>(array_view.get())) {
+      count += slot && *slot > 500;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetItemsProcessed(array_view->length * state.iterations());
+}
+
+static void BenchmarkViewArrayAsBlocksFilterCount(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  InitInt64ArrayViewWithNulls(state, array.get(), array_view.get());
+
+  for (auto _ : state) {
+    int64_t count = 0;
+    for (const auto& block : nanoarrow::ViewArrayAsBlocks<int64_t>(array_view.get())) {
+      if (block.all_valid()) {
+        for (int64_t i = 0; i < block.size; i++) {
+          count += block.values[i] > 500;
+        }
+      } else {
+        for (int64_t i = 0; i < block.size; i++) {
+          count += block.is_valid(i) & (block.values[i] > 500);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetItemsProcessed(array_view->length * state.iterations());
+}
+
+/// @}
+
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_RECHUNK)
+
+/// \defgroup nanoarrow-benchmark-array-stream ArrowArrayStream-related benchmarks
+///
+/// Benchmarks for consuming a stream of many small (10-row) batches directly versus
+/// rechunking it with `ArrowRechunkArrayStreamInit()` first.
+///
+/// @{
+
+static const int64_t kSmallBatchSize = 10;
+
+// Initialize a stream of int64 arrays with kSmallBatchSize rows each
+static void InitSmallBatchStream(ArrowArrayStream* array_stream) {
+  int64_t n_batches = kNumItemsPrettyBig / kSmallBatchSize;
+
+  nanoarrow::UniqueSchema schema;
+  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT64));
+  NANOARROW_THROW_NOT_OK(
+      ArrowBasicArrayStreamInit(array_stream, schema.get(), n_batches));
+
+  for (int64_t i = 0; i < n_batches; i++) {
+    nanoarrow::UniqueArray array;
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_INT64));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+    for (int64_t j = 0; j < kSmallBatchSize; j++) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendInt(array.get(), j));
+    }
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), nullptr));
+    ArrowBasicArrayStreamSetArray(array_stream, i, array.get());
+  }
+}
+
+// Sum all values in an int64 stream, paying the per-batch overhead of populating
+// an ArrowArrayView
+static int64_t SumInt64Stream(ArrowArrayStream* array_stream) {
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_INT64);
+
+  int64_t sum = 0;
+  nanoarrow::UniqueArray array;
+  while (true) {
+    array.reset();
+    NANOARROW_THROW_NOT_OK(ArrowArrayStreamGetNext(array_stream, array.get(), nullptr));
+    if (array->release == nullptr) {
+      break;
+    }
+
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+    const int64_t* values = array_view->buffer_views[1].data.as_int64 + array->offset;
+    for (int64_t i = 0; i < array->length; i++) {
+      sum += values[i];
+    }
+  }
+
+  return sum;
+}
+
+/// \brief Consume a stream of 10-row int64 batches directly
+static void BenchmarkArrayStreamConsumeSmallBatches(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    nanoarrow::UniqueArrayStream array_stream;
+    InitSmallBatchStream(array_stream.get());
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(SumInt64Stream(array_stream.get()));
+  }
+
+  state.SetItemsProcessed(kNumItemsPrettyBig * state.iterations());
+}
+
+/// \brief Consume a stream of 10-row int64 batches after rechunking it into batches
+/// of state.range(0) rows
+static void BenchmarkArrayStreamRechunkSmallBatches(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    nanoarrow::UniqueArrayStream src;
+    InitSmallBatchStream(src.get());
+    state.ResumeTiming();
+
+    nanoarrow::UniqueArrayStream array_stream;
+    NANOARROW_THROW_NOT_OK(ArrowRechunkArrayStreamInit(array_stream.get(), src.get(),
+                                                       state.range(0), 0, nullptr));
+    benchmark::DoNotOptimize(SumInt64Stream(array_stream.get()));
+  }
+
+  state.SetItemsProcessed(kNumItemsPrettyBig * state.iterations());
+}
+
+/// @}
+
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_TAKE_FILTER)
+
+/// \defgroup nanoarrow-benchmark-selection Filter and take benchmarks
+///
+/// Benchmarks for `ArrowArrayFilter()` and `ArrowArrayTake()`. The argument is the
+/// percentage of elements selected (e.g., 1%, 50%, or 99%).
+///
+/// @{
+
+// Build a selection mask with approximately the requested percentage of bits set.
+// A simple LCG is used so that the selected positions are reproducible but do not
+// follow a pattern that would favour any particular code path.
+static std::vector<uint8_t> MakeSelectionMask(int64_t n_values, int64_t percent) {
+  std::vector<uint8_t> mask(_ArrowBytesForBits(n_values));
+  uint64_t state = 1234;
+  for (int64_t i = 0; i < n_values; i++) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    if (static_cast<int64_t>((state >> 33) % 100) < percent) {
+      ArrowBitSet(mask.data(), i);
+    }
+  }
+
+  return mask;
+}
+
+static std::vector<int64_t> MakeSelectionIndices(const std::vector<uint8_t>& mask,
+                                                 int64_t n_values) {
+  std::vector<int64_t> indices;
+  for (int64_t i = 0; i < n_values; i++) {
+    if (ArrowBitGet(mask.data(), i)) {
+      indices.push_back(i);
+    }
+  }
+
+  return indices;
+}
+
+/// \brief Use ArrowArrayFilter() to select from an int64 array with 20% nulls
+static void BenchmarkArrayFilterInt64(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  int64_t n_values = kNumItemsPrettyBig;
+
+  std::vector<int64_t> values(n_values);
+  std::vector<int8_t> validity(n_values);
+  for (int64_t i = 0; i < n_values; i++) {
+    values[i] = i;
+    validity[i] = i % 5 != 0;
+  }
+
+  NANOARROW_THROW_NOT_OK(InitArrayViewFromBuffers(NANOARROW_TYPE_INT64, array.get(),
+                                                  array_view.get(), validity, values));
+  std::vector<uint8_t> mask = MakeSelectionMask(n_values, state.range(0));
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray out;
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayFilter(array_view.get(), mask.data(), out.get(), nullptr));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// \brief Use ArrowArrayFilter() to select from a string array
+static void BenchmarkArrayFilterString(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  int64_t n_values = kNumItemsPrettyBig;
+
+  // Strings of length 0-9 taken from the alphabet
+  std::vector<int32_t> offsets(n_values + 1);
+  std::string data;
+  for (int64_t i = 0; i < n_values; i++) {
+    data.append(kAlphabet, 0, i % 10);
+    offsets[i + 1] = static_cast<int32_t>(data.size());
+  }
+
+  std::vector<char> data_buffer(data.begin(), data.end());
+  NANOARROW_THROW_NOT_OK(InitArrayViewFromBuffers(NANOARROW_TYPE_STRING, array.get(),
+                                                  array_view.get(), {}, offsets,
+                                                  data_buffer));
+  std::vector<uint8_t> mask = MakeSelectionMask(n_values, state.range(0));
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray out;
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayFilter(array_view.get(), mask.data(), out.get(), nullptr));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// \brief Use ArrowArrayTake() with precomputed indices to select from an int64 array
+static void BenchmarkArrayTakeInt64(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  int64_t n_values = kNumItemsPrettyBig;
+
+  std::vector<int64_t> values(n_values);
+  for (int64_t i = 0; i < n_values; i++) {
+    values[i] = i;
+  }
+
+  NANOARROW_THROW_NOT_OK(InitArrayViewFromBuffers(NANOARROW_TYPE_INT64, array.get(),
+                                                  array_view.get(), {}, values));
+  std::vector<uint8_t> mask = MakeSelectionMask(n_values, state.range(0));
+  std::vector<int64_t> indices = MakeSelectionIndices(mask, n_values);
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray out;
+    NANOARROW_THROW_NOT_OK(ArrowArrayTake(array_view.get(), indices.data(),
+                                          static_cast<int64_t>(indices.size()),
+                                          out.get(), nullptr));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(indices.size() * state.iterations());
+}
+
+/// @}
+
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_DICTIONARY_BUILDER)
+
+/// \defgroup nanoarrow-benchmark-dictionary Dictionary encoding benchmarks
+///
+/// Benchmarks for building dictionary-encoded arrays using `ArrowDictionaryBuilder`.
+///
+/// @{
+
+/// \brief Use ArrowDictionaryBuilderAppendArrayView() to encode a string array
+/// with the given number of distinct values
+static void BenchmarkDictionaryBuilderAppendArrayView(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  int64_t n_values = kNumItemsPrettyBig;
+  int64_t n_distinct = state.range(0);
+
+  std::vector<int32_t> offsets(n_values + 1);
+  std::string data;
+  for (int64_t i = 0; i < n_values; i++) {
+    int64_t value_id = (i * 7919) % n_distinct;
+    data.append(kAlphabet, 0, 8);
+    data.append(std::to_string(value_id));
+    offsets[i + 1] = static_cast<int32_t>(data.size());
+  }
+
+  std::vector<char> data_buffer(data.begin(), data.end());
+  NANOARROW_THROW_NOT_OK(InitArrayViewFromBuffers(NANOARROW_TYPE_STRING, array.get(),
+                                                  array_view.get(), {}, offsets,
+                                                  data_buffer));
+
+  for (auto _ : state) {
+    ArrowDictionaryBuilder builder;
+    NANOARROW_THROW_NOT_OK(ArrowDictionaryBuilderInit(&builder, NANOARROW_TYPE_STRING));
+    NANOARROW_THROW_NOT_OK(
+        ArrowDictionaryBuilderAppendArrayView(&builder, array_view.get(), nullptr));
+
+    nanoarrow::UniqueArray out;
+    NANOARROW_THROW_NOT_OK(ArrowDictionaryBuilderFinish(&builder, out.get(), nullptr));
+    ArrowDictionaryBuilderReset(&builder);
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// @}
+
+#endif
+
+/// \defgroup nanoarrow-benchmark-decimal Decimal conversion benchmarks
+///
+/// Benchmarks for converting decimal arrays to and from strings.
+///
+/// @{
+
+// Utility to create a decimal128 array with scale 4 and values of varying magnitude
+static ArrowErrorCode InitDecimalArray(struct ArrowArray* array,
+                                       struct ArrowArrayView* array_view,
+                                       int64_t n_values) {
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  NANOARROW_RETURN_NOT_OK(
+      ArrowSchemaSetTypeDecimal(schema.get(), NANOARROW_TYPE_DECIMAL128, 38, 4));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(array, schema.get(), nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 38, 4);
+  int64_t value = 1;
+  for (int64_t i = 0; i < n_values; i++) {
+    ArrowDecimalSetInt(&decimal, (i % 2) ? value : -value);
+    NANOARROW_RETURN_NOT_OK(ArrowArrayAppendDecimal(array, &decimal));
+    value = (value < 100000000000000LL) ? (value * 7 + i % 10) : 1;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(array, nullptr));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view, schema.get(), nullptr));
+  return ArrowArrayViewSetArray(array_view, array, nullptr);
+}
+
+/// \brief Use ArrowDecimalAppendStringToBuffer() to format each element of a
+/// decimal128 array
+static void BenchmarkDecimalAppendStringToBuffer(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  int64_t n_values = kNumItemsPrettyBig;
+  NANOARROW_THROW_NOT_OK(InitDecimalArray(array.get(), array_view.get(), n_values));
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 38, 4);
+
+  for (auto _ : state) {
+    nanoarrow::UniqueBuffer buffer;
+    for (int64_t i = 0; i < n_values; i++) {
+      ArrowArrayViewGetDecimalUnsafe(array_view.get(), i, &decimal);
+      NANOARROW_THROW_NOT_OK(ArrowDecimalAppendStringToBuffer(&decimal, buffer.get()));
+    }
+    benchmark::DoNotOptimize(buffer);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// \brief Use ArrowDecimalSetDigits() to parse each element of a string array
+/// into a decimal128 array
+static void BenchmarkDecimalSetDigits(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  int64_t n_values = kNumItemsPrettyBig;
+  NANOARROW_THROW_NOT_OK(InitDecimalArray(array.get(), array_view.get(), n_values));
+
+  // ArrowDecimalSetDigits() can only parse unscaled integers
+  std::vector<std::string> digits(n_values);
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 38, 4);
+  for (int64_t i = 0; i < n_values; i++) {
+    nanoarrow::UniqueBuffer buffer;
+    ArrowArrayViewGetDecimalUnsafe(array_view.get(), i, &decimal);
+    NANOARROW_THROW_NOT_OK(ArrowDecimalAppendDigitsToBuffer(&decimal, buffer.get()));
+    digits[i].assign(reinterpret_cast<char*>(buffer->data), buffer->size_bytes);
+  }
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray out;
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(out.get(), NANOARROW_TYPE_DECIMAL128));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(out.get()));
+    for (const auto& item : digits) {
+      NANOARROW_THROW_NOT_OK(
+          ArrowDecimalSetDigits(&decimal, ArrowCharView(item.c_str())));
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendDecimal(out.get(), &decimal));
+    }
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+#if defined(NANOARROW_BENCHMARK_HAS_DECIMAL_STRINGS)
+/// \brief Use ArrowArrayViewDecimalToStrings() to format a decimal128 array
+static void BenchmarkArrayViewDecimalToStrings(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  int64_t n_values = kNumItemsPrettyBig;
+  NANOARROW_THROW_NOT_OK(InitDecimalArray(array.get(), array_view.get(), n_values));
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray out;
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(out.get(), NANOARROW_TYPE_STRING));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(out.get()));
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewDecimalToStrings(array_view.get(), 4, out.get(), nullptr));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// \brief Use ArrowArrayAppendDecimalFromStrings() to parse a string array into
+/// a decimal128 array
+static void BenchmarkArrayAppendDecimalFromStrings(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  int64_t n_values = kNumItemsPrettyBig;
+  NANOARROW_THROW_NOT_OK(InitDecimalArray(array.get(), array_view.get(), n_values));
+
+  nanoarrow::UniqueArray strings;
+  nanoarrow::UniqueArrayView strings_view;
+  NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(strings.get(), NANOARROW_TYPE_STRING));
+  NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(strings.get()));
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewDecimalToStrings(array_view.get(), 4, strings.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(strings.get(), nullptr));
+  ArrowArrayViewInitFromType(strings_view.get(), NANOARROW_TYPE_STRING);
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewSetArray(strings_view.get(), strings.get(), nullptr));
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray out;
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(out.get(), NANOARROW_TYPE_DECIMAL128));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(out.get()));
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayAppendDecimalFromStrings(out.get(), strings_view.get(), 38, 4,
+                                           nullptr));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+#endif
+
+/// @}
+
+/// \defgroup nanoarrow-benchmark-half-float Half float conversion benchmarks
+///
+/// Benchmarks for converting between float and half float values.
+///
+/// @{
+
+// Utility to generate float values that are exactly representable as half floats
+static std::vector<float> MakeHalfFloatValues(int64_t n_values) {
+  std::vector<float> values(n_values);
+  for (int64_t i = 0; i < n_values; i++) {
+    values[i] = static_cast<float>(i % 2048) / 8.0f - 128.0f;
+  }
+  return values;
+}
+
+/// \brief Use ArrowArrayViewGetDoubleUnsafe() to consume a half float array
+static void BenchmarkArrayViewGetHalfFloat(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  int64_t n_values = kNumItemsPrettyBig;
+  std::vector<float> values = MakeHalfFloatValues(n_values);
+  std::vector<uint16_t> halves(n_values);
+  for (int64_t i = 0; i < n_values; i++) {
+    halves[i] = ArrowFloatToHalfFloat(values[i]);
+  }
+
+  NANOARROW_THROW_NOT_OK(InitArrayViewFromBuffers(
+      NANOARROW_TYPE_HALF_FLOAT, array.get(), array_view.get(), {}, halves));
+
+  std::vector<float> values_out(n_values);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < n_values; i++) {
+      values_out[i] =
+          static_cast<float>(ArrowArrayViewGetDoubleUnsafe(array_view.get(), i));
+    }
+    benchmark::DoNotOptimize(values_out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// \brief Use ArrowArrayAppendDouble() to build a half float array
+static void BenchmarkArrayAppendHalfFloat(benchmark::State& state) {
+  int64_t n_values = kNumItemsPrettyBig;
+  std::vector<float> values = MakeHalfFloatValues(n_values);
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray array;
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_HALF_FLOAT));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+    NANOARROW_THROW_NOT_OK(ArrowArrayReserve(array.get(), n_values));
+    for (const float value : values) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendDouble(array.get(), value));
+    }
+    benchmark::DoNotOptimize(array);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+#if defined(NANOARROW_BENCHMARK_HAS_FLOAT_N)
+/// \brief Use ArrowHalfFloatToFloatN() to consume a half float array
+static void BenchmarkHalfFloatToFloatN(benchmark::State& state) {
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+
+  int64_t n_values = kNumItemsPrettyBig;
+  std::vector<float> values = MakeHalfFloatValues(n_values);
+  std::vector<uint16_t> halves(n_values);
+  ArrowFloatToHalfFloatN(values.data(), halves.data(), n_values);
+
+  NANOARROW_THROW_NOT_OK(InitArrayViewFromBuffers(
+      NANOARROW_TYPE_HALF_FLOAT, array.get(), array_view.get(), {}, halves));
+
+  std::vector<float> values_out(n_values);
+  for (auto _ : state) {
+    ArrowHalfFloatToFloatN(array_view->buffer_views[1].data.as_uint16,
+                           values_out.data(), n_values);
+    benchmark::DoNotOptimize(values_out);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+
+/// \brief Use ArrowArrayAppendFloatN() to build a half float array
+static void BenchmarkArrayAppendFloatNHalfFloat(benchmark::State& state) {
+  int64_t n_values = kNumItemsPrettyBig;
+  std::vector<float> values = MakeHalfFloatValues(n_values);
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray array;
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_HALF_FLOAT));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+    NANOARROW_THROW_NOT_OK(ArrowArrayAppendFloatN(array.get(), values.data(), n_values));
+    benchmark::DoNotOptimize(array);
+  }
+
+  state.SetItemsProcessed(n_values * state.iterations());
+}
+#endif
+
+/// @}
+
+/// \defgroup nanoarrow-benchmark-fixtures Nested and generated fixture benchmarks
+///
+/// Benchmarks for building and validating wide, deeply nested, string-heavy, and
+/// null-heavy record batches (see generated_fixtures.h). Each batch contains roughly
+/// 1,000,000 leaf values; bytes processed refers to the total size of all buffers
+/// in the batch.
+///
+/// @{
+
+static void BaseBenchmarkArrayAppendFixture(enum BenchmarkFixture fixture,
+                                            benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  NANOARROW_THROW_NOT_OK(InitFixtureSchema(fixture, schema.get()));
+
+  int64_t n_rows = FixtureNumRows(fixture);
+  int64_t size_bytes = 0;
+  for (auto _ : state) {
+    nanoarrow::UniqueArray array;
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+    NANOARROW_THROW_NOT_OK(AppendFixtureRows(fixture, array.get(), n_rows));
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), nullptr));
+    size_bytes = FixtureBatchSizeBytes(array.get());
+    benchmark::DoNotOptimize(array);
+  }
+
+  state.SetItemsProcessed(n_rows * FixtureItemsPerRow(fixture) * state.iterations());
+  state.SetBytesProcessed(size_bytes * state.iterations());
+}
+
+/// \brief Use the ArrowArrayAppend*() family to build a struct with 1000 columns
+static void BenchmarkArrayAppendFixtureWide(benchmark::State& state) {
+  BaseBenchmarkArrayAppendFixture(BENCHMARK_FIXTURE_WIDE, state);
+}
+
+/// \brief Use the ArrowArrayAppend*() family to build six levels of nested
+/// list<struct> with an int64 leaf
+static void BenchmarkArrayAppendFixtureDeep(benchmark::State& state) {
+  BaseBenchmarkArrayAppendFixture(BENCHMARK_FIXTURE_DEEP, state);
+}
+
+/// \brief Use ArrowArrayAppendString() to build a struct with four string columns
+static void BenchmarkArrayAppendFixtureStrings(benchmark::State& state) {
+  BaseBenchmarkArrayAppendFixture(BENCHMARK_FIXTURE_STRINGS, state);
+}
+
+/// \brief Use the ArrowArrayAppend*() family to build a struct with four columns
+/// where 90% of values are null
+static void BenchmarkArrayAppendFixtureNulls(benchmark::State& state) {
+  BaseBenchmarkArrayAppendFixture(BENCHMARK_FIXTURE_NULLS, state);
+}
+
+static void BaseBenchmarkArrayFinishBuildingFixture(enum BenchmarkFixture fixture,
+                                                    benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  NANOARROW_THROW_NOT_OK(MakeFixtureBatch(fixture, schema.get(), array.get()));
+  auto validation_level = static_cast<enum ArrowValidationLevel>(state.range(0));
+
+  // Finishing an array that was already finished flushes its buffer pointers and
+  // validates it again, which is the work done at the end of every build
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayFinishBuilding(array.get(), validation_level, nullptr));
+  }
+
+  int64_t n_rows = FixtureNumRows(fixture);
+  state.SetItemsProcessed(n_rows * FixtureItemsPerRow(fixture) * state.iterations());
+  state.SetBytesProcessed(FixtureBatchSizeBytes(array.get()) * state.iterations());
+}
+
+/// \brief Use ArrowArrayFinishBuilding() to finish a struct with 1000 columns
+static void BenchmarkArrayFinishBuildingFixtureWide(benchmark::State& state) {
+  BaseBenchmarkArrayFinishBuildingFixture(BENCHMARK_FIXTURE_WIDE, state);
+}
+
+/// \brief Use ArrowArrayFinishBuilding() to finish six levels of nested list<struct>
+static void BenchmarkArrayFinishBuildingFixtureDeep(benchmark::State& state) {
+  BaseBenchmarkArrayFinishBuildingFixture(BENCHMARK_FIXTURE_DEEP, state);
+}
+
+/// \brief Use ArrowArrayFinishBuilding() to finish a struct with four string columns
+static void BenchmarkArrayFinishBuildingFixtureStrings(benchmark::State& state) {
+  BaseBenchmarkArrayFinishBuildingFixture(BENCHMARK_FIXTURE_STRINGS, state);
+}
+
+/// \brief Use ArrowArrayFinishBuilding() to finish a struct with four mostly null
+/// columns
+static void BenchmarkArrayFinishBuildingFixtureNulls(benchmark::State& state) {
+  BaseBenchmarkArrayFinishBuildingFixture(BENCHMARK_FIXTURE_NULLS, state);
+}
+
+static void BaseBenchmarkArrayViewValidateFixture(enum BenchmarkFixture fixture,
+                                                  benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_THROW_NOT_OK(MakeFixtureBatch(fixture, schema.get(), array.get()));
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+  auto validation_level = static_cast<enum ArrowValidationLevel>(state.range(0));
+
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewValidate(array_view.get(), validation_level, nullptr));
+  }
+
+  int64_t n_rows = FixtureNumRows(fixture);
+  state.SetItemsProcessed(n_rows * FixtureItemsPerRow(fixture) * state.iterations());
+
+  // Only full validation reads every byte of the batch (the default level does a
+  // constant amount of work per array regardless of its length)
+  if (validation_level == NANOARROW_VALIDATION_LEVEL_FULL) {
+    state.SetBytesProcessed(FixtureBatchSizeBytes(array.get()) * state.iterations());
+  }
+}
+
+/// \brief Use ArrowArrayViewValidate() to validate a struct with 1000 columns
+static void BenchmarkArrayViewValidateFixtureWide(benchmark::State& state) {
+  BaseBenchmarkArrayViewValidateFixture(BENCHMARK_FIXTURE_WIDE, state);
+}
+
+/// \brief Use ArrowArrayViewValidate() to validate six levels of nested list<struct>
+static void BenchmarkArrayViewValidateFixtureDeep(benchmark::State& state) {
+  BaseBenchmarkArrayViewValidateFixture(BENCHMARK_FIXTURE_DEEP, state);
+}
+
+/// \brief Use ArrowArrayViewValidate() to validate a struct with four string columns
+static void BenchmarkArrayViewValidateFixtureStrings(benchmark::State& state) {
+  BaseBenchmarkArrayViewValidateFixture(BENCHMARK_FIXTURE_STRINGS, state);
+}
+
+/// \brief Use ArrowArrayViewValidate() to validate a struct with four mostly null
+/// columns
+static void BenchmarkArrayViewValidateFixtureNulls(benchmark::State& state) {
+  BaseBenchmarkArrayViewValidateFixture(BENCHMARK_FIXTURE_NULLS, state);
+}
+
+/// @}
+
 BENCHMARK(BenchmarkArrayViewGetInt8);
 BENCHMARK(BenchmarkArrayViewGetInt16);
 BENCHMARK(BenchmarkArrayViewGetInt32);
@@ -416,4 +1299,78 @@ BENCHMARK(BenchmarkArrayAppendInt32);
 BENCHMARK(BenchmarkArrayAppendInt64);
 BENCHMARK(BenchmarkArrayAppendNulls);
 
+#if defined(NANOARROW_BENCHMARK_HAS_ARRAY_BUILDER)
+BENCHMARK(BenchmarkArrayBuilderAppendString);
+BENCHMARK(BenchmarkArrayBuilderAppendInt8);
+BENCHMARK(BenchmarkArrayBuilderAppendInt16);
+BENCHMARK(BenchmarkArrayBuilderAppendInt32);
+BENCHMARK(BenchmarkArrayBuilderAppendInt64);
+BENCHMARK(BenchmarkArrayBuilderAppendRangeInt64);
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_VIEW_ARRAY_AS_BLOCKS)
+BENCHMARK(BenchmarkViewArrayAsSum)->Arg(0)->Arg(20);
+BENCHMARK(BenchmarkViewArrayAsBlocksSum)->Arg(0)->Arg(20);
+BENCHMARK(BenchmarkViewArrayAsFilterCount)->Arg(0)->Arg(20);
+BENCHMARK(BenchmarkViewArrayAsBlocksFilterCount)->Arg(0)->Arg(20);
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_RECHUNK)
+BENCHMARK(BenchmarkArrayStreamConsumeSmallBatches);
+BENCHMARK(BenchmarkArrayStreamRechunkSmallBatches)->Arg(1024)->Arg(65536);
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_TAKE_FILTER)
+BENCHMARK(BenchmarkArrayFilterInt64)->Arg(1)->Arg(50)->Arg(99);
+BENCHMARK(BenchmarkArrayFilterString)->Arg(1)->Arg(50)->Arg(99);
+BENCHMARK(BenchmarkArrayTakeInt64)->Arg(1)->Arg(50)->Arg(99);
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_DICTIONARY_BUILDER)
+BENCHMARK(BenchmarkDictionaryBuilderAppendArrayView)->Arg(100)->Arg(100000);
+#endif
+
+BENCHMARK(BenchmarkDecimalAppendStringToBuffer);
+BENCHMARK(BenchmarkDecimalSetDigits);
+#if defined(NANOARROW_BENCHMARK_HAS_DECIMAL_STRINGS)
+BENCHMARK(BenchmarkArrayViewDecimalToStrings);
+BENCHMARK(BenchmarkArrayAppendDecimalFromStrings);
+#endif
+
+BENCHMARK(BenchmarkArrayViewGetHalfFloat);
+BENCHMARK(BenchmarkArrayAppendHalfFloat);
+#if defined(NANOARROW_BENCHMARK_HAS_FLOAT_N)
+BENCHMARK(BenchmarkHalfFloatToFloatN);
+BENCHMARK(BenchmarkArrayAppendFloatNHalfFloat);
+#endif
+
+BENCHMARK(BenchmarkArrayAppendFixtureWide);
+BENCHMARK(BenchmarkArrayAppendFixtureDeep);
+BENCHMARK(BenchmarkArrayAppendFixtureStrings);
+BENCHMARK(BenchmarkArrayAppendFixtureNulls);
+BENCHMARK(BenchmarkArrayFinishBuildingFixtureWide)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+BENCHMARK(BenchmarkArrayFinishBuildingFixtureDeep)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+BENCHMARK(BenchmarkArrayFinishBuildingFixtureStrings)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+BENCHMARK(BenchmarkArrayFinishBuildingFixtureNulls)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+BENCHMARK(BenchmarkArrayViewValidateFixtureWide)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+BENCHMARK(BenchmarkArrayViewValidateFixtureDeep)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+BENCHMARK(BenchmarkArrayViewValidateFixtureStrings)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+BENCHMARK(BenchmarkArrayViewValidateFixtureNulls)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_DEFAULT)
+    ->Arg(NANOARROW_VALIDATION_LEVEL_FULL);
+
 BENCHMARK_MAIN();
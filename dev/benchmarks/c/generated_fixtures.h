@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef NANOARROW_BENCHMARK_GENERATED_FIXTURES_H_INCLUDED
+#define NANOARROW_BENCHMARK_GENERATED_FIXTURES_H_INCLUDED
+
+#include <string>
+
+#include <nanoarrow/nanoarrow.hpp>
+
+// Record batches generated in-process such that benchmarks can exercise shapes of
+// data that are not covered by the float64 .arrows fixtures written by
+// generate-fixtures.py. Only API available in all benchmarked versions of nanoarrow
+// is used here. Each fixture is sized to contain roughly 1,000,000 leaf values.
+
+enum BenchmarkFixture {
+  // A struct with 1000 alternating int32 and float64 columns
+  BENCHMARK_FIXTURE_WIDE,
+  // A single column of six nested list<struct<item: ...>> levels with two elements
+  // per list and an int64 leaf
+  BENCHMARK_FIXTURE_DEEP,
+  // A struct with four string columns with values between 0 and 63 bytes long
+  BENCHMARK_FIXTURE_STRINGS,
+  // A struct with two int64 and two string columns where 90% of values are null
+  BENCHMARK_FIXTURE_NULLS
+};
+
+static const int64_t kFixtureWideColumns = 1000;
+static const int64_t kFixtureDeepDepth = 6;
+static const int64_t kFixtureStringsColumns = 4;
+static const int64_t kFixtureNullsColumns = 4;
+
+// The number of rows in the generated batch for each fixture
+static inline int64_t FixtureNumRows(enum BenchmarkFixture fixture) {
+  switch (fixture) {
+    case BENCHMARK_FIXTURE_WIDE:
+      return 1000;
+    case BENCHMARK_FIXTURE_DEEP:
+      return 1000000 >> kFixtureDeepDepth;
+    default:
+      return 250000;
+  }
+}
+
+// The number of leaf values in each row of the generated batch for each fixture
+static inline int64_t FixtureItemsPerRow(enum BenchmarkFixture fixture) {
+  switch (fixture) {
+    case BENCHMARK_FIXTURE_WIDE:
+      return kFixtureWideColumns;
+    case BENCHMARK_FIXTURE_DEEP:
+      return static_cast<int64_t>(1) << kFixtureDeepDepth;
+    case BENCHMARK_FIXTURE_STRINGS:
+      return kFixtureStringsColumns;
+    default:
+      return kFixtureNullsColumns;
+  }
+}
+
+// Utility to initialize a schema of depth nested list<struct<item: ...>> levels with
+// an int64 leaf (depth 0 is a single int64 column)
+static inline ArrowErrorCode InitDeepSchema(struct ArrowSchema* schema, int64_t depth) {
+  ArrowSchemaInit(schema);
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeStruct(schema, 1));
+  struct ArrowSchema* node = schema->children[0];
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(node, "col"));
+  for (int64_t i = 0; i < depth; i++) {
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(node, NANOARROW_TYPE_LIST));
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeStruct(node->children[0], 1));
+    node = node->children[0]->children[0];
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(node, "item"));
+  }
+
+  return ArrowSchemaSetType(node, NANOARROW_TYPE_INT64);
+}
+
+static inline ArrowErrorCode InitFixtureSchema(enum BenchmarkFixture fixture,
+                                               struct ArrowSchema* schema) {
+  if (fixture == BENCHMARK_FIXTURE_DEEP) {
+    return InitDeepSchema(schema, kFixtureDeepDepth);
+  }
+
+  int64_t n_columns = FixtureItemsPerRow(fixture);
+  ArrowSchemaInit(schema);
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeStruct(schema, n_columns));
+  for (int64_t i = 0; i < n_columns; i++) {
+    enum ArrowType type;
+    switch (fixture) {
+      case BENCHMARK_FIXTURE_WIDE:
+        type = (i % 2 == 0) ? NANOARROW_TYPE_INT32 : NANOARROW_TYPE_DOUBLE;
+        break;
+      case BENCHMARK_FIXTURE_STRINGS:
+        type = NANOARROW_TYPE_STRING;
+        break;
+      default:
+        type = (i % 2 == 0) ? NANOARROW_TYPE_INT64 : NANOARROW_TYPE_STRING;
+        break;
+    }
+
+    std::string name = "col" + std::to_string(i);
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema->children[i], type));
+    NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[i], name.c_str()));
+  }
+
+  return NANOARROW_OK;
+}
+
+static inline ArrowErrorCode AppendDeepValue(struct ArrowArray* array, int64_t depth,
+                                             int64_t* value) {
+  if (depth == 0) {
+    return ArrowArrayAppendInt(array, (*value)++);
+  }
+
+  struct ArrowArray* item = array->children[0];
+  for (int i = 0; i < 2; i++) {
+    NANOARROW_RETURN_NOT_OK(AppendDeepValue(item->children[0], depth - 1, value));
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(item));
+  }
+
+  return ArrowArrayFinishElement(array);
+}
+
+// Append n_rows rows to array (which must have been initialized from the schema
+// produced by InitFixtureSchema() and must be ready for appending)
+static inline ArrowErrorCode AppendFixtureRows(enum BenchmarkFixture fixture,
+                                               struct ArrowArray* array,
+                                               int64_t n_rows) {
+  static const std::string kChars(64, 'a');
+  int64_t value = 0;
+
+  for (int64_t i = 0; i < n_rows; i++) {
+    if (fixture == BENCHMARK_FIXTURE_DEEP) {
+      NANOARROW_RETURN_NOT_OK(
+          AppendDeepValue(array->children[0], kFixtureDeepDepth, &value));
+      NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(array));
+      continue;
+    }
+
+    for (int64_t j = 0; j < array->n_children; j++) {
+      struct ArrowArray* child = array->children[j];
+      struct ArrowStringView string_value = {kChars.data(), (i * 7 + j) % 64};
+
+      switch (fixture) {
+        case BENCHMARK_FIXTURE_WIDE:
+          if (j % 2 == 0) {
+            NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(child, i + j));
+          } else {
+            NANOARROW_RETURN_NOT_OK(ArrowArrayAppendDouble(child, (i + j) * 0.5));
+          }
+          break;
+        case BENCHMARK_FIXTURE_STRINGS:
+          NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(child, string_value));
+          break;
+        default:
+          if ((i + j) % 10 != 0) {
+            NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(child, 1));
+          } else if (j % 2 == 0) {
+            NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(child, i));
+          } else {
+            NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(child, string_value));
+          }
+          break;
+      }
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(array));
+  }
+
+  return NANOARROW_OK;
+}
+
+// Utility to create a schema and a batch with FixtureNumRows() rows for a fixture
+static inline ArrowErrorCode MakeFixtureBatch(enum BenchmarkFixture fixture,
+                                              struct ArrowSchema* schema,
+                                              struct ArrowArray* array) {
+  NANOARROW_RETURN_NOT_OK(InitFixtureSchema(fixture, schema));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(array, schema, nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+  NANOARROW_RETURN_NOT_OK(AppendFixtureRows(fixture, array, FixtureNumRows(fixture)));
+  return ArrowArrayFinishBuildingDefault(array, nullptr);
+}
+
+// The total size of all buffers in an array built by nanoarrow (including children)
+static inline int64_t FixtureBatchSizeBytes(struct ArrowArray* array) {
+  int64_t size_bytes = 0;
+  for (int64_t i = 0; i < array->n_buffers; i++) {
+    size_bytes += ArrowArrayBuffer(array, i)->size_bytes;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    size_bytes += FixtureBatchSizeBytes(array->children[i]);
+  }
+
+  return size_bytes;
+}
+
+#endif
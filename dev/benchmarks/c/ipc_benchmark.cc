@@ -16,12 +16,22 @@
 // under the License.
 
 #include <stdio.h>
+#include <chrono>
 
 #include <benchmark/benchmark.h>
 
 #include <nanoarrow/nanoarrow.hpp>
 #include <nanoarrow/nanoarrow_ipc.hpp>
 
+// Older versions of nanoarrow declared the multi-threaded helpers in nanoarrow.hpp
+#if defined(__has_include)
+#if __has_include(<nanoarrow/nanoarrow_threads.hpp>)
+#include <nanoarrow/nanoarrow_threads.hpp>
+#endif
+#endif
+
+#include "generated_fixtures.h"
+
 static ArrowErrorCode MakeFixtureInputStreamFile(const std::string& fixture_name,
                                                  ArrowIpcInputStream* out) {
   const char* fixture_dir = std::getenv("NANOARROW_BENCHMARK_FIXTURE_DIR");
@@ -90,14 +100,11 @@ static ArrowErrorCode ArrayStreamReadAll(ArrowArrayStream* array_stream,
 ///
 /// @{
 
-static void BaseBenchmarIpcFixtureBuffer(const std::string& fixture_name,
-                                         benchmark::State& state) {
+static void BaseBenchmarkIpcReadBuffer(ArrowBuffer* buffer, benchmark::State& state,
+                                       ArrowIpcArrayStreamReaderOptions* options) {
   int64_t batch_count = 0;
   int64_t column_count = 0;
 
-  nanoarrow::UniqueBuffer buffer;
-  NANOARROW_THROW_NOT_OK(MakeFixtureBuffer(fixture_name, buffer.get()));
-
   for (auto _ : state) {
     // Don't copy the buffer within the benchmarking loop
     nanoarrow::UniqueBuffer buffer_copy;
@@ -114,7 +121,7 @@ static void BaseBenchmarIpcFixtureBuffer(const std::string& fixture_name,
 
     nanoarrow::UniqueArrayStream array_stream;
     NANOARROW_THROW_NOT_OK(
-        ArrowIpcArrayStreamReaderInit(array_stream.get(), input_stream.get(), nullptr));
+        ArrowIpcArrayStreamReaderInit(array_stream.get(), input_stream.get(), options));
 
     NANOARROW_THROW_NOT_OK(
         ArrayStreamReadAll(array_stream.get(), &batch_count, &column_count));
@@ -125,6 +132,14 @@ static void BaseBenchmarIpcFixtureBuffer(const std::string& fixture_name,
   state.SetBytesProcessed(state.iterations() * buffer->size_bytes);
 }
 
+static void BaseBenchmarIpcFixtureBuffer(
+    const std::string& fixture_name, benchmark::State& state,
+    ArrowIpcArrayStreamReaderOptions* options = nullptr) {
+  nanoarrow::UniqueBuffer buffer;
+  NANOARROW_THROW_NOT_OK(MakeFixtureBuffer(fixture_name, buffer.get()));
+  BaseBenchmarkIpcReadBuffer(buffer.get(), state, options);
+}
+
 /// \brief Use the ArrowArrayStream IPC reader to read a ~10 MB stream with 10
 /// float64 columns.
 static void BenchmarkIpcReadFloat64FromBuffer(benchmark::State& state) {
@@ -147,4 +162,719 @@ BENCHMARK(BenchmarkIpcReadFloat64FromBuffer);
 BENCHMARK(BenchmarkIpcReadFloat64LongFromBuffer);
 BENCHMARK(BenchmarkIpcReadFloat64WideFromBuffer);
 
+#if defined(NANOARROW_BENCHMARK_HAS_IPC_ZSTD)
+/// \brief Use the ArrowArrayStream IPC reader to read the float64_basic stream
+/// written with ZSTD buffer compression.
+///
+/// Bytes processed refers to the compressed size of the stream. This benchmark is
+/// skipped if nanoarrow_ipc was built without ZSTD support or if the fixture was
+/// not generated.
+static void BenchmarkIpcReadFloat64ZstdFromBuffer(benchmark::State& state) {
+  if (ArrowIpcGetZstdDecompressionFunction() == nullptr) {
+    state.SkipWithError("nanoarrow_ipc was built without ZSTD support");
+    return;
+  }
+
+  nanoarrow::UniqueBuffer buffer;
+  if (MakeFixtureBuffer("float64_basic_zstd.arrows", buffer.get()) != NANOARROW_OK) {
+    state.SkipWithError("fixture float64_basic_zstd.arrows is missing");
+    return;
+  }
+
+  BaseBenchmarkIpcReadBuffer(buffer.get(), state, nullptr);
+}
+
+BENCHMARK(BenchmarkIpcReadFloat64ZstdFromBuffer);
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_IPC_HEADER_VERIFICATION)
+static void BaseBenchmarkIpcFixtureBufferUnverified(const std::string& fixture_name,
+                                                    benchmark::State& state) {
+  ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.header_verification = NANOARROW_IPC_HEADER_VERIFICATION_NONE;
+  BaseBenchmarIpcFixtureBuffer(fixture_name, state, &options);
+}
+
+/// \brief Use the ArrowArrayStream IPC reader to read a ~10 MB stream with 10
+/// float64 columns without verifying message headers.
+static void BenchmarkIpcReadFloat64FromBufferUnverified(benchmark::State& state) {
+  BaseBenchmarkIpcFixtureBufferUnverified("float64_basic.arrows", state);
+}
+
+/// \brief Use the ArrowArrayStream IPC reader to read a ~10 MB stream with 1280
+/// float64 columns without verifying message headers.
+static void BenchmarkIpcReadFloat64WideFromBufferUnverified(benchmark::State& state) {
+  BaseBenchmarkIpcFixtureBufferUnverified("float64_wide.arrows", state);
+}
+
+BENCHMARK(BenchmarkIpcReadFloat64FromBufferUnverified);
+BENCHMARK(BenchmarkIpcReadFloat64WideFromBufferUnverified);
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_PARALLEL_MAP) && \
+    defined(NANOARROW_BENCHMARK_HAS_VIEW_ARRAY_AS_BLOCKS)
+// Sums every float64 column of a batch, passing the batch through unchanged
+static ArrowErrorCode SumFloat64Columns(ArrowArray* in, ArrowArray* out,
+                                        ArrowError* error) {
+  NANOARROW_UNUSED(error);
+  for (int64_t i = 0; i < in->n_children; i++) {
+    double sum = 0;
+    for (const auto& block : nanoarrow::ViewArrayAsBlocks<double>(in->children[i])) {
+      for (int64_t j = 0; j < block.size; j++) {
+        sum += block.is_valid(j) ? block.values[j] : 0;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  ArrowArrayMove(in, out);
+  return NANOARROW_OK;
+}
+
+/// \brief Use the ArrowArrayStream IPC reader to read a ~10 MB stream with 10
+/// float64 columns, summing each column of each batch on state.range(0) threads
+/// using nanoarrow::ParallelMapArrayStream.
+static void BenchmarkIpcReadFloat64ParallelMap(benchmark::State& state) {
+  int64_t batch_count = 0;
+  int64_t column_count = 0;
+  int n_threads = static_cast<int>(state.range(0));
+
+  nanoarrow::UniqueBuffer buffer;
+  NANOARROW_THROW_NOT_OK(MakeFixtureBuffer("float64_basic.arrows", buffer.get()));
+
+  for (auto _ : state) {
+    // Don't copy the buffer within the benchmarking loop
+    nanoarrow::UniqueBuffer buffer_copy;
+    NANOARROW_THROW_NOT_OK(ArrowBufferSetAllocator(
+        buffer_copy.get(),
+        ArrowBufferDeallocator([](ArrowBufferAllocator*, uint8_t*, int64_t) -> void {},
+                               nullptr)));
+    buffer_copy->data = buffer->data;
+    buffer_copy->size_bytes = buffer->size_bytes;
+
+    nanoarrow::ipc::UniqueInputStream input_stream;
+    NANOARROW_THROW_NOT_OK(
+        ArrowIpcInputStreamInitBuffer(input_stream.get(), buffer_copy.get()));
+
+    nanoarrow::UniqueArrayStream array_stream;
+    NANOARROW_THROW_NOT_OK(
+        ArrowIpcArrayStreamReaderInit(array_stream.get(), input_stream.get(), nullptr));
+
+    nanoarrow::UniqueArrayStream mapped_stream;
+    nanoarrow::ParallelMapArrayStream(array_stream.get(), &SumFloat64Columns, n_threads)
+        .ToArrayStream(mapped_stream.get());
+
+    NANOARROW_THROW_NOT_OK(
+        ArrayStreamReadAll(mapped_stream.get(), &batch_count, &column_count));
+
+    benchmark::DoNotOptimize(batch_count);
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer->size_bytes);
+}
+
+BENCHMARK(BenchmarkIpcReadFloat64ParallelMap)->Arg(1)->Arg(2)->Arg(4);
+#endif
+
+/// @}
+
+#if defined(NANOARROW_BENCHMARK_HAS_IPC_WRITER)
+
+/// \defgroup nanoarrow-benchmark-ipc-writer IPC Writer Benchmarks
+///
+/// Benchmarks for writing wide, deeply nested, string-heavy, and null-heavy
+/// record batches (see generated_fixtures.h) to an in-memory stream using the
+/// ArrowIpcWriter and reading them back using the ArrowArrayStream IPC reader.
+/// Each batch contains roughly 1,000,000 leaf values; bytes processed refers to
+/// the size of the serialized stream.
+///
+/// @{
+
+// Utility to write a complete stream (schema, one batch, and end-of-stream) to output
+static ArrowErrorCode WriteStreamToBuffer(const ArrowSchema* schema,
+                                          const ArrowArrayView* array_view,
+                                          ArrowBuffer* output) {
+  output->size_bytes = 0;
+
+  nanoarrow::ipc::UniqueOutputStream output_stream;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcOutputStreamInitBuffer(output_stream.get(), output));
+
+  nanoarrow::ipc::UniqueWriter writer;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterInit(writer.get(), output_stream.get()));
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterWriteSchema(writer.get(), schema, nullptr));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcWriterWriteArrayView(writer.get(), array_view, nullptr));
+  return ArrowIpcWriterWriteArrayView(writer.get(), nullptr, nullptr);
+}
+
+static void BaseBenchmarkIpcWriteFixture(enum BenchmarkFixture fixture,
+                                         benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_THROW_NOT_OK(MakeFixtureBatch(fixture, schema.get(), array.get()));
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+  nanoarrow::UniqueBuffer output;
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(
+        WriteStreamToBuffer(schema.get(), array_view.get(), output.get()));
+    benchmark::DoNotOptimize(output->data);
+  }
+
+  int64_t n_rows = FixtureNumRows(fixture);
+  state.SetItemsProcessed(n_rows * FixtureItemsPerRow(fixture) * state.iterations());
+  state.SetBytesProcessed(output->size_bytes * state.iterations());
+}
+
+static void BaseBenchmarkIpcReadFixture(enum BenchmarkFixture fixture,
+                                        benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_THROW_NOT_OK(MakeFixtureBatch(fixture, schema.get(), array.get()));
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+  nanoarrow::UniqueBuffer buffer;
+  NANOARROW_THROW_NOT_OK(
+      WriteStreamToBuffer(schema.get(), array_view.get(), buffer.get()));
+
+  BaseBenchmarkIpcReadBuffer(buffer.get(), state, nullptr);
+
+  int64_t n_rows = FixtureNumRows(fixture);
+  state.SetItemsProcessed(n_rows * FixtureItemsPerRow(fixture) * state.iterations());
+}
+
+/// \brief Use the ArrowIpcWriter to write a batch with 1000 columns
+static void BenchmarkIpcWriteFixtureWide(benchmark::State& state) {
+  BaseBenchmarkIpcWriteFixture(BENCHMARK_FIXTURE_WIDE, state);
+}
+
+/// \brief Use the ArrowIpcWriter to write six levels of nested list<struct>
+static void BenchmarkIpcWriteFixtureDeep(benchmark::State& state) {
+  BaseBenchmarkIpcWriteFixture(BENCHMARK_FIXTURE_DEEP, state);
+}
+
+/// \brief Use the ArrowIpcWriter to write a batch with four string columns
+static void BenchmarkIpcWriteFixtureStrings(benchmark::State& state) {
+  BaseBenchmarkIpcWriteFixture(BENCHMARK_FIXTURE_STRINGS, state);
+}
+
+/// \brief Use the ArrowIpcWriter to write a batch with four mostly null columns
+static void BenchmarkIpcWriteFixtureNulls(benchmark::State& state) {
+  BaseBenchmarkIpcWriteFixture(BENCHMARK_FIXTURE_NULLS, state);
+}
+
+/// \brief Use the ArrowArrayStream IPC reader to read a batch with 1000 columns
+static void BenchmarkIpcReadFixtureWide(benchmark::State& state) {
+  BaseBenchmarkIpcReadFixture(BENCHMARK_FIXTURE_WIDE, state);
+}
+
+/// \brief Use the ArrowArrayStream IPC reader to read six levels of nested
+/// list<struct>
+static void BenchmarkIpcReadFixtureDeep(benchmark::State& state) {
+  BaseBenchmarkIpcReadFixture(BENCHMARK_FIXTURE_DEEP, state);
+}
+
+/// \brief Use the ArrowArrayStream IPC reader to read a batch with four string
+/// columns
+static void BenchmarkIpcReadFixtureStrings(benchmark::State& state) {
+  BaseBenchmarkIpcReadFixture(BENCHMARK_FIXTURE_STRINGS, state);
+}
+
+/// \brief Use the ArrowArrayStream IPC reader to read a batch with four mostly null
+/// columns
+static void BenchmarkIpcReadFixtureNulls(benchmark::State& state) {
+  BaseBenchmarkIpcReadFixture(BENCHMARK_FIXTURE_NULLS, state);
+}
+
+BENCHMARK(BenchmarkIpcWriteFixtureWide);
+BENCHMARK(BenchmarkIpcWriteFixtureDeep);
+BENCHMARK(BenchmarkIpcWriteFixtureStrings);
+BENCHMARK(BenchmarkIpcWriteFixtureNulls);
+BENCHMARK(BenchmarkIpcReadFixtureWide);
+BENCHMARK(BenchmarkIpcReadFixtureDeep);
+BENCHMARK(BenchmarkIpcReadFixtureStrings);
+BENCHMARK(BenchmarkIpcReadFixtureNulls);
+
+/// @}
+
+#endif
+
+/// \defgroup nanoarrow-benchmark-ipc-header IPC Header Benchmarks
+///
+/// Benchmarks for verifying and decoding IPC message headers. These report
+/// verify_seconds and decode_seconds counters (per iteration) so that the cost
+/// of flatbuffer verification can be compared to the cost of decoding.
+///
+/// @{
+
+static void BaseBenchmarkIpcHeaders(const std::string& fixture_name,
+                                    benchmark::State& state) {
+  using clock = std::chrono::steady_clock;
+
+  nanoarrow::UniqueBuffer buffer;
+  NANOARROW_THROW_NOT_OK(MakeFixtureBuffer(fixture_name, buffer.get()));
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  NANOARROW_THROW_NOT_OK(ArrowIpcDecoderInit(decoder.get()));
+
+  std::chrono::duration<double> verify_time(0);
+  std::chrono::duration<double> decode_time(0);
+  int64_t header_count = 0;
+
+  for (auto _ : state) {
+    ArrowBufferView data;
+    data.data.data = buffer->data;
+    data.size_bytes = buffer->size_bytes;
+
+    while (data.size_bytes > 0) {
+      int32_t prefix_size_bytes = 0;
+      if (ArrowIpcDecoderPeekHeader(decoder.get(), data, &prefix_size_bytes, nullptr) !=
+          NANOARROW_OK) {
+        // End-of-stream indicator
+        break;
+      }
+
+      auto start = clock::now();
+      NANOARROW_THROW_NOT_OK(ArrowIpcDecoderVerifyHeader(decoder.get(), data, nullptr));
+      auto verified = clock::now();
+      NANOARROW_THROW_NOT_OK(ArrowIpcDecoderDecodeHeader(decoder.get(), data, nullptr));
+      auto decoded = clock::now();
+
+      verify_time += verified - start;
+      decode_time += decoded - verified;
+      header_count++;
+
+      // Record batch headers can only be decoded once the schema is known
+      if (decoder->message_type == NANOARROW_IPC_MESSAGE_TYPE_SCHEMA) {
+        nanoarrow::UniqueSchema schema;
+        NANOARROW_THROW_NOT_OK(
+            ArrowIpcDecoderDecodeSchema(decoder.get(), schema.get(), nullptr));
+        NANOARROW_THROW_NOT_OK(
+            ArrowIpcDecoderSetSchema(decoder.get(), schema.get(), nullptr));
+      }
+
+      int64_t message_size_bytes = decoder->header_size_bytes + decoder->body_size_bytes;
+      data.data.as_uint8 += message_size_bytes;
+      data.size_bytes -= message_size_bytes;
+    }
+  }
+
+  state.counters["verify_seconds"] =
+      benchmark::Counter(verify_time.count(), benchmark::Counter::kAvgIterations);
+  state.counters["decode_seconds"] =
+      benchmark::Counter(decode_time.count(), benchmark::Counter::kAvgIterations);
+  state.counters["headers"] = benchmark::Counter(static_cast<double>(header_count),
+                                                 benchmark::Counter::kAvgIterations);
+}
+
+/// \brief Verify and decode the message headers of a ~10 MB stream with 10
+/// float64 columns.
+static void BenchmarkIpcHeadersFloat64(benchmark::State& state) {
+  BaseBenchmarkIpcHeaders("float64_basic.arrows", state);
+}
+
+/// \brief Verify and decode the message headers of a ~10 MB stream with 1280
+/// float64 columns.
+static void BenchmarkIpcHeadersFloat64Wide(benchmark::State& state) {
+  BaseBenchmarkIpcHeaders("float64_wide.arrows", state);
+}
+
+BENCHMARK(BenchmarkIpcHeadersFloat64);
+BENCHMARK(BenchmarkIpcHeadersFloat64Wide);
+
+/// @}
+
+#if defined(NANOARROW_BENCHMARK_HAS_IPC_WRITER)
+
+/// \defgroup nanoarrow-benchmark-ipc-view IPC Binary View Benchmarks
+///
+/// Benchmarks for encoding and decoding record batches with a single string column
+/// using the offset-based string type and the string view type. Values alternate
+/// between short strings (inlined in a string view) and longer strings (stored in
+/// variadic buffers).
+///
+/// @{
+
+static ArrowErrorCode MakeStringBatch(enum ArrowType type, int64_t n_rows,
+                                      ArrowSchema* schema, ArrowArray* array) {
+  ArrowSchemaInit(schema);
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeStruct(schema, 1));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(schema->children[0], type));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(schema->children[0], "col"));
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(array, schema, nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+
+  std::string long_value(40, 'x');
+  for (int64_t i = 0; i < n_rows; i++) {
+    std::string value = (i % 2 == 0) ? std::to_string(i) : long_value + std::to_string(i);
+    NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(
+        array->children[0], {value.data(), static_cast<int64_t>(value.size())}));
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(array));
+  }
+
+  return ArrowArrayFinishBuildingDefault(array, nullptr);
+}
+
+// Encode a record batch, failing if this version of nanoarrow_ipc can't encode one of
+// its types
+static ArrowErrorCode EncodeBatch(const ArrowArrayView* array_view, ArrowBuffer* header,
+                                  ArrowBuffer* body) {
+  nanoarrow::ipc::UniqueEncoder encoder;
+  NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderInit(encoder.get()));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcEncoderEncodeSimpleRecordBatch(encoder.get(), array_view, body, nullptr));
+  return ArrowIpcEncoderFinalizeBuffer(encoder.get(), true, header);
+}
+
+// Decode and fully validate a record batch written by EncodeBatch()
+static ArrowErrorCode DecodeBatch(ArrowIpcDecoder* decoder, const ArrowBuffer* header,
+                                  const ArrowBuffer* body, ArrowArray* out) {
+  ArrowBufferView header_view = {{header->data}, header->size_bytes};
+  ArrowBufferView body_view = {{body->data}, body->size_bytes};
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(decoder, header_view, nullptr));
+  return ArrowIpcDecoderDecodeArray(decoder, body_view, -1, out,
+                                    NANOARROW_VALIDATION_LEVEL_FULL, nullptr);
+}
+
+// Prepare decoder to decode a record batch written by EncodeBatch(), failing if this
+// version of nanoarrow_ipc can't encode or decode one of its types
+static ArrowErrorCode InitDecodeBatch(ArrowSchema* schema,
+                                      const ArrowArrayView* array_view,
+                                      ArrowIpcDecoder* decoder, ArrowBuffer* header,
+                                      ArrowBuffer* body) {
+  NANOARROW_RETURN_NOT_OK(EncodeBatch(array_view, header, body));
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderInit(decoder));
+  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderSetSchema(decoder, schema, nullptr));
+
+  nanoarrow::UniqueArray decoded;
+  return DecodeBatch(decoder, header, body, decoded.get());
+}
+
+static void BaseBenchmarkIpcEncodeStrings(enum ArrowType type, benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_THROW_NOT_OK(MakeStringBatch(type, 1000000, schema.get(), array.get()));
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+  nanoarrow::UniqueBuffer header;
+  nanoarrow::UniqueBuffer body;
+  if (EncodeBatch(array_view.get(), header.get(), body.get()) != NANOARROW_OK) {
+    state.SkipWithError("nanoarrow_ipc can't encode this type");
+    return;
+  }
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  NANOARROW_THROW_NOT_OK(ArrowIpcEncoderInit(encoder.get()));
+
+  for (auto _ : state) {
+    body->size_bytes = 0;
+    header->size_bytes = 0;
+    NANOARROW_THROW_NOT_OK(ArrowIpcEncoderEncodeSimpleRecordBatch(
+        encoder.get(), array_view.get(), body.get(), nullptr));
+    NANOARROW_THROW_NOT_OK(
+        ArrowIpcEncoderFinalizeBuffer(encoder.get(), true, header.get()));
+    benchmark::DoNotOptimize(body->data);
+  }
+
+  state.SetBytesProcessed(state.iterations() * body->size_bytes);
+}
+
+static void BaseBenchmarkIpcDecodeStrings(enum ArrowType type, benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_THROW_NOT_OK(MakeStringBatch(type, 1000000, schema.get(), array.get()));
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  nanoarrow::UniqueBuffer header;
+  nanoarrow::UniqueBuffer body;
+  if (InitDecodeBatch(schema.get(), array_view.get(), decoder.get(), header.get(),
+                      body.get()) != NANOARROW_OK) {
+    state.SkipWithError("nanoarrow_ipc can't encode or decode this type");
+    return;
+  }
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray decoded;
+    NANOARROW_THROW_NOT_OK(
+        DecodeBatch(decoder.get(), header.get(), body.get(), decoded.get()));
+    benchmark::DoNotOptimize(decoded->children[0]->buffers[1]);
+  }
+
+  state.SetBytesProcessed(state.iterations() * body->size_bytes);
+}
+
+/// \brief Encode a record batch with 1,000,000 strings as an offset-based string
+/// column.
+static void BenchmarkIpcEncodeString(benchmark::State& state) {
+  BaseBenchmarkIpcEncodeStrings(NANOARROW_TYPE_STRING, state);
+}
+
+/// \brief Encode a record batch with 1,000,000 strings as a string view column.
+static void BenchmarkIpcEncodeStringView(benchmark::State& state) {
+  BaseBenchmarkIpcEncodeStrings(NANOARROW_TYPE_STRING_VIEW, state);
+}
+
+/// \brief Decode and fully validate a record batch with 1,000,000 strings as an
+/// offset-based string column.
+static void BenchmarkIpcDecodeString(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeStrings(NANOARROW_TYPE_STRING, state);
+}
+
+/// \brief Decode and fully validate a record batch with 1,000,000 strings as a
+/// string view column.
+static void BenchmarkIpcDecodeStringView(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeStrings(NANOARROW_TYPE_STRING_VIEW, state);
+}
+
+BENCHMARK(BenchmarkIpcEncodeString);
+BENCHMARK(BenchmarkIpcEncodeStringView);
+BENCHMARK(BenchmarkIpcDecodeString);
+BENCHMARK(BenchmarkIpcDecodeStringView);
+
+/// @}
+
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_IPC_WRITER)
+
+/// \defgroup nanoarrow-benchmark-ipc-swap IPC Endian Swap Benchmarks
+///
+/// Benchmarks for decoding a record batch with 10 float64 columns (~10 MB) that was
+/// written with the non-native endianness (e.g., by a big-endian producer on a
+/// little-endian system), which requires every value to be byte-swapped.
+///
+/// @{
+
+class IpcSwapEndianFixture {
+ public:
+  IpcSwapEndianFixture(int64_t n_rows, int64_t n_columns) {
+    NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_STRUCT));
+    NANOARROW_THROW_NOT_OK(ArrowSchemaAllocateChildren(schema.get(), n_columns));
+    for (int64_t i = 0; i < n_columns; i++) {
+      NANOARROW_THROW_NOT_OK(
+          ArrowSchemaInitFromType(schema->children[i], NANOARROW_TYPE_DOUBLE));
+      NANOARROW_THROW_NOT_OK(ArrowSchemaSetName(schema->children[i], "col"));
+    }
+
+    nanoarrow::UniqueArray array;
+    NANOARROW_THROW_NOT_OK(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr));
+    NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array.get()));
+    for (int64_t i = 0; i < n_rows; i++) {
+      for (int64_t j = 0; j < n_columns; j++) {
+        NANOARROW_THROW_NOT_OK(
+            ArrowArrayAppendDouble(array->children[j], static_cast<double>(i + j)));
+      }
+      NANOARROW_THROW_NOT_OK(ArrowArrayFinishElement(array.get()));
+    }
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), nullptr));
+
+    nanoarrow::UniqueArrayView array_view;
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+    nanoarrow::ipc::UniqueEncoder encoder;
+    NANOARROW_THROW_NOT_OK(ArrowIpcEncoderInit(encoder.get()));
+    NANOARROW_THROW_NOT_OK(ArrowIpcEncoderEncodeSimpleRecordBatch(
+        encoder.get(), array_view.get(), body.get(), nullptr));
+    NANOARROW_THROW_NOT_OK(
+        ArrowIpcEncoderFinalizeBuffer(encoder.get(), true, header.get()));
+  }
+
+  // Prepare decoder to decode the record batch as if it had the non-native endianness
+  void InitDecoder(ArrowIpcDecoder* decoder, bool swap_endian) {
+    NANOARROW_THROW_NOT_OK(ArrowIpcDecoderInit(decoder));
+    NANOARROW_THROW_NOT_OK(ArrowIpcDecoderSetSchema(decoder, schema.get(), nullptr));
+    if (swap_endian) {
+      enum ArrowIpcEndianness endianness =
+          ArrowIpcSystemEndianness() == NANOARROW_IPC_ENDIANNESS_LITTLE
+              ? NANOARROW_IPC_ENDIANNESS_BIG
+              : NANOARROW_IPC_ENDIANNESS_LITTLE;
+      NANOARROW_THROW_NOT_OK(ArrowIpcDecoderSetEndianness(decoder, endianness));
+    }
+
+    NANOARROW_THROW_NOT_OK(ArrowIpcDecoderDecodeHeader(
+        decoder, {{header->data}, header->size_bytes}, nullptr));
+  }
+
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueBuffer header;
+  nanoarrow::UniqueBuffer body;
+};
+
+static void BaseBenchmarkIpcDecodeCopy(bool swap_endian, benchmark::State& state) {
+  IpcSwapEndianFixture fixture(100000, 10);
+  nanoarrow::ipc::UniqueDecoder decoder;
+  fixture.InitDecoder(decoder.get(), swap_endian);
+
+  ArrowBufferView body_view = {{fixture.body->data}, fixture.body->size_bytes};
+  for (auto _ : state) {
+    nanoarrow::UniqueArray decoded;
+    NANOARROW_THROW_NOT_OK(ArrowIpcDecoderDecodeArray(
+        decoder.get(), body_view, -1, decoded.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+        nullptr));
+    benchmark::DoNotOptimize(decoded->children[0]->buffers[1]);
+  }
+
+  state.SetBytesProcessed(state.iterations() * fixture.body->size_bytes);
+}
+
+/// \brief Decode a native-endian record batch, copying the body
+static void BenchmarkIpcDecodeNativeEndianCopy(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeCopy(false, state);
+}
+
+/// \brief Decode a non-native-endian record batch, swapping into a copy of the body
+static void BenchmarkIpcDecodeSwapEndianCopy(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeCopy(true, state);
+}
+
+BENCHMARK(BenchmarkIpcDecodeNativeEndianCopy);
+BENCHMARK(BenchmarkIpcDecodeSwapEndianCopy);
+
+#if defined(NANOARROW_BENCHMARK_HAS_IPC_DECODE_OWNED)
+static void BaseBenchmarkIpcDecodeOwned(bool swap_endian, benchmark::State& state) {
+  IpcSwapEndianFixture fixture(100000, 10);
+  nanoarrow::ipc::UniqueDecoder decoder;
+  fixture.InitDecoder(decoder.get(), swap_endian);
+
+  for (auto _ : state) {
+    // Simulate reading a fresh body for each message
+    state.PauseTiming();
+    nanoarrow::UniqueBuffer body;
+    NANOARROW_THROW_NOT_OK(
+        ArrowBufferAppend(body.get(), fixture.body->data, fixture.body->size_bytes));
+    state.ResumeTiming();
+
+    nanoarrow::UniqueArray decoded;
+    NANOARROW_THROW_NOT_OK(ArrowIpcDecoderDecodeArrayFromOwned(
+        decoder.get(), body.get(), -1, decoded.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+        nullptr));
+    benchmark::DoNotOptimize(decoded->children[0]->buffers[1]);
+  }
+
+  state.SetBytesProcessed(state.iterations() * fixture.body->size_bytes);
+}
+
+/// \brief Decode a native-endian record batch from an owned body
+static void BenchmarkIpcDecodeNativeEndianOwned(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeOwned(false, state);
+}
+
+/// \brief Decode a non-native-endian record batch from an owned body (in place)
+static void BenchmarkIpcDecodeSwapEndianOwned(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeOwned(true, state);
+}
+
+BENCHMARK(BenchmarkIpcDecodeNativeEndianOwned);
+BENCHMARK(BenchmarkIpcDecodeSwapEndianOwned);
+#endif
+
+/// @}
+
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_IPC_WRITER) && \
+    defined(NANOARROW_BENCHMARK_HAS_RUN_END_ENCODED)
+
+/// \defgroup nanoarrow-benchmark-ipc-ree IPC Run-End Encoded Benchmarks
+///
+/// Benchmarks for decoding a record batch with 1,000,000 logical float64 values
+/// in runs of 50 as a run-end encoded column and as a plain float64 column.
+///
+/// @{
+
+static ArrowErrorCode MakeRunEndEncodedBatch(bool run_end_encoded, int64_t n_rows,
+                                             int64_t run_length, ArrowSchema* schema,
+                                             ArrowArray* array) {
+  ArrowSchemaInit(schema);
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeStruct(schema, 1));
+  ArrowSchema* values_schema = schema->children[0];
+  if (run_end_encoded) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowSchemaSetTypeRunEndEncoded(schema->children[0], NANOARROW_TYPE_INT32));
+    values_schema = schema->children[0]->children[1];
+  }
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetType(values_schema, NANOARROW_TYPE_DOUBLE));
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(array, schema, nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(array));
+  for (int64_t i = 0; i < n_rows; i++) {
+    double value = static_cast<double>(i / run_length);
+    if (!run_end_encoded) {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendDouble(array->children[0], value));
+    } else if (((i + 1) % run_length) == 0 || (i + 1) == n_rows) {
+      ArrowArray* ree = array->children[0];
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(ree->children[0], i + 1));
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendDouble(ree->children[1], value));
+    }
+  }
+
+  array->children[0]->length = n_rows;
+  array->length = n_rows;
+  return ArrowArrayFinishBuildingDefault(array, nullptr);
+}
+
+static void BaseBenchmarkIpcDecodeRunEndEncoded(bool run_end_encoded,
+                                                benchmark::State& state) {
+  int64_t n_rows = 1000000;
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_THROW_NOT_OK(
+      MakeRunEndEncodedBatch(run_end_encoded, n_rows, 50, schema.get(), array.get()));
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  nanoarrow::UniqueBuffer header;
+  nanoarrow::UniqueBuffer body;
+  if (InitDecodeBatch(schema.get(), array_view.get(), decoder.get(), header.get(),
+                      body.get()) != NANOARROW_OK) {
+    state.SkipWithError("nanoarrow_ipc can't encode or decode this type");
+    return;
+  }
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArray decoded;
+    NANOARROW_THROW_NOT_OK(
+        DecodeBatch(decoder.get(), header.get(), body.get(), decoded.get()));
+    benchmark::DoNotOptimize(decoded->children[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n_rows);
+}
+
+/// \brief Decode 1,000,000 float64 values as a plain float64 column
+static void BenchmarkIpcDecodeFloat64Plain(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeRunEndEncoded(false, state);
+}
+
+/// \brief Decode 1,000,000 float64 values in runs of 50 as a run-end encoded column
+static void BenchmarkIpcDecodeFloat64RunEndEncoded(benchmark::State& state) {
+  BaseBenchmarkIpcDecodeRunEndEncoded(true, state);
+}
+
+BENCHMARK(BenchmarkIpcDecodeFloat64Plain);
+BENCHMARK(BenchmarkIpcDecodeFloat64RunEndEncoded);
+
 /// @}
+
+#endif
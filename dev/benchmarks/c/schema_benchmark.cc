@@ -19,6 +19,8 @@
 
 #include <nanoarrow/nanoarrow.hpp>
 
+#include "generated_fixtures.h"
+
 /// \defgroup nanoarrow-benchmark-schema Schema-related benchmarks
 ///
 /// Benchmarks for producing and consuming ArrowSchema.
@@ -92,5 +94,227 @@ static void BenchmarkSchemaViewInitWideStruct(benchmark::State& state) {
 
 BENCHMARK(BenchmarkSchemaViewInitWideStruct);
 
+/// \brief Benchmark ArrowSchema copying for very wide tables
+///
+/// Copying a schema (e.g., to export it to more than one consumer) is a
+/// common operation and allocates several times per child.
+static void BenchmarkSchemaDeepCopyWideStruct(benchmark::State& state);
+
+static void BenchmarkSchemaDeepCopyWideStruct(benchmark::State& state) {
+  struct ArrowSchema schema;
+  struct ArrowSchema schema_copy;
+
+  int64_t n_columns = 10000;
+  SchemaInitStruct(&schema, n_columns);
+
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(ArrowSchemaDeepCopy(&schema, &schema_copy));
+    ArrowSchemaRelease(&schema_copy);
+  }
+  state.SetItemsProcessed(n_columns * state.iterations());
+
+  ArrowSchemaRelease(&schema);
+}
+
+BENCHMARK(BenchmarkSchemaDeepCopyWideStruct);
+
+/// \brief Benchmark ArrowSchema copying for deeply nested types
+///
+/// Copies a column of 100 nested list<struct<item: ...>> levels, which
+/// exercises the recursive part of the copy rather than the per-child loop.
+static void BenchmarkSchemaDeepCopyDeepNested(benchmark::State& state);
+
+static void BenchmarkSchemaDeepCopyDeepNested(benchmark::State& state) {
+  struct ArrowSchema schema;
+  struct ArrowSchema schema_copy;
+
+  int64_t depth = 100;
+  NANOARROW_THROW_NOT_OK(InitDeepSchema(&schema, depth));
+
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(ArrowSchemaDeepCopy(&schema, &schema_copy));
+    ArrowSchemaRelease(&schema_copy);
+  }
+
+  // The root, the column, and a list and a struct for each level
+  state.SetItemsProcessed((2 + 2 * depth) * state.iterations());
+
+  ArrowSchemaRelease(&schema);
+}
+
+BENCHMARK(BenchmarkSchemaDeepCopyDeepNested);
+
+#if defined(NANOARROW_BENCHMARK_HAS_SCHEMA_COMPACT)
+/// \brief Benchmark compact ArrowSchema copying for very wide tables
+///
+/// ArrowSchemaCompact() produces the same schema as ArrowSchemaDeepCopy()
+/// using a single allocation.
+static void BenchmarkSchemaCompactWideStruct(benchmark::State& state);
+
+static void BenchmarkSchemaCompactWideStruct(benchmark::State& state) {
+  struct ArrowSchema schema;
+  struct ArrowSchema schema_copy;
+
+  int64_t n_columns = 10000;
+  SchemaInitStruct(&schema, n_columns);
+
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(ArrowSchemaCompact(&schema, &schema_copy));
+    ArrowSchemaRelease(&schema_copy);
+  }
+  state.SetItemsProcessed(n_columns * state.iterations());
+
+  ArrowSchemaRelease(&schema);
+}
+
+BENCHMARK(BenchmarkSchemaCompactWideStruct);
+#endif
+
+#if defined(NANOARROW_BENCHMARK_HAS_SCHEMA_HASH)
+/// \brief Benchmark ArrowSchema comparison for very wide tables
+///
+/// Checking an incoming schema against a previously seen one (e.g., to reuse
+/// decoders or array views) compares hashes before walking both trees.
+static void BenchmarkSchemaHashEqualsWideStruct(benchmark::State& state);
+
+static void BenchmarkSchemaHashEqualsWideStruct(benchmark::State& state) {
+  struct ArrowSchema schema;
+  struct ArrowSchema schema_copy;
+
+  int64_t n_columns = 10000;
+  SchemaInitStruct(&schema, n_columns);
+  NANOARROW_THROW_NOT_OK(ArrowSchemaDeepCopy(&schema, &schema_copy));
+
+  for (auto _ : state) {
+    uint64_t hash = ArrowSchemaHash(&schema, NANOARROW_SCHEMA_COMPARE_ALL);
+    benchmark::DoNotOptimize(hash);
+    char equal = ArrowSchemaEquals(&schema, &schema_copy, NANOARROW_SCHEMA_COMPARE_ALL);
+    benchmark::DoNotOptimize(equal);
+  }
+  state.SetItemsProcessed(n_columns * state.iterations());
+
+  ArrowSchemaRelease(&schema_copy);
+  ArrowSchemaRelease(&schema);
+}
+
+BENCHMARK(BenchmarkSchemaHashEqualsWideStruct);
+#endif
+
+/// \brief Benchmark ArrowArrayView creation for very wide tables
+///
+/// Consumers of a stream typically initialize an ArrowArrayView for every
+/// batch, which parses every child of the schema.
+static void BenchmarkArrayViewInitFromSchemaWideStruct(benchmark::State& state);
+
+static void BenchmarkArrayViewInitFromSchemaWideStruct(benchmark::State& state) {
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+
+  int64_t n_columns = 10000;
+  SchemaInitStruct(&schema, n_columns);
+
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(ArrowArrayViewInitFromSchema(&array_view, &schema, nullptr));
+    ArrowArrayViewReset(&array_view);
+  }
+  state.SetItemsProcessed(n_columns * state.iterations());
+
+  ArrowSchemaRelease(&schema);
+}
+
+BENCHMARK(BenchmarkArrayViewInitFromSchemaWideStruct);
+
+#if defined(NANOARROW_BENCHMARK_HAS_SCHEMA_VIEW_TREE)
+/// \brief Benchmark ArrowArrayView creation for very wide tables from a parsed schema
+///
+/// Uses an ArrowSchemaViewTree built once outside the loop such that only the
+/// ArrowArrayView allocation is measured.
+static void BenchmarkArrayViewInitFromSchemaViewTreeWideStruct(benchmark::State& state);
+
+static void BenchmarkArrayViewInitFromSchemaViewTreeWideStruct(benchmark::State& state) {
+  struct ArrowSchema schema;
+  struct ArrowSchemaViewTree tree;
+  struct ArrowArrayView array_view;
+
+  int64_t n_columns = 10000;
+  SchemaInitStruct(&schema, n_columns);
+  NANOARROW_THROW_NOT_OK(ArrowSchemaViewTreeInit(&tree, &schema, nullptr));
+
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(
+        ArrowArrayViewInitFromSchemaViewTree(&array_view, &tree, nullptr));
+    ArrowArrayViewReset(&array_view);
+  }
+  state.SetItemsProcessed(n_columns * state.iterations());
+
+  ArrowSchemaViewTreeReset(&tree);
+  ArrowSchemaRelease(&schema);
+}
+
+BENCHMARK(BenchmarkArrayViewInitFromSchemaViewTreeWideStruct);
+#endif
+
+// Utility to create metadata with n_keys keys where the last key is the
+// extension name
+static void MetadataInitWide(struct ArrowBuffer* metadata, int64_t n_keys) {
+  NANOARROW_THROW_NOT_OK(ArrowMetadataBuilderInit(metadata, nullptr));
+  for (int64_t i = 0; i < (n_keys - 1); i++) {
+    std::string key = "key" + std::to_string(i);
+    NANOARROW_THROW_NOT_OK(ArrowMetadataBuilderAppend(
+        metadata, ArrowCharView(key.c_str()), ArrowCharView("some value")));
+  }
+
+  NANOARROW_THROW_NOT_OK(ArrowMetadataBuilderAppend(
+      metadata, ArrowCharView("ARROW:extension:name"), ArrowCharView("some_ext")));
+}
+
+/// \brief Benchmark metadata lookups using ArrowMetadataGetValue()
+///
+/// Extension type resolution looks up the ARROW:extension:name key in the
+/// metadata of every field.
+static void BenchmarkMetadataGetValue(benchmark::State& state);
+
+static void BenchmarkMetadataGetValue(benchmark::State& state) {
+  nanoarrow::UniqueBuffer metadata;
+  MetadataInitWide(metadata.get(), 20);
+  const char* metadata_data = reinterpret_cast<const char*>(metadata->data);
+
+  struct ArrowStringView value;
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(ArrowMetadataGetValue(
+        metadata_data, ArrowCharView("ARROW:extension:name"), &value));
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+BENCHMARK(BenchmarkMetadataGetValue);
+
+#if defined(NANOARROW_BENCHMARK_HAS_METADATA_INDEX)
+/// \brief Benchmark metadata lookups using an ArrowMetadataIndex
+///
+/// The index is built once outside the loop; only the lookup is measured.
+static void BenchmarkMetadataIndexGetValue(benchmark::State& state);
+
+static void BenchmarkMetadataIndexGetValue(benchmark::State& state) {
+  nanoarrow::UniqueBuffer metadata;
+  MetadataInitWide(metadata.get(), 20);
+  const char* metadata_data = reinterpret_cast<const char*>(metadata->data);
+
+  struct ArrowMetadataIndex index;
+  NANOARROW_THROW_NOT_OK(ArrowMetadataIndexInit(&index, metadata_data));
+
+  struct ArrowStringView value;
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(ArrowMetadataIndexGetValue(
+        &index, ArrowCharView("ARROW:extension:name"), &value));
+    benchmark::DoNotOptimize(value);
+  }
+
+  ArrowMetadataIndexReset(&index);
+}
+
+BENCHMARK(BenchmarkMetadataIndexGetValue);
+#endif
+
 /// @}
 BENCHMARK_MAIN();
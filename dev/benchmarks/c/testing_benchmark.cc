@@ -0,0 +1,308 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <nanoarrow/nanoarrow.hpp>
+#include <nanoarrow/nanoarrow_testing.hpp>
+
+// The number of rows in each batch written to or read from integration testing JSON
+static const int64_t kNumRowsPerBatch = 65536;
+
+// Used to generate string arrays
+static const std::string kAlphabet =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+// Discards output while counting the number of bytes written
+class CountingStreambuf : public std::streambuf {
+ public:
+  CountingStreambuf() : size_bytes_(0) {}
+
+  int64_t size_bytes() const { return size_bytes_; }
+
+ protected:
+  int_type overflow(int_type c) override {
+    size_bytes_++;
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char*, std::streamsize n) override {
+    size_bytes_ += n;
+    return n;
+  }
+
+ private:
+  int64_t size_bytes_;
+};
+
+// Builds a struct<i32: int32, i64: int64, f64: double, str: string> batch
+static ArrowErrorCode MakeTestingBatch(ArrowSchema* schema, ArrowArray* array,
+                                       int64_t num_rows) {
+  nanoarrow::UniqueSchema tmp_schema;
+  ArrowSchemaInit(tmp_schema.get());
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetTypeStruct(tmp_schema.get(), 4));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowSchemaSetType(tmp_schema->children[0], NANOARROW_TYPE_INT32));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(tmp_schema->children[0], "i32"));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowSchemaSetType(tmp_schema->children[1], NANOARROW_TYPE_INT64));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(tmp_schema->children[1], "i64"));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowSchemaSetType(tmp_schema->children[2], NANOARROW_TYPE_DOUBLE));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(tmp_schema->children[2], "f64"));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowSchemaSetType(tmp_schema->children[3], NANOARROW_TYPE_STRING));
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaSetName(tmp_schema->children[3], "str"));
+
+  nanoarrow::UniqueArray tmp_array;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(tmp_array.get(), tmp_schema.get(),
+                                                   nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(tmp_array.get()));
+
+  for (int64_t i = 0; i < num_rows; i++) {
+    if (i % 10 == 0) {
+      for (int64_t j = 0; j < tmp_array->n_children; j++) {
+        NANOARROW_RETURN_NOT_OK(ArrowArrayAppendNull(tmp_array->children[j], 1));
+      }
+    } else {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(tmp_array->children[0], i * 7919));
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayAppendInt(tmp_array->children[1], i * 2147483659LL));
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayAppendDouble(tmp_array->children[2], static_cast<double>(i) / 7));
+
+      ArrowStringView item;
+      item.data = kAlphabet.data() + (i % 26);
+      item.size_bytes = (i % 26) + 1;
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(tmp_array->children[3], item));
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishElement(tmp_array.get()));
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(tmp_array.get(), nullptr));
+
+  ArrowSchemaMove(tmp_schema.get(), schema);
+  ArrowArrayMove(tmp_array.get(), array);
+  return NANOARROW_OK;
+}
+
+// Writes a data file containing copies of the batch from MakeTestingBatch() until
+// the output is at least target_size_bytes long
+static ArrowErrorCode WriteTestingDataFile(std::ostream& out, int64_t target_size_bytes) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  NANOARROW_RETURN_NOT_OK(MakeTestingBatch(schema.get(), array.get(), kNumRowsPerBatch));
+
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+  nanoarrow::testing::TestingJSONWriter writer;
+  out << R"({"schema": )";
+  NANOARROW_RETURN_NOT_OK(writer.WriteSchema(out, schema.get()));
+  out << R"(, "batches": [)";
+
+  int64_t size_bytes = 0;
+  std::string sep;
+  while (size_bytes < target_size_bytes) {
+    std::stringstream batch_json;
+    NANOARROW_RETURN_NOT_OK(writer.WriteBatch(batch_json, schema.get(), array_view.get()));
+    std::string batch_json_str = batch_json.str();
+    out << sep << batch_json_str;
+    sep = ", ";
+    size_bytes += static_cast<int64_t>(batch_json_str.size());
+  }
+
+  out << "]}";
+  return NANOARROW_OK;
+}
+
+// A data file written to a temporary directory (TMPDIR, TEMP, or /tmp) that is
+// removed when the benchmark exits
+class TemporaryDataFile {
+ public:
+  explicit TemporaryDataFile(int64_t size_bytes) {
+    const char* tmp_dir = std::getenv("TMPDIR");
+    if (tmp_dir == nullptr) {
+      tmp_dir = std::getenv("TEMP");
+    }
+    if (tmp_dir == nullptr) {
+      tmp_dir = "/tmp";
+    }
+
+    path_ = std::string(tmp_dir) + "/nanoarrow_benchmark_integration_" +
+            std::to_string(size_bytes) + ".json";
+    std::ofstream out(path_, std::ios::binary);
+    NANOARROW_THROW_NOT_OK(WriteTestingDataFile(out, size_bytes));
+  }
+
+  ~TemporaryDataFile() { std::remove(path_.c_str()); }
+
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+static ArrowErrorCode ReadAllBatches(ArrowArrayStream* stream, int64_t* num_rows) {
+  *num_rows = 0;
+  while (true) {
+    nanoarrow::UniqueArray array;
+    NANOARROW_RETURN_NOT_OK(ArrowArrayStreamGetNext(stream, array.get(), nullptr));
+    if (array->release == nullptr) {
+      break;
+    }
+
+    *num_rows += array->length;
+  }
+
+  return NANOARROW_OK;
+}
+
+/// \defgroup nanoarrow-benchmark-testing Integration testing JSON benchmarks
+///
+/// Benchmarks for reading and writing the integration testing JSON format. Data files
+/// used in integration tests can be several gigabytes and both the time and memory
+/// required to read them are relevant.
+///
+/// @{
+
+/// \brief Use the TestingJSONWriter to write a batch with int32, int64, double, and
+/// string columns
+static void BenchmarkTestingJSONWriteBatch(benchmark::State& state) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  NANOARROW_THROW_NOT_OK(MakeTestingBatch(schema.get(), array.get(), kNumRowsPerBatch));
+
+  nanoarrow::UniqueArrayView array_view;
+  NANOARROW_THROW_NOT_OK(
+      ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr));
+
+  nanoarrow::testing::TestingJSONWriter writer;
+  CountingStreambuf buf;
+  std::ostream out(&buf);
+
+  for (auto _ : state) {
+    NANOARROW_THROW_NOT_OK(writer.WriteBatch(out, schema.get(), array_view.get()));
+  }
+
+  state.SetBytesProcessed(buf.size_bytes());
+  state.SetItemsProcessed(state.iterations() * kNumRowsPerBatch);
+}
+
+/// \brief Use the TestingJSONReader to read a ~10 MB data file that is parsed
+/// completely into memory
+static void BenchmarkTestingJSONReadDataFile(benchmark::State& state) {
+  std::stringstream data_file;
+  NANOARROW_THROW_NOT_OK(WriteTestingDataFile(data_file, 10 * 1024 * 1024));
+  std::string data_file_json = data_file.str();
+
+  nanoarrow::testing::TestingJSONReader reader;
+  int64_t num_rows = 0;
+
+  for (auto _ : state) {
+    nanoarrow::UniqueArrayStream stream;
+    NANOARROW_THROW_NOT_OK(reader.ReadDataFile(data_file_json, stream.get()));
+    NANOARROW_THROW_NOT_OK(ReadAllBatches(stream.get(), &num_rows));
+    benchmark::DoNotOptimize(num_rows);
+  }
+
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(data_file_json.size()));
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK(BenchmarkTestingJSONWriteBatch);
+BENCHMARK(BenchmarkTestingJSONReadDataFile);
+
+#if defined(NANOARROW_BENCHMARK_HAS_TESTING_READ_STREAM)
+/// \brief Use the TestingJSONReader to read the same ~10 MB data file as
+/// BenchmarkTestingJSONReadDataFile one batch at a time
+static void BenchmarkTestingJSONReadDataFileStream(benchmark::State& state) {
+  std::stringstream data_file;
+  NANOARROW_THROW_NOT_OK(WriteTestingDataFile(data_file, 10 * 1024 * 1024));
+  std::string data_file_json = data_file.str();
+
+  nanoarrow::testing::TestingJSONReader reader;
+  int64_t num_rows = 0;
+
+  for (auto _ : state) {
+    std::stringstream data_file_in(data_file_json);
+    nanoarrow::UniqueArrayStream stream;
+    NANOARROW_THROW_NOT_OK(reader.ReadDataFileStream(data_file_in, stream.get()));
+    NANOARROW_THROW_NOT_OK(ReadAllBatches(stream.get(), &num_rows));
+    benchmark::DoNotOptimize(num_rows);
+  }
+
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(data_file_json.size()));
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+/// \brief Use the TestingJSONReader to read a large data file from disk one batch
+/// at a time
+///
+/// This benchmark is only registered if NANOARROW_BENCHMARK_JSON_SIZE_MB is set (e.g.,
+/// to 1024), such that the default benchmark run does not write a file of that size.
+/// The file is written to a temporary directory when the benchmark first runs and is
+/// removed on exit. Reading a file of this size with ReadDataFile() requires many
+/// times its size in memory.
+static void BenchmarkTestingJSONReadDataFileStreamLarge(benchmark::State& state) {
+  static TemporaryDataFile data_file(
+      std::atoll(std::getenv("NANOARROW_BENCHMARK_JSON_SIZE_MB")) * 1024 * 1024);
+  int64_t size_bytes = static_cast<int64_t>(
+      std::ifstream(data_file.path(), std::ios::binary | std::ios::ate).tellg());
+
+  nanoarrow::testing::TestingJSONReader reader;
+  int64_t num_rows = 0;
+
+  for (auto _ : state) {
+    std::ifstream data_file_in(data_file.path(), std::ios::binary);
+    nanoarrow::UniqueArrayStream stream;
+    NANOARROW_THROW_NOT_OK(reader.ReadDataFileStream(data_file_in, stream.get()));
+    NANOARROW_THROW_NOT_OK(ReadAllBatches(stream.get(), &num_rows));
+    benchmark::DoNotOptimize(num_rows);
+  }
+
+  state.SetBytesProcessed(state.iterations() * size_bytes);
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK(BenchmarkTestingJSONReadDataFileStream);
+
+static const bool kLargeBenchmarkRegistered = []() {
+  if (std::getenv("NANOARROW_BENCHMARK_JSON_SIZE_MB") == nullptr) {
+    return false;
+  }
+
+  benchmark::RegisterBenchmark("BenchmarkTestingJSONReadDataFileStreamLarge",
+                               &BenchmarkTestingJSONReadDataFileStreamLarge)
+      ->Unit(benchmark::kSecond);
+  return true;
+}();
+#endif
+
+/// @}
@@ -22,11 +22,15 @@ import pyarrow as pa
 from pyarrow import ipc
 
 
-def write_fixture(schema, batch_generator, fixture_name, fixtures_dir=None):
+def write_fixture(
+    schema, batch_generator, fixture_name, fixtures_dir=None, compression=None
+):
     if fixtures_dir is None:
         fixtures_dir = os.getcwd()
 
-    with ipc.new_stream(os.path.join(fixtures_dir, fixture_name), schema) as out:
+    options = ipc.IpcWriteOptions(compression=compression)
+    path = os.path.join(fixtures_dir, fixture_name)
+    with ipc.new_stream(path, schema, options=options) as out:
         for batch in batch_generator:
             out.write_batch(batch)
 
@@ -38,6 +42,7 @@ def write_fixture_float64(
     batch_size=65536,
     seed=1938,
     fixtures_dir=None,
+    compression=None,
 ):
     """
     Writes a fixture containing random float64 columns in various configurations.
@@ -51,7 +56,13 @@ def write_fixture_float64(
             arrays = [np.array(generator.random(batch_size)) for _ in range(num_cols)]
             yield pa.record_batch(arrays, names=[f"col{i}" for i in range(num_cols)])
 
-    write_fixture(schema, gen_batches(), fixture_name, fixtures_dir=fixtures_dir)
+    write_fixture(
+        schema,
+        gen_batches(),
+        fixture_name,
+        fixtures_dir=fixtures_dir,
+        compression=compression,
+    )
 
 
 if __name__ == "__main__":
@@ -82,3 +93,11 @@ if __name__ == "__main__":
         batch_size=1024,
         fixtures_dir=fixtures_dir,
     )
+    write_fixture_float64(
+        "float64_basic_zstd.arrows",
+        num_cols=10,
+        num_batches=2,
+        batch_size=65536,
+        fixtures_dir=fixtures_dir,
+        compression="zstd",
+    )
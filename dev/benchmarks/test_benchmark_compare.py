@@ -0,0 +1,225 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+import json
+import os
+import re
+import tempfile
+
+import benchmark_compare
+import pytest
+
+
+def write_results(path, times, time_unit="ns"):
+    benchmarks = []
+    for name, values in times.items():
+        for value in values:
+            benchmarks.append(
+                {
+                    "name": name,
+                    "run_name": name,
+                    "run_type": "iteration",
+                    "real_time": value,
+                    "cpu_time": value / 2,
+                    "time_unit": time_unit,
+                }
+            )
+
+        benchmarks.append(
+            {
+                "name": name + "_mean",
+                "run_name": name,
+                "run_type": "aggregate",
+                "aggregate_name": "mean",
+                "real_time": sum(values) / len(values),
+                "cpu_time": sum(values) / len(values),
+                "time_unit": time_unit,
+            }
+        )
+
+    with open(path, "w") as f:
+        json.dump({"context": {}, "benchmarks": benchmarks}, f)
+
+
+def test_load_results():
+    with tempfile.TemporaryDirectory() as tempdir:
+        write_results(os.path.join(tempdir, "a.json"), {"A": [1, 2, 3]})
+        write_results(os.path.join(tempdir, "b.json"), {"B": [1, 2]}, time_unit="ms")
+
+        with open(os.path.join(tempdir, "c.json"), "w") as f:
+            json.dump(
+                {
+                    "benchmarks": [
+                        {
+                            "name": "C",
+                            "run_type": "iteration",
+                            "error_occurred": True,
+                            "real_time": 0,
+                        }
+                    ]
+                },
+                f,
+            )
+
+        open(os.path.join(tempdir, "empty.json"), "w").close()
+
+        results = benchmark_compare.load_results([tempdir])
+        assert results == {"A": [1, 2, 3], "B": [1e6, 2e6]}
+
+        results = benchmark_compare.load_results(
+            [os.path.join(tempdir, "a.json")], metric="cpu_time"
+        )
+        assert results == {"A": [0.5, 1, 1.5]}
+
+
+def test_mann_whitney_u_exact():
+    # Fully separated samples of four: 2 of the 70 orderings are at least as extreme
+    u, p = benchmark_compare.mann_whitney_u([1, 2, 3, 4], [5, 6, 7, 8])
+    assert u == 0
+    assert p == pytest.approx(2 / 70)
+
+    u, p = benchmark_compare.mann_whitney_u([5, 6, 7, 8], [1, 2, 3, 4])
+    assert u == 16
+    assert p == pytest.approx(2 / 70)
+
+    # Three repetitions can never be significant at 0.05
+    _, p = benchmark_compare.mann_whitney_u([1, 2, 3], [4, 5, 6])
+    assert p == pytest.approx(0.1)
+
+    # Interleaved samples are not different
+    _, p = benchmark_compare.mann_whitney_u([1, 3, 5, 7], [2, 4, 6, 8])
+    assert p > 0.5
+
+
+def test_mann_whitney_u_ties():
+    _, p = benchmark_compare.mann_whitney_u([1] * 10, [1] * 10)
+    assert p == 1.0
+
+    _, p = benchmark_compare.mann_whitney_u([1, 1, 2, 2] * 5, [3, 3, 4, 4] * 5)
+    assert p < 0.001
+
+    with pytest.raises(ValueError):
+        benchmark_compare.mann_whitney_u([], [1])
+
+
+def test_parse_thresholds():
+    thresholds = benchmark_compare.parse_thresholds(["Ipc.*=0.1", "a=b=0.2"])
+    assert [(pattern.pattern, value) for pattern, value in thresholds] == [
+        ("Ipc.*", 0.1),
+        ("a=b", 0.2),
+    ]
+
+    with pytest.raises(ValueError):
+        benchmark_compare.parse_thresholds(["0.1"])
+
+
+def test_compare_results():
+    baseline = {
+        "Same": [10, 11, 12, 13, 14],
+        "Slower": [10, 11, 12, 13, 14],
+        "Faster": [10, 11, 12, 13, 14],
+        "SlightlySlower": [10.0, 10.1, 10.2, 10.3, 10.4],
+        "OnlyBaseline": [1],
+    }
+    contender = {
+        "Same": [10.5, 11.5, 12.5, 13.5, 14.5],
+        "Slower": [20, 21, 22, 23, 24],
+        "Faster": [5, 6, 7, 8, 9],
+        "SlightlySlower": [10.5, 10.6, 10.7, 10.8, 10.9],
+    }
+
+    rows = benchmark_compare.compare_results(baseline, contender)
+    status = {row["name"]: row["status"] for row in rows}
+    assert status == {
+        "Faster": "improvement",
+        "Same": "",
+        "SlightlySlower": "",
+        "Slower": "REGRESSION",
+    }
+
+    # A lower threshold for one benchmark flags a smaller (but significant) change
+    overrides = benchmark_compare.parse_thresholds(["^Slightly=0.01"])
+    rows = benchmark_compare.compare_results(baseline, contender, overrides=overrides)
+    status = {row["name"]: row["status"] for row in rows}
+    assert status["SlightlySlower"] == "REGRESSION"
+
+
+def test_main_compare(capsys):
+    with tempfile.TemporaryDirectory() as tempdir:
+        results_dir = os.path.join(tempdir, "results")
+        commits = [("aaaa1111", [10, 11, 12, 13]), ("bbbb2222", [20, 21, 22, 23])]
+        for commit, times in commits:
+            os.makedirs(os.path.join(results_dir, commit))
+            write_results(
+                os.path.join(results_dir, commit, "array_benchmark.json"),
+                {"BenchmarkA": times},
+            )
+
+        args = ["--results-dir", results_dir, "compare"]
+        assert benchmark_compare.main(args + ["aaaa", "bbbb"]) == 1
+        out = capsys.readouterr().out
+        assert "BenchmarkA" in out
+        assert "REGRESSION" in out
+        assert "1 regression(s) in 1 benchmark(s)" in out
+
+        assert benchmark_compare.main(args + ["bbbb", "aaaa"]) == 0
+        assert benchmark_compare.main(args + ["aaaa", "aaaa"]) == 0
+
+        with pytest.raises(ValueError):
+            benchmark_compare.main(args + ["cccc", "aaaa"])
+
+
+def test_main_compare_filter(capsys):
+    with tempfile.TemporaryDirectory() as tempdir:
+        baseline = os.path.join(tempdir, "baseline.json")
+        contender = os.path.join(tempdir, "contender.json")
+        write_results(
+            baseline, {"BenchmarkA": [10, 11, 12, 13], "BenchmarkB": [10, 11, 12, 13]}
+        )
+        write_results(
+            contender,
+            {
+                "BenchmarkA": [10, 11, 12, 13],
+                "BenchmarkB": [20, 21, 22, 23],
+                "BenchmarkNewA": [1, 2, 3, 4],
+            },
+        )
+
+        # Benchmarks that are only in one of the results are reported but not compared
+        assert benchmark_compare.main(["compare", baseline, contender]) == 1
+        captured = capsys.readouterr()
+        assert "1 regression(s) in 2 benchmark(s)" in captured.out
+        assert "1 benchmark(s) only in the contender" in captured.err
+
+        # The filter applies to both the baseline and the contender
+        args = ["compare", baseline, contender, "--filter", "^BenchmarkA$"]
+        assert benchmark_compare.main(args) == 0
+        captured = capsys.readouterr()
+        assert "BenchmarkB" not in captured.out
+        assert "0 regression(s) in 1 benchmark(s)" in captured.out
+        assert "only in the" not in captured.err
+
+        args = ["compare", baseline, contender, "--filter", "A"]
+        assert benchmark_compare.main(args) == 0
+        captured = capsys.readouterr()
+        assert "1 benchmark(s) only in the contender" in captured.err
+
+
+def test_filter_results():
+    results = {"BenchmarkA": [1], "BenchmarkB": [2]}
+    pattern = re.compile("A$")
+    assert benchmark_compare.filter_results(results, pattern) == {"BenchmarkA": [1]}
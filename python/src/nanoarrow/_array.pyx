@@ -36,6 +36,7 @@ from nanoarrow_c cimport (
     ArrowArrayAppendNull,
     ArrowArrayAppendString,
     ArrowArrayBuffer,
+    ArrowArrayDictionaryDecode,
     ArrowArrayFinishBuilding,
     ArrowArrayInitFromSchema,
     ArrowArrayInitFromType,
@@ -295,6 +296,25 @@ cdef class CArrayView:
                 item_view = ArrowArrayViewGetStringUnsafe(self._ptr, i)
                 yield PyUnicode_FromStringAndSize(item_view.data, item_view.size_bytes)
 
+    def _decode_dictionary(self, CSchema dictionary_schema, int64_t offset,
+                           int64_t length) -> CArray:
+        # Decode a slice of a dictionary-encoded array into a new array of the
+        # dictionary's type. The view is copied so that the slice can be applied
+        # without modifying the view shared with other iterators.
+        cdef ArrowArrayView sliced = self._ptr[0]
+        sliced.offset = sliced.offset + offset
+        sliced.length = length
+        sliced.null_count = -1
+
+        cdef ArrowArray* c_array_out
+        base = alloc_c_array(&c_array_out)
+
+        cdef Error error = Error()
+        cdef int code = ArrowArrayDictionaryDecode(&sliced, c_array_out, &error.c_error)
+        error.raise_message_not_ok("ArrowArrayDictionaryDecode()", code)
+
+        return CArray(base, <uintptr_t>c_array_out, dictionary_schema)
+
     def __repr__(self):
         return _repr_utils.array_view_repr(self)
 
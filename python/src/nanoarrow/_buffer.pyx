@@ -53,6 +53,7 @@ from nanoarrow_c cimport (
     ArrowBitmapAppendUnsafe,
     ArrowBuffer,
     ArrowBufferMove,
+    ArrowHalfFloatToFloatN,
 )
 
 from nanoarrow_device_c cimport (
@@ -330,11 +331,13 @@ cdef class CBufferView:
                 f"offset {offset} and length {length} do not describe a valid slice "
                 f"of buffer with length {len(self)}"
             )
-        # memoryview's implementation is very fast but not always possible (half float, fixed-size binary, interval)
-        if _types.one_of(
+        # memoryview's implementation is very fast but not always possible (half float,
+        # fixed-size binary, interval). Half floats are converted in bulk instead.
+        if _types.equal(self._data_type, _types.HALF_FLOAT):
+            return self._iter_half_float(offset, length)
+        elif _types.one_of(
             self._data_type,
             (
-                _types.HALF_FLOAT,
                 _types.INTERVAL_DAY_TIME,
                 _types.INTERVAL_MONTH_DAY_NANO,
                 _types.DECIMAL128,
@@ -350,6 +353,16 @@ cdef class CBufferView:
     def _iter_memoryview(self, int64_t offset, int64_t length):
         return iter(memoryview(self)[offset:(offset + length)])
 
+    def _iter_half_float(self, int64_t offset, int64_t length):
+        # Convert all values to float at once such that memoryview's iterator can
+        # be used
+        out = bytearray(length * sizeof(float))
+        cdef char* out_ptr = out
+        ArrowHalfFloatToFloatN(
+            self._ptr.data.as_uint16 + offset, <float*>out_ptr, length
+        )
+        return iter(memoryview(out).cast("f"))
+
     def _iter_struct(self, int64_t offset, int64_t length):
         for value in iter_unpack(self.format, self):
             if len(value) == 1:
@@ -19,6 +19,7 @@
 
 from nanoarrow_c cimport (
     ArrowLayout,
+    ArrowMetadataIndex,
     ArrowMetadataReader,
     ArrowSchema,
     ArrowSchemaView
@@ -36,8 +37,12 @@ cdef class SchemaMetadata:
     cdef object _base
     cdef const char* _metadata
     cdef ArrowMetadataReader _reader
+    cdef ArrowMetadataIndex _index
+    cdef bint _index_initialized
 
     cdef _init_reader(self)
+    cdef _init_index(self)
+    cdef _find(self, object k)
 
 
 cdef class CSchema:
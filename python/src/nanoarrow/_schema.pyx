@@ -30,6 +30,9 @@ from nanoarrow_c cimport (
     ArrowMalloc,
     ArrowMetadataBuilderAppend,
     ArrowMetadataBuilderInit,
+    ArrowMetadataIndexFind,
+    ArrowMetadataIndexInit,
+    ArrowMetadataIndexReset,
     ArrowMetadataReaderInit,
     ArrowMetadataReaderRead,
     ArrowSchema,
@@ -164,6 +167,11 @@ cdef class SchemaMetadata:
     def __cinit__(self, object base, uintptr_t ptr):
         self._base = base
         self._metadata = <const char*>ptr
+        self._index_initialized = False
+
+    def __dealloc__(self):
+        if self._index_initialized:
+            ArrowMetadataIndexReset(&self._index)
 
     @staticmethod
     def empty():
@@ -174,16 +182,31 @@ cdef class SchemaMetadata:
         cdef int code = ArrowMetadataReaderInit(&self._reader, self._metadata)
         Error.raise_error_not_ok("ArrowMetadataReaderInit()", code)
 
+    cdef _init_index(self):
+        if self._index_initialized:
+            return
+
+        cdef int code = ArrowMetadataIndexInit(&self._index, self._metadata)
+        Error.raise_error_not_ok("ArrowMetadataIndexInit()", code)
+        self._index_initialized = True
+
+    cdef _find(self, object k):
+        # Keys are always bytes, so anything else can't be present
+        if not isinstance(k, bytes):
+            return -1
+
+        self._init_index()
+        cdef ArrowStringView key
+        key.data = PyBytes_AsString(k)
+        key.size_bytes = PyBytes_Size(k)
+        return ArrowMetadataIndexFind(&self._index, key)
+
     def __len__(self):
         self._init_reader()
         return self._reader.remaining_keys
 
     def __contains__(self, item):
-        for key, _ in self.items():
-            if item == key:
-                return True
-
-        return False
+        return self._find(item) != -1
 
     def __getitem__(self, k) -> bytes:
         """Get the value associated with a unique key
@@ -191,19 +214,16 @@ cdef class SchemaMetadata:
         Retrieves the unique value associated with k. Raises KeyError if
         k does not point to exactly one value in the metadata.
         """
-        out = None
-
-        for key, value in self.items():
-            if k == key:
-                if out is None:
-                    out = value
-                else:
-                    raise KeyError(f"key {k} matches more than one value in metadata")
-
-        if out is None:
+        cdef int64_t i = self._find(k)
+        if i == -1:
             raise KeyError(f"Key {k} not found")
 
-        return out
+        # Only check for a repeated key if the metadata contains any
+        if self._index.n_duplicate_keys > 0 and list(self).count(k) > 1:
+            raise KeyError(f"key {k} matches more than one value in metadata")
+
+        cdef ArrowStringView value = self._index.values[i]
+        return PyBytes_FromStringAndSize(value.data, value.size_bytes)
 
     def __iter__(self):
         for key, _ in self.items():
@@ -191,13 +191,6 @@ class PyIterator(ArrayViewBaseIterator):
             map(self._make_child, self._schema.children, self._array_view.children)
         )
 
-        if self._schema.dictionary is None:
-            self._dictionary = None
-        else:
-            self._dictionary = self._make_child(
-                self._schema.dictionary, self._array_view.dictionary
-            )
-
     def _make_child(self, schema, array_view):
         return type(self)(schema, array_view=array_view)
 
@@ -236,11 +229,15 @@ class PyIterator(ArrayViewBaseIterator):
         return factory(offset, length)
 
     def _dictionary_iter(self, offset, length):
-        dictionary = list(
-            self._dictionary._iter_chunk(0, len(self._dictionary._array_view))
+        # Gather the referenced dictionary values in C and iterate over the result
+        # rather than looking up each index in Python
+        decoded = self._array_view._decode_dictionary(
+            self._schema.dictionary, offset, length
+        )
+        decoded_view = CArrayView.from_array(decoded)
+        return self._make_child(self._schema.dictionary, decoded_view)._iter_chunk(
+            0, length
         )
-        for dict_index in self._primitive_iter(offset, length):
-            yield None if dict_index is None else dictionary[dict_index]
 
     def _wrap_iter_nullable(self, validity, items):
         for is_valid, item in zip(validity, items):
@@ -175,6 +175,18 @@ def test_c_buffer_float():
         assert list(buffer) == [0.0, 1.0, 2.0]
 
 
+def test_c_buffer_half_float_elements():
+    values = [0.0, -1.5, 2.0**-24, 65504.0, float("inf"), 0.0999755859375]
+    packed = struct.pack(f"{len(values)}e", *values)
+    buffer = na.c_buffer(packed)._set_format("e")
+    assert buffer.data_type == "half_float"
+
+    assert list(buffer) == values
+    assert list(buffer.elements()) == values
+    assert list(buffer.elements(1, 3)) == values[1:4]
+    assert list(buffer.elements(6, 0)) == []
+
+
 def test_c_buffer_string():
     packed = b"abcdefg"
     buffer = na.c_buffer(packed)._set_format("c")
@@ -65,6 +65,22 @@ def test_schema_metadata():
     assert "b'key1': b'value1'" in repr(schema)
 
 
+def test_schema_metadata_lookup():
+    meta = {"key1": "value1", "key2": "value2"}
+    schema = na.c_schema(na.int32()).modify(metadata=meta)
+
+    assert b"key1" in schema.metadata
+    assert b"key3" not in schema.metadata
+    assert "key1" not in schema.metadata
+    assert schema.metadata[b"key2"] == b"value2"
+    with pytest.raises(KeyError, match="not found"):
+        schema.metadata[b"key3"]
+
+    from nanoarrow._schema import SchemaMetadata
+
+    assert b"key1" not in SchemaMetadata.empty()
+
+
 def test_c_schema_view():
     schema = allocate_c_schema()
     with pytest.raises(RuntimeError):
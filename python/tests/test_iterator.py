@@ -337,6 +337,16 @@ def test_iterator_nullable_dictionary():
     assert list(iter_py(sliced)) == ["cde", "ab", "def", "cde", None]
 
 
+def test_iterator_nested_dictionary():
+    pa = pytest.importorskip("pyarrow")
+
+    items = [["ab", None], None, [], ["cde", "ab", "cde"]]
+    array = pa.array(items, pa.list_(pa.dictionary(pa.int32(), pa.string())))
+
+    assert list(iter_py(array)) == items
+    assert list(iter_py(array[1:])) == items[1:]
+
+
 def test_iterator_decimal():
     pa = pytest.importorskip("pyarrow")
 
@@ -22,6 +22,7 @@
 #include <limits.h>
 
 #include "array.h"
+#include "array_view.h"
 #include "buffer.h"
 #include "nanoarrow.h"
 #include "schema.h"
@@ -317,6 +318,27 @@ SEXP nanoarrow_c_array_set_schema(SEXP array_xptr, SEXP schema_xptr, SEXP valida
   return R_NilValue;
 }
 
+SEXP nanoarrow_c_array_dictionary_decode(SEXP array_xptr, SEXP dictionary_schema_xptr) {
+  // Materialize the dictionary values referenced by each index of a
+  // dictionary-encoded array into a new array of the dictionary's type
+  SEXP array_view_xptr = PROTECT(array_view_xptr_from_array_xptr(array_xptr));
+  struct ArrowArrayView* array_view = array_view_from_xptr(array_view_xptr);
+
+  SEXP result_xptr = PROTECT(nanoarrow_array_owning_xptr());
+  struct ArrowArray* result = nanoarrow_output_array_from_xptr(result_xptr);
+
+  struct ArrowError error;
+  ArrowErrorInit(&error);
+  int code = ArrowArrayDictionaryDecode(array_view, result, &error);
+  if (code != NANOARROW_OK) {
+    Rf_error("ArrowArrayDictionaryDecode(): %s", error.message);
+  }
+
+  array_xptr_set_schema(result_xptr, dictionary_schema_xptr);
+  UNPROTECT(2);
+  return result_xptr;
+}
+
 SEXP nanoarrow_c_infer_schema_array(SEXP array_xptr) {
   SEXP maybe_schema_xptr = R_ExternalPtrTag(array_xptr);
   if (Rf_inherits(maybe_schema_xptr, "nanoarrow_schema")) {
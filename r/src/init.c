@@ -43,6 +43,8 @@ extern SEXP nanoarrow_c_array_set_dictionary(SEXP array_xptr, SEXP dictionary_xp
 extern SEXP nanoarrow_c_array_validate_after_modify(SEXP array_xptr, SEXP schema_xptr);
 extern SEXP nanoarrow_c_array_set_schema(SEXP array_xptr, SEXP schema_xptr,
                                          SEXP validate_sexp);
+extern SEXP nanoarrow_c_array_dictionary_decode(SEXP array_xptr,
+                                                SEXP dictionary_schema_xptr);
 extern SEXP nanoarrow_c_infer_schema_array(SEXP array_xptr);
 extern SEXP nanoarrow_c_array_proxy(SEXP array_xptr, SEXP array_view_xptr,
                                     SEXP recursive_sexp);
@@ -124,6 +126,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"nanoarrow_c_array_validate_after_modify",
      (DL_FUNC)&nanoarrow_c_array_validate_after_modify, 2},
     {"nanoarrow_c_array_set_schema", (DL_FUNC)&nanoarrow_c_array_set_schema, 3},
+    {"nanoarrow_c_array_dictionary_decode",
+     (DL_FUNC)&nanoarrow_c_array_dictionary_decode, 2},
     {"nanoarrow_c_infer_schema_array", (DL_FUNC)&nanoarrow_c_infer_schema_array, 1},
     {"nanoarrow_c_array_proxy", (DL_FUNC)&nanoarrow_c_array_proxy, 3},
     {"nanoarrow_c_as_array_default", (DL_FUNC)&nanoarrow_c_as_array_default, 2},
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "nanoarrow/common/atomic_internal.h"
 #include "nanoarrow/nanoarrow.h"
 
 static void ArrowArrayReleaseInternal(struct ArrowArray* array) {
@@ -330,6 +331,10 @@ void ArrowArraySetValidityBitmap(struct ArrowArray* array, struct ArrowBitmap* b
 
 ArrowErrorCode ArrowArraySetBuffer(struct ArrowArray* array, int64_t i,
                                    struct ArrowBuffer* buffer) {
+  if (ArrowArrayIsShared(array)) {
+    return EINVAL;
+  }
+
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
@@ -430,6 +435,10 @@ static ArrowErrorCode ArrowArrayReserveInternal(struct ArrowArray* array,
 
 ArrowErrorCode ArrowArrayReserve(struct ArrowArray* array,
                                  int64_t additional_size_elements) {
+  if (ArrowArrayIsShared(array)) {
+    return EINVAL;
+  }
+
   struct ArrowArrayView array_view;
   NANOARROW_RETURN_NOT_OK(ArrowArrayViewInitFromArray(&array_view, array));
 
@@ -509,10 +518,16 @@ static void ArrowArrayFlushInternalPointers(struct ArrowArray* array) {
 ArrowErrorCode ArrowArrayFinishBuilding(struct ArrowArray* array,
                                         enum ArrowValidationLevel validation_level,
                                         struct ArrowError* error) {
+  if (ArrowArrayIsShared(array)) {
+    ArrowErrorSet(error, "Can't finish building an array that shares its buffers");
+    return EINVAL;
+  }
+
   // Even if the data buffer is size zero, the pointer value needed to be non-null
   // in some implementations (at least one version of Arrow C++ at the time this
   // was added and C# as later discovered). Only do this fix if we can assume
   // CPU data access.
+  NANOARROW_TRACE_BEGIN(trace_start);
   if (validation_level >= NANOARROW_VALIDATION_LEVEL_DEFAULT) {
     NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayFinalizeBuffers(array), error);
   }
@@ -520,6 +535,7 @@ ArrowErrorCode ArrowArrayFinishBuilding(struct ArrowArray* array,
   // Make sure the value we get with array->buffers[i] is set to the actual
   // pointer (which may have changed from the original due to reallocation)
   ArrowArrayFlushInternalPointers(array);
+  NANOARROW_TRACE_END(NANOARROW_TRACE_ARRAY_FINISH_BUILDING, trace_start, 0);
 
   if (validation_level == NANOARROW_VALIDATION_LEVEL_NONE) {
     return NANOARROW_OK;
@@ -596,32 +612,32 @@ ArrowErrorCode ArrowArrayViewAllocateDictionary(struct ArrowArrayView* array_vie
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
-                                            const struct ArrowSchema* schema,
-                                            struct ArrowError* error) {
-  struct ArrowSchemaView schema_view;
-  int result = ArrowSchemaViewInit(&schema_view, schema, error);
-  if (result != NANOARROW_OK) {
-    return result;
-  }
+static ArrowErrorCode ArrowArrayViewInitFromSchemaViewTreeNode(
+    struct ArrowArrayView* array_view, const struct ArrowSchemaViewTree* tree,
+    int64_t node, struct ArrowError* error) {
+  const struct ArrowSchemaView* schema_view = tree->schema_views + node;
+  const struct ArrowSchema* schema = schema_view->schema;
 
-  ArrowArrayViewInitFromType(array_view, schema_view.storage_type);
-  array_view->layout = schema_view.layout;
+  ArrowArrayViewInitFromType(array_view, schema_view->storage_type);
+  array_view->layout = schema_view->layout;
 
-  result = ArrowArrayViewAllocateChildren(array_view, schema->n_children);
+  int result = ArrowArrayViewAllocateChildren(array_view, schema->n_children);
   if (result != NANOARROW_OK) {
     ArrowErrorSet(error, "ArrowArrayViewAllocateChildren() failed");
     ArrowArrayViewReset(array_view);
     return result;
   }
 
+  int64_t child_node = node + 1;
   for (int64_t i = 0; i < schema->n_children; i++) {
-    result =
-        ArrowArrayViewInitFromSchema(array_view->children[i], schema->children[i], error);
+    result = ArrowArrayViewInitFromSchemaViewTreeNode(array_view->children[i], tree,
+                                                      child_node, error);
     if (result != NANOARROW_OK) {
       ArrowArrayViewReset(array_view);
       return result;
     }
+
+    child_node = tree->subtree_end[child_node];
   }
 
   if (schema->dictionary != NULL) {
@@ -631,8 +647,8 @@ ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
       return result;
     }
 
-    result =
-        ArrowArrayViewInitFromSchema(array_view->dictionary, schema->dictionary, error);
+    result = ArrowArrayViewInitFromSchemaViewTreeNode(array_view->dictionary, tree,
+                                                      child_node, error);
     if (result != NANOARROW_OK) {
       ArrowArrayViewReset(array_view);
       return result;
@@ -647,7 +663,7 @@ ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
     }
 
     memset(array_view->union_type_id_map, -1, 256);
-    int32_t n_type_ids = _ArrowParseUnionTypeIds(schema_view.union_type_ids,
+    int32_t n_type_ids = _ArrowParseUnionTypeIds(schema_view->union_type_ids,
                                                  array_view->union_type_id_map + 128);
     for (int8_t child_index = 0; child_index < n_type_ids; child_index++) {
       int8_t type_id = array_view->union_type_id_map[128 + child_index];
@@ -658,6 +674,27 @@ ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
   return NANOARROW_OK;
 }
 
+ArrowErrorCode ArrowArrayViewInitFromSchemaViewTree(
+    struct ArrowArrayView* array_view, const struct ArrowSchemaViewTree* tree,
+    struct ArrowError* error) {
+  if (tree->n_nodes == 0) {
+    ArrowErrorSet(error, "Expected initialized ArrowSchemaViewTree");
+    return EINVAL;
+  }
+
+  return ArrowArrayViewInitFromSchemaViewTreeNode(array_view, tree, 0, error);
+}
+
+ArrowErrorCode ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
+                                            const struct ArrowSchema* schema,
+                                            struct ArrowError* error) {
+  struct ArrowSchemaViewTree tree;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewTreeInit(&tree, schema, error));
+  int result = ArrowArrayViewInitFromSchemaViewTree(array_view, &tree, error);
+  ArrowSchemaViewTreeReset(&tree);
+  return result;
+}
+
 void ArrowArrayViewReset(struct ArrowArrayView* array_view) {
   if (array_view->children != NULL) {
     for (int64_t i = 0; i < array_view->n_children; i++) {
@@ -845,8 +882,11 @@ static int ArrowArrayViewValidateMinimal(struct ArrowArrayView* array_view,
   int64_t offset_plus_length = array_view->offset + array_view->length;
 
   // Only loop over the first two buffers because the size of the third buffer
-  // is always data dependent for all current Arrow types.
-  for (int i = 0; i < 2; i++) {
+  // is always data dependent for all current Arrow types except the list views
+  // (whose third buffer contains one size per element).
+  int n_sized_buffers =
+      array_view->layout.buffer_type[2] == NANOARROW_BUFFER_TYPE_SIZE ? 3 : 2;
+  for (int i = 0; i < n_sized_buffers; i++) {
     int64_t element_size_bytes = array_view->layout.element_size_bits[i] / 8;
     // Initialize with a value that will cause an error if accidentally used uninitialized
     // Need to suppress the clang-tidy warning because gcc warns for possible use
@@ -1493,9 +1533,9 @@ static int ArrowArrayViewValidateFull(struct ArrowArrayView* array_view,
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowArrayViewValidate(struct ArrowArrayView* array_view,
-                                      enum ArrowValidationLevel validation_level,
-                                      struct ArrowError* error) {
+static ArrowErrorCode ArrowArrayViewValidateInternal(
+    struct ArrowArrayView* array_view, enum ArrowValidationLevel validation_level,
+    struct ArrowError* error) {
   switch (validation_level) {
     case NANOARROW_VALIDATION_LEVEL_NONE:
       return NANOARROW_OK;
@@ -1512,6 +1552,15 @@ ArrowErrorCode ArrowArrayViewValidate(struct ArrowArrayView* array_view,
   return EINVAL;
 }
 
+ArrowErrorCode ArrowArrayViewValidate(struct ArrowArrayView* array_view,
+                                      enum ArrowValidationLevel validation_level,
+                                      struct ArrowError* error) {
+  NANOARROW_TRACE_BEGIN(trace_start);
+  int result = ArrowArrayViewValidateInternal(array_view, validation_level, error);
+  NANOARROW_TRACE_END(NANOARROW_TRACE_ARRAY_VIEW_VALIDATE, trace_start, 0);
+  return result;
+}
+
 struct ArrowComparisonInternalState {
   enum ArrowCompareLevel level;
   int is_equal;
@@ -1641,3 +1690,2314 @@ ArrowErrorCode ArrowArrayViewCompare(const struct ArrowArrayView* actual,
 
 #undef SET_NOT_EQUAL_AND_RETURN_IF
 #undef SET_NOT_EQUAL_AND_RETURN_IF_IMPL
+
+// ArrowArraySlice() shares the buffers of an existing array by moving it into
+// a reference-counted holder (or by adding a reference to the holder of a slice). Each node of a sliced array (including its children
+// and dictionary) holds one reference such that nodes may be moved and released
+// independently of their parent.
+#if NANOARROW_USE_STDATOMIC
+struct ArrowArraySharedHolder {
+  struct ArrowArray array;
+  atomic_long reference_count;
+};
+
+static int64_t ArrowArraySharedHolderUpdate(struct ArrowArraySharedHolder* holder,
+                                            int delta) {
+  int64_t old_count = atomic_fetch_add(&holder->reference_count, delta);
+  return old_count + delta;
+}
+
+static void ArrowArraySharedHolderSet(struct ArrowArraySharedHolder* holder,
+                                      int64_t count) {
+  atomic_store(&holder->reference_count, count);
+}
+#else
+struct ArrowArraySharedHolder {
+  struct ArrowArray array;
+  int64_t reference_count;
+};
+
+static int64_t ArrowArraySharedHolderUpdate(struct ArrowArraySharedHolder* holder,
+                                            int delta) {
+  holder->reference_count += delta;
+  return holder->reference_count;
+}
+
+static void ArrowArraySharedHolderSet(struct ArrowArraySharedHolder* holder,
+                                      int64_t count) {
+  holder->reference_count = count;
+}
+#endif
+
+struct ArrowArraySharedPrivate {
+  struct ArrowArraySharedHolder* holder;
+  const void** buffers;
+};
+
+static void ArrowArraySharedRelease(struct ArrowArray* array) {
+  struct ArrowArraySharedPrivate* private_data =
+      (struct ArrowArraySharedPrivate*)array->private_data;
+
+  if (array->children != NULL) {
+    for (int64_t i = 0; i < array->n_children; i++) {
+      if (array->children[i] != NULL) {
+        if (array->children[i]->release != NULL) {
+          ArrowArrayRelease(array->children[i]);
+        }
+
+        ArrowFree(array->children[i]);
+      }
+    }
+
+    ArrowFree(array->children);
+  }
+
+  if (array->dictionary != NULL) {
+    if (array->dictionary->release != NULL) {
+      ArrowArrayRelease(array->dictionary);
+    }
+
+    ArrowFree(array->dictionary);
+  }
+
+  if (ArrowArraySharedHolderUpdate(private_data->holder, -1) == 0) {
+    ArrowArrayRelease(&private_data->holder->array);
+    ArrowFree(private_data->holder);
+  }
+
+  ArrowFree(private_data->buffers);
+  ArrowFree(private_data);
+  array->release = NULL;
+}
+
+// Populate out with a shallow copy of src whose buffers are kept alive by holder
+static ArrowErrorCode ArrowArraySharedShallowCopy(struct ArrowArraySharedHolder* holder,
+                                                  const struct ArrowArray* src,
+                                                  struct ArrowArray* out) {
+  struct ArrowArraySharedPrivate* private_data =
+      (struct ArrowArraySharedPrivate*)ArrowMalloc(
+          sizeof(struct ArrowArraySharedPrivate));
+  if (private_data == NULL) {
+    return ENOMEM;
+  }
+
+  private_data->holder = holder;
+  private_data->buffers = NULL;
+  ArrowArraySharedHolderUpdate(holder, 1);
+
+  out->length = src->length;
+  out->null_count = src->null_count;
+  out->offset = src->offset;
+  out->n_buffers = src->n_buffers;
+  out->n_children = 0;
+  out->buffers = NULL;
+  out->children = NULL;
+  out->dictionary = NULL;
+  out->release = &ArrowArraySharedRelease;
+  out->private_data = private_data;
+
+  if (src->n_buffers > 0) {
+    private_data->buffers =
+        (const void**)ArrowMalloc(sizeof(const void*) * src->n_buffers);
+    if (private_data->buffers == NULL) {
+      ArrowArrayRelease(out);
+      return ENOMEM;
+    }
+
+    memcpy(private_data->buffers, src->buffers, sizeof(const void*) * src->n_buffers);
+    out->buffers = private_data->buffers;
+  }
+
+  if (src->n_children > 0) {
+    out->children =
+        (struct ArrowArray**)ArrowMalloc(sizeof(struct ArrowArray*) * src->n_children);
+    if (out->children == NULL) {
+      ArrowArrayRelease(out);
+      return ENOMEM;
+    }
+
+    out->n_children = src->n_children;
+    memset(out->children, 0, sizeof(struct ArrowArray*) * src->n_children);
+
+    for (int64_t i = 0; i < src->n_children; i++) {
+      out->children[i] = (struct ArrowArray*)ArrowMalloc(sizeof(struct ArrowArray));
+      if (out->children[i] == NULL) {
+        ArrowArrayRelease(out);
+        return ENOMEM;
+      }
+
+      out->children[i]->release = NULL;
+      int result =
+          ArrowArraySharedShallowCopy(holder, src->children[i], out->children[i]);
+      if (result != NANOARROW_OK) {
+        ArrowArrayRelease(out);
+        return result;
+      }
+    }
+  }
+
+  if (src->dictionary != NULL) {
+    out->dictionary = (struct ArrowArray*)ArrowMalloc(sizeof(struct ArrowArray));
+    if (out->dictionary == NULL) {
+      ArrowArrayRelease(out);
+      return ENOMEM;
+    }
+
+    out->dictionary->release = NULL;
+    int result = ArrowArraySharedShallowCopy(holder, src->dictionary, out->dictionary);
+    if (result != NANOARROW_OK) {
+      ArrowArrayRelease(out);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArraySlice(struct ArrowArray* src, int64_t offset, int64_t length,
+                               struct ArrowArray* out) {
+  NANOARROW_DCHECK(src != NULL && src->release != NULL);
+  NANOARROW_DCHECK(out != NULL);
+
+  if (offset < 0 || length < 0 || offset > src->length ||
+      length > (src->length - offset)) {
+    return EINVAL;
+  }
+
+  // If src already shares its buffers, out takes another reference to its holder and
+  // src is left untouched
+  if (src->release == &ArrowArraySharedRelease) {
+    struct ArrowArraySharedPrivate* private_data =
+        (struct ArrowArraySharedPrivate*)src->private_data;
+    NANOARROW_RETURN_NOT_OK(ArrowArraySharedShallowCopy(private_data->holder, src, out));
+  } else {
+    // Otherwise, src is moved into a holder that only out (and anything sliced from
+    // it) refers to. The extra reference held while doing so ensures that a failed
+    // copy does not release the original array, which is moved back into src.
+    struct ArrowArraySharedHolder* holder =
+        (struct ArrowArraySharedHolder*)ArrowMalloc(
+            sizeof(struct ArrowArraySharedHolder));
+    if (holder == NULL) {
+      return ENOMEM;
+    }
+
+    ArrowArraySharedHolderSet(holder, 1);
+    ArrowArrayMove(src, &holder->array);
+    int result = ArrowArraySharedShallowCopy(holder, &holder->array, out);
+    if (result != NANOARROW_OK) {
+      ArrowArrayMove(&holder->array, src);
+      ArrowFree(holder);
+      return result;
+    }
+
+    ArrowArraySharedHolderUpdate(holder, -1);
+    src = &holder->array;
+  }
+
+  out->offset = src->offset + offset;
+  out->length = length;
+  if (length == 0) {
+    out->null_count = 0;
+  } else if (src->null_count != 0 && length != src->length) {
+    out->null_count = -1;
+  }
+
+  return NANOARROW_OK;
+}
+
+int8_t ArrowArrayIsShared(const struct ArrowArray* array) {
+  return array->release == &ArrowArraySharedRelease;
+}
+
+// A contiguous range of elements [start, start + length) of an ArrowArrayView.
+// start is relative to (i.e., does not include) array_view->offset.
+struct ArrowArrayConcatSegment {
+  const struct ArrowArrayView* array_view;
+  int64_t start;
+  int64_t length;
+};
+
+// Copy length bits from src starting at src_offset to dst starting at dst_offset
+static void ArrowArrayConcatBits(const uint8_t* src, int64_t src_offset, int64_t length,
+                                 uint8_t* dst, int64_t dst_offset) {
+  // Leading bits until the destination is byte-aligned
+  while (length > 0 && (dst_offset % 8) != 0) {
+    ArrowBitSetTo(dst, dst_offset++, ArrowBitGet(src, src_offset++));
+    length--;
+  }
+
+  // Whole bytes
+  const int64_t n_bytes = length / 8;
+  const uint8_t* src_bytes = src + (src_offset / 8);
+  uint8_t* dst_bytes = dst + (dst_offset / 8);
+  const int shift = (int)(src_offset % 8);
+  if (shift == 0) {
+    if (n_bytes > 0) {
+      memcpy(dst_bytes, src_bytes, (size_t)n_bytes);
+    }
+  } else {
+    for (int64_t i = 0; i < n_bytes; i++) {
+      dst_bytes[i] =
+          (uint8_t)((src_bytes[i] >> shift) | (src_bytes[i + 1] << (8 - shift)));
+    }
+  }
+
+  src_offset += n_bytes * 8;
+  dst_offset += n_bytes * 8;
+  length -= n_bytes * 8;
+
+  // Trailing bits
+  while (length > 0) {
+    ArrowBitSetTo(dst, dst_offset++, ArrowBitGet(src, src_offset++));
+    length--;
+  }
+}
+
+static ArrowErrorCode ArrowArrayConcatValidity(struct ArrowArray* array,
+                                               const struct ArrowArrayConcatSegment* segs,
+                                               int64_t n_segs, int64_t length) {
+  int has_nulls = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    if (segs[i].length > 0 && array_view->null_count != 0 &&
+        array_view->buffer_views[0].data.data != NULL) {
+      has_nulls = 1;
+      break;
+    }
+  }
+
+  if (!has_nulls) {
+    array->null_count = 0;
+    return NANOARROW_OK;
+  }
+
+  struct ArrowBitmap* bitmap = ArrowArrayValidityBitmap(array);
+  NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap, length));
+  ArrowBitmapAppendUnsafe(bitmap, 0, length);
+
+  int64_t dst_offset = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+    if (validity == NULL) {
+      ArrowBitsSetTo(bitmap->buffer.data, dst_offset, segs[i].length, 1);
+    } else {
+      ArrowArrayConcatBits(validity, array_view->offset + segs[i].start, segs[i].length,
+                           bitmap->buffer.data, dst_offset);
+    }
+
+    dst_offset += segs[i].length;
+  }
+
+  array->null_count = length - ArrowBitCountSet(bitmap->buffer.data, 0, length);
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayConcatFixedWidth(
+    struct ArrowBuffer* buffer, const struct ArrowArrayConcatSegment* segs,
+    int64_t n_segs, int buffer_i, int64_t bytes_per_element, int64_t length) {
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, length * bytes_per_element));
+  for (int64_t i = 0; i < n_segs; i++) {
+    if (segs[i].length == 0) {
+      continue;
+    }
+
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    const uint8_t* data = array_view->buffer_views[buffer_i].data.as_uint8 +
+                          (array_view->offset + segs[i].start) * bytes_per_element;
+    ArrowBufferAppendUnsafe(buffer, data, segs[i].length * bytes_per_element);
+  }
+
+  return NANOARROW_OK;
+}
+
+// Append rebased offsets to array's offset buffer. The range of the child (or data
+// buffer) referenced by each segment is placed in child_segs.
+static ArrowErrorCode ArrowArrayConcatOffsets(struct ArrowArray* array,
+                                              const struct ArrowArrayConcatSegment* segs,
+                                              int64_t n_segs, int64_t length,
+                                              struct ArrowArrayConcatSegment* child_segs,
+                                              struct ArrowError* error) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  const int is_large = private_data->layout.element_size_bits[1] == 64;
+
+  int64_t child_length = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    int64_t first = 0;
+    int64_t last = 0;
+    if (segs[i].length > 0) {
+      const int64_t j = array_view->offset + segs[i].start;
+      if (is_large) {
+        first = array_view->buffer_views[1].data.as_int64[j];
+        last = array_view->buffer_views[1].data.as_int64[j + segs[i].length];
+      } else {
+        first = array_view->buffer_views[1].data.as_int32[j];
+        last = array_view->buffer_views[1].data.as_int32[j + segs[i].length];
+      }
+    }
+
+    child_segs[i].array_view = array_view;
+    child_segs[i].start = first;
+    child_segs[i].length = last - first;
+    child_length += last - first;
+  }
+
+  if (!is_large && child_length > INT32_MAX) {
+    ArrowErrorSet(error,
+                  "Concatenated array would require %" PRId64
+                  " elements or bytes but 32-bit offsets support at most %d",
+                  child_length, (int)INT32_MAX);
+    return EOVERFLOW;
+  }
+
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  int64_t offset_size = is_large ? (int64_t)sizeof(int64_t) : (int64_t)sizeof(int32_t);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offsets, (length + 1) * offset_size));
+
+  int64_t base = 0;
+  if (is_large) {
+    ArrowBufferAppendUnsafe(offsets, &base, sizeof(int64_t));
+  } else {
+    int32_t zero = 0;
+    ArrowBufferAppendUnsafe(offsets, &zero, sizeof(int32_t));
+  }
+
+  for (int64_t i = 0; i < n_segs; i++) {
+    if (segs[i].length == 0) {
+      continue;
+    }
+
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    const int64_t j = array_view->offset + segs[i].start;
+    const int64_t delta = base - child_segs[i].start;
+    if (is_large) {
+      const int64_t* src = array_view->buffer_views[1].data.as_int64 + j + 1;
+      int64_t* dst = (int64_t*)(offsets->data + offsets->size_bytes);
+      for (int64_t k = 0; k < segs[i].length; k++) {
+        dst[k] = src[k] + delta;
+      }
+    } else {
+      const int32_t* src = array_view->buffer_views[1].data.as_int32 + j + 1;
+      int32_t* dst = (int32_t*)(offsets->data + offsets->size_bytes);
+      for (int64_t k = 0; k < segs[i].length; k++) {
+        dst[k] = (int32_t)(src[k] + delta);
+      }
+    }
+
+    offsets->size_bytes += segs[i].length * offset_size;
+    base += child_segs[i].length;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayConcatListView(struct ArrowArray* array,
+                                               const struct ArrowArrayConcatSegment* segs,
+                                               int64_t n_segs, int64_t length,
+                                               struct ArrowArrayConcatSegment* child_segs,
+                                               struct ArrowError* error) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  const int is_large = private_data->layout.element_size_bits[1] == 64;
+
+  // Each segment references the range of the child spanned by its non-empty views
+  int64_t child_length = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    const int64_t j0 = array_view->offset + segs[i].start;
+    int64_t min_offset = INT64_MAX;
+    int64_t max_end = 0;
+    for (int64_t j = j0; j < (j0 + segs[i].length); j++) {
+      int64_t offset;
+      int64_t size;
+      if (is_large) {
+        offset = array_view->buffer_views[1].data.as_int64[j];
+        size = array_view->buffer_views[2].data.as_int64[j];
+      } else {
+        offset = array_view->buffer_views[1].data.as_int32[j];
+        size = array_view->buffer_views[2].data.as_int32[j];
+      }
+
+      if (size > 0) {
+        min_offset = offset < min_offset ? offset : min_offset;
+        max_end = (offset + size) > max_end ? (offset + size) : max_end;
+      }
+    }
+
+    child_segs[i].array_view = array_view;
+    if (max_end == 0) {
+      child_segs[i].start = 0;
+      child_segs[i].length = 0;
+    } else {
+      child_segs[i].start = min_offset;
+      child_segs[i].length = max_end - min_offset;
+    }
+
+    child_length += child_segs[i].length;
+  }
+
+  if (!is_large && child_length > INT32_MAX) {
+    ArrowErrorSet(error,
+                  "Concatenated array would require %" PRId64
+                  " child elements but 32-bit offsets support at most %d",
+                  child_length, (int)INT32_MAX);
+    return EOVERFLOW;
+  }
+
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  struct ArrowBuffer* sizes = ArrowArrayBuffer(array, 2);
+  const int64_t offset_size =
+      is_large ? (int64_t)sizeof(int64_t) : (int64_t)sizeof(int32_t);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offsets, length * offset_size));
+
+  // Offsets of empty views are clamped to the segment's child range
+  int64_t base = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    const int64_t j0 = array_view->offset + segs[i].start;
+    const int64_t delta = base - child_segs[i].start;
+    const int64_t end = base + child_segs[i].length;
+    for (int64_t j = j0; j < (j0 + segs[i].length); j++) {
+      int64_t offset;
+      if (is_large) {
+        offset = array_view->buffer_views[1].data.as_int64[j] + delta;
+      } else {
+        offset = array_view->buffer_views[1].data.as_int32[j] + delta;
+      }
+
+      offset = offset < base ? base : (offset > end ? end : offset);
+      if (is_large) {
+        ArrowBufferAppendUnsafe(offsets, &offset, sizeof(int64_t));
+      } else {
+        int32_t offset32 = (int32_t)offset;
+        ArrowBufferAppendUnsafe(offsets, &offset32, sizeof(int32_t));
+      }
+    }
+
+    base += child_segs[i].length;
+  }
+
+  return ArrowArrayConcatFixedWidth(sizes, segs, n_segs, 2, offset_size, length);
+}
+
+static ArrowErrorCode ArrowArrayConcatBinaryView(
+    struct ArrowArray* array, const struct ArrowArrayConcatSegment* segs, int64_t n_segs,
+    int64_t length) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  // Data buffers are copied whole. Views that refer to them are rebased
+  // according to the number of data buffers contributed by previous segments.
+  int64_t n_variadic_buffers = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    if (segs[i].length > 0) {
+      n_variadic_buffers += segs[i].array_view->n_variadic_buffers;
+    }
+  }
+
+  if (n_variadic_buffers > INT32_MAX) {
+    return EOVERFLOW;
+  }
+
+  if (n_variadic_buffers > 0) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayAddVariadicBuffers(array, (int32_t)n_variadic_buffers));
+  }
+
+  struct ArrowBuffer* views = ArrowArrayBuffer(array, 1);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(views, length * (int64_t)sizeof(union ArrowBinaryView)));
+
+  int32_t buffer_base = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    if (segs[i].length == 0) {
+      continue;
+    }
+
+    const union ArrowBinaryView* src =
+        array_view->buffer_views[1].data.as_binary_view + array_view->offset +
+        segs[i].start;
+    union ArrowBinaryView* dst =
+        (union ArrowBinaryView*)(views->data + views->size_bytes);
+    memcpy(dst, src, segs[i].length * sizeof(union ArrowBinaryView));
+    if (buffer_base > 0) {
+      for (int64_t k = 0; k < segs[i].length; k++) {
+        if (dst[k].inlined.size > NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+          dst[k].ref.buffer_index += buffer_base;
+        }
+      }
+    }
+
+    views->size_bytes += segs[i].length * (int64_t)sizeof(union ArrowBinaryView);
+
+    for (int32_t k = 0; k < array_view->n_variadic_buffers; k++) {
+      int64_t size_bytes = array_view->variadic_buffer_sizes[k];
+      if (size_bytes > 0) {
+        NANOARROW_RETURN_NOT_OK(
+            ArrowBufferAppend(&private_data->variadic_buffers[buffer_base + k],
+                              array_view->variadic_buffers[k], size_bytes));
+      }
+
+      private_data->variadic_buffer_sizes[buffer_base + k] = size_bytes;
+    }
+
+    buffer_base += array_view->n_variadic_buffers;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayConcatDenseUnionOffsets(
+    struct ArrowArray* array, const struct ArrowArrayConcatSegment* segs, int64_t n_segs,
+    int64_t length, struct ArrowArrayConcatSegment* child_segs,
+    struct ArrowError* error) {
+  const int64_t n_children = array->n_children;
+
+  // child_segs is laid out as n_children runs of n_segs segments
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    for (int64_t c = 0; c < n_children; c++) {
+      child_segs[c * n_segs + i].array_view = array_view->children[c];
+      child_segs[c * n_segs + i].start = INT64_MAX;
+      child_segs[c * n_segs + i].length = 0;
+    }
+
+    for (int64_t j = segs[i].start; j < (segs[i].start + segs[i].length); j++) {
+      int64_t c = ArrowArrayViewUnionChildIndex(array_view, j);
+      int64_t offset = ArrowArrayViewUnionChildOffset(array_view, j);
+      struct ArrowArrayConcatSegment* child_seg = child_segs + c * n_segs + i;
+      int64_t end = child_seg->length == 0 ? 0 : child_seg->start + child_seg->length;
+      child_seg->start = offset < child_seg->start ? offset : child_seg->start;
+      end = (offset + 1) > end ? (offset + 1) : end;
+      child_seg->length = end - child_seg->start;
+    }
+  }
+
+  int64_t bases[128];
+  for (int64_t c = 0; c < n_children; c++) {
+    bases[c] = 0;
+    for (int64_t i = 0; i < n_segs; i++) {
+      if (child_segs[c * n_segs + i].length == 0) {
+        child_segs[c * n_segs + i].start = 0;
+      }
+
+      bases[c] += child_segs[c * n_segs + i].length;
+    }
+
+    if (bases[c] > INT32_MAX) {
+      ArrowErrorSet(error,
+                    "Concatenated dense union child %" PRId64 " would require %" PRId64
+                    " elements but 32-bit offsets support at most %d",
+                    c, bases[c], (int)INT32_MAX);
+      return EOVERFLOW;
+    }
+
+    bases[c] = 0;
+  }
+
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offsets, length * (int64_t)sizeof(int32_t)));
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* array_view = segs[i].array_view;
+    for (int64_t j = segs[i].start; j < (segs[i].start + segs[i].length); j++) {
+      int64_t c = ArrowArrayViewUnionChildIndex(array_view, j);
+      int32_t offset = (int32_t)(ArrowArrayViewUnionChildOffset(array_view, j) -
+                                 child_segs[c * n_segs + i].start + bases[c]);
+      ArrowBufferAppendUnsafe(offsets, &offset, sizeof(int32_t));
+    }
+
+    for (int64_t c = 0; c < n_children; c++) {
+      bases[c] += child_segs[c * n_segs + i].length;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayConcatInternal(struct ArrowArray* array,
+                                               const struct ArrowArrayConcatSegment* segs,
+                                               int64_t n_segs, struct ArrowError* error);
+
+static ArrowErrorCode ArrowArrayConcatRunEndEncoded(
+    struct ArrowArray* array, const struct ArrowArrayConcatSegment* segs, int64_t n_segs,
+    int64_t length, struct ArrowArrayConcatSegment* child_segs,
+    struct ArrowError* error) {
+  struct ArrowArray* run_ends = array->children[0];
+  struct ArrowArrayPrivateData* run_ends_private =
+      (struct ArrowArrayPrivateData*)run_ends->private_data;
+
+  int64_t max_length;
+  switch (run_ends_private->storage_type) {
+    case NANOARROW_TYPE_INT16:
+      max_length = INT16_MAX;
+      break;
+    case NANOARROW_TYPE_INT32:
+      max_length = INT32_MAX;
+      break;
+    default:
+      max_length = INT64_MAX;
+      break;
+  }
+
+  if (length > max_length) {
+    ArrowErrorSet(error,
+                  "Concatenated run-end encoded array of length %" PRId64
+                  " exceeds the maximum run end of %" PRId64,
+                  length, max_length);
+    return EOVERFLOW;
+  }
+
+  // Locate the runs that span each segment with a binary search over the run ends
+  int64_t n_runs = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* run_ends_view = segs[i].array_view->children[0];
+    child_segs[i].array_view = segs[i].array_view->children[1];
+    child_segs[i].start = 0;
+    child_segs[i].length = 0;
+    if (segs[i].length == 0) {
+      continue;
+    }
+
+    const int64_t first = segs[i].array_view->offset + segs[i].start;
+    int64_t lo = 0;
+    int64_t hi = run_ends_view->length;
+    while (lo < hi) {
+      int64_t mid = lo + (hi - lo) / 2;
+      if (ArrowArrayViewGetIntUnsafe(run_ends_view, mid) > first) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+
+    const int64_t first_run = lo;
+    const int64_t last = first + segs[i].length;
+    hi = run_ends_view->length;
+    while (lo < hi) {
+      int64_t mid = lo + (hi - lo) / 2;
+      if (ArrowArrayViewGetIntUnsafe(run_ends_view, mid) >= last) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+
+    child_segs[i].start = first_run;
+    child_segs[i].length = lo - first_run + 1;
+    n_runs += child_segs[i].length;
+  }
+
+  struct ArrowBuffer* run_ends_data = ArrowArrayBuffer(run_ends, 1);
+  const int64_t run_end_size = run_ends_private->layout.element_size_bits[1] / 8;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(run_ends_data, n_runs * run_end_size));
+
+  int64_t base = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    const struct ArrowArrayView* run_ends_view = segs[i].array_view->children[0];
+    const int64_t first = segs[i].array_view->offset + segs[i].start;
+    const int64_t last = first + segs[i].length;
+    for (int64_t r = child_segs[i].start;
+         r < (child_segs[i].start + child_segs[i].length); r++) {
+      int64_t run_end = ArrowArrayViewGetIntUnsafe(run_ends_view, r);
+      run_end = (run_end < last ? run_end : last) - first + base;
+      switch (run_end_size) {
+        case 2: {
+          int16_t value = (int16_t)run_end;
+          ArrowBufferAppendUnsafe(run_ends_data, &value, sizeof(int16_t));
+          break;
+        }
+        case 4: {
+          int32_t value = (int32_t)run_end;
+          ArrowBufferAppendUnsafe(run_ends_data, &value, sizeof(int32_t));
+          break;
+        }
+        default:
+          ArrowBufferAppendUnsafe(run_ends_data, &run_end, sizeof(int64_t));
+          break;
+      }
+    }
+
+    base += segs[i].length;
+  }
+
+  run_ends->length = n_runs;
+  run_ends->null_count = 0;
+  return ArrowArrayConcatInternal(array->children[1], child_segs, n_segs, error);
+}
+
+// Add the cumulative length of previous dictionaries to each segment's indices
+static ArrowErrorCode ArrowArrayConcatDictionaryIndices(
+    struct ArrowArray* array, const struct ArrowArrayConcatSegment* segs, int64_t n_segs,
+    struct ArrowError* error) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  int64_t max_index;
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_INT8:
+      max_index = INT8_MAX;
+      break;
+    case NANOARROW_TYPE_UINT8:
+      max_index = UINT8_MAX;
+      break;
+    case NANOARROW_TYPE_INT16:
+      max_index = INT16_MAX;
+      break;
+    case NANOARROW_TYPE_UINT16:
+      max_index = UINT16_MAX;
+      break;
+    case NANOARROW_TYPE_INT32:
+      max_index = INT32_MAX;
+      break;
+    case NANOARROW_TYPE_UINT32:
+      max_index = UINT32_MAX;
+      break;
+    default:
+      max_index = INT64_MAX;
+      break;
+  }
+
+  int64_t dictionary_length = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    dictionary_length += segs[i].array_view->dictionary->length;
+  }
+
+  if (dictionary_length > 0 && (dictionary_length - 1) > max_index) {
+    ArrowErrorSet(error,
+                  "Concatenated dictionary of length %" PRId64
+                  " can't be indexed by an index type with maximum value %" PRId64,
+                  dictionary_length, max_index);
+    return EOVERFLOW;
+  }
+
+  uint8_t* data = ArrowArrayBuffer(array, 1)->data;
+  int64_t base = 0;
+  int64_t j = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    for (int64_t k = 0; k < segs[i].length; k++, j++) {
+      switch (private_data->storage_type) {
+        case NANOARROW_TYPE_INT8:
+          ((int8_t*)data)[j] = (int8_t)(((int8_t*)data)[j] + base);
+          break;
+        case NANOARROW_TYPE_UINT8:
+          data[j] = (uint8_t)(data[j] + base);
+          break;
+        case NANOARROW_TYPE_INT16:
+          ((int16_t*)data)[j] = (int16_t)(((int16_t*)data)[j] + base);
+          break;
+        case NANOARROW_TYPE_UINT16:
+          ((uint16_t*)data)[j] = (uint16_t)(((uint16_t*)data)[j] + base);
+          break;
+        case NANOARROW_TYPE_INT32:
+          ((int32_t*)data)[j] = (int32_t)(((int32_t*)data)[j] + base);
+          break;
+        case NANOARROW_TYPE_UINT32:
+          ((uint32_t*)data)[j] = (uint32_t)(((uint32_t*)data)[j] + base);
+          break;
+        case NANOARROW_TYPE_INT64:
+          ((int64_t*)data)[j] += base;
+          break;
+        case NANOARROW_TYPE_UINT64:
+          ((uint64_t*)data)[j] += (uint64_t)base;
+          break;
+        default:
+          return EINVAL;
+      }
+    }
+
+    base += segs[i].array_view->dictionary->length;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayConcatInternal(struct ArrowArray* array,
+                                               const struct ArrowArrayConcatSegment* segs,
+                                               int64_t n_segs, struct ArrowError* error) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  int64_t length = 0;
+  for (int64_t i = 0; i < n_segs; i++) {
+    length += segs[i].length;
+  }
+
+  if (private_data->layout.buffer_type[0] == NANOARROW_BUFFER_TYPE_VALIDITY) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayConcatValidity(array, segs, n_segs, length));
+  } else {
+    array->null_count = 0;
+  }
+
+  // Segments for the children (or, for binary types, the data buffer)
+  int64_t n_child_segs = n_segs;
+  if (array->n_children > 1) {
+    n_child_segs *= array->n_children;
+  }
+
+  struct ArrowArrayConcatSegment* child_segs = NULL;
+  if (n_child_segs > 0) {
+    child_segs = (struct ArrowArrayConcatSegment*)ArrowMalloc(
+        sizeof(struct ArrowArrayConcatSegment) * n_child_segs);
+    if (child_segs == NULL) {
+      return ENOMEM;
+    }
+  }
+
+  int result = NANOARROW_OK;
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_NA:
+      array->null_count = length;
+      break;
+
+    case NANOARROW_TYPE_BOOL: {
+      struct ArrowBuffer* data = ArrowArrayBuffer(array, 1);
+      result = ArrowBufferAppendFill(data, 0, _ArrowBytesForBits(length));
+      if (result != NANOARROW_OK) {
+        break;
+      }
+
+      int64_t dst_offset = 0;
+      for (int64_t i = 0; i < n_segs; i++) {
+        const struct ArrowArrayView* array_view = segs[i].array_view;
+        if (segs[i].length > 0) {
+          ArrowArrayConcatBits(array_view->buffer_views[1].data.as_uint8,
+                               array_view->offset + segs[i].start, segs[i].length,
+                               data->data, dst_offset);
+        }
+        dst_offset += segs[i].length;
+      }
+      break;
+    }
+
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY: {
+      result = ArrowArrayConcatOffsets(array, segs, n_segs, length, child_segs, error);
+      if (result != NANOARROW_OK) {
+        break;
+      }
+
+      // child_segs contains byte ranges of the data buffer, which are relative to
+      // the start of the buffer and not the array offset
+      struct ArrowBuffer* data = ArrowArrayBuffer(array, 2);
+      int64_t n_bytes = 0;
+      for (int64_t i = 0; i < n_segs; i++) {
+        n_bytes += child_segs[i].length;
+      }
+
+      result = ArrowBufferReserve(data, n_bytes);
+      if (result != NANOARROW_OK) {
+        break;
+      }
+
+      for (int64_t i = 0; i < n_segs; i++) {
+        if (child_segs[i].length > 0) {
+          const uint8_t* src = segs[i].array_view->buffer_views[2].data.as_uint8;
+          ArrowBufferAppendUnsafe(data, src + child_segs[i].start, child_segs[i].length);
+        }
+      }
+      break;
+    }
+
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      result = ArrowArrayConcatBinaryView(array, segs, n_segs, length);
+      break;
+
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_MAP:
+      result = ArrowArrayConcatOffsets(array, segs, n_segs, length, child_segs, error);
+      if (result != NANOARROW_OK) {
+        break;
+      }
+
+      for (int64_t i = 0; i < n_segs; i++) {
+        child_segs[i].array_view = segs[i].array_view->children[0];
+      }
+
+      result = ArrowArrayConcatInternal(array->children[0], child_segs, n_segs, error);
+      break;
+
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      result = ArrowArrayConcatListView(array, segs, n_segs, length, child_segs, error);
+      if (result != NANOARROW_OK) {
+        break;
+      }
+
+      for (int64_t i = 0; i < n_segs; i++) {
+        child_segs[i].array_view = segs[i].array_view->children[0];
+      }
+
+      result = ArrowArrayConcatInternal(array->children[0], child_segs, n_segs, error);
+      break;
+
+    case NANOARROW_TYPE_FIXED_SIZE_LIST: {
+      const int64_t fixed_size = private_data->layout.child_size_elements;
+      for (int64_t i = 0; i < n_segs; i++) {
+        const struct ArrowArrayView* array_view = segs[i].array_view;
+        child_segs[i].array_view = array_view->children[0];
+        child_segs[i].start = (array_view->offset + segs[i].start) * fixed_size;
+        child_segs[i].length = segs[i].length * fixed_size;
+      }
+
+      result = ArrowArrayConcatInternal(array->children[0], child_segs, n_segs, error);
+      break;
+    }
+
+    case NANOARROW_TYPE_DENSE_UNION:
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_STRUCT:
+      if (private_data->storage_type != NANOARROW_TYPE_STRUCT) {
+        result = ArrowArrayConcatFixedWidth(ArrowArrayBuffer(array, 0), segs, n_segs, 0,
+                                            sizeof(int8_t), length);
+        if (result != NANOARROW_OK) {
+          break;
+        }
+      }
+
+      if (private_data->storage_type == NANOARROW_TYPE_DENSE_UNION) {
+        result = ArrowArrayConcatDenseUnionOffsets(array, segs, n_segs, length,
+                                                   child_segs, error);
+        if (result != NANOARROW_OK) {
+          break;
+        }
+      } else {
+        // Children of struct and sparse union arrays are indexed by the parent's
+        // physical index
+        for (int64_t c = 0; c < array->n_children; c++) {
+          for (int64_t i = 0; i < n_segs; i++) {
+            const struct ArrowArrayView* array_view = segs[i].array_view;
+            child_segs[c * n_segs + i].array_view = array_view->children[c];
+            child_segs[c * n_segs + i].start = array_view->offset + segs[i].start;
+            child_segs[c * n_segs + i].length = segs[i].length;
+          }
+        }
+      }
+
+      for (int64_t c = 0; c < array->n_children; c++) {
+        result = ArrowArrayConcatInternal(array->children[c], child_segs + c * n_segs,
+                                          n_segs, error);
+        if (result != NANOARROW_OK) {
+          break;
+        }
+      }
+      break;
+
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      result =
+          ArrowArrayConcatRunEndEncoded(array, segs, n_segs, length, child_segs, error);
+      break;
+
+    default:
+      if (private_data->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA ||
+          (private_data->layout.element_size_bits[1] % 8) != 0 ||
+          array->n_children != 0) {
+        ArrowErrorSet(error, "Concatenation of %s arrays is not supported",
+                      ArrowTypeString(private_data->storage_type));
+        result = ENOTSUP;
+        break;
+      }
+
+      result = ArrowArrayConcatFixedWidth(ArrowArrayBuffer(array, 1), segs, n_segs, 1,
+                                          private_data->layout.element_size_bits[1] / 8,
+                                          length);
+      if (result != NANOARROW_OK) {
+        break;
+      }
+
+      if (array->dictionary != NULL) {
+        result = ArrowArrayConcatDictionaryIndices(array, segs, n_segs, error);
+        if (result != NANOARROW_OK) {
+          break;
+        }
+
+        for (int64_t i = 0; i < n_segs; i++) {
+          child_segs[i].array_view = segs[i].array_view->dictionary;
+          child_segs[i].start = 0;
+          child_segs[i].length = segs[i].array_view->dictionary->length;
+        }
+
+        result = ArrowArrayConcatInternal(array->dictionary, child_segs, n_segs, error);
+      }
+      break;
+  }
+
+  ArrowFree(child_segs);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  array->length = length;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayConcatSegments(
+    const struct ArrowSchema* schema, const struct ArrowArrayConcatSegment* segs,
+    int64_t n_segs, struct ArrowArray* out, struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromSchema(out, schema, error));
+
+  int result = ArrowArrayConcatInternal(out, segs, n_segs, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuildingDefault(out, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowArrayRelease(out);
+  }
+
+  return result;
+}
+
+ArrowErrorCode ArrowArrayConcatenateViews(const struct ArrowSchema* schema,
+                                          const struct ArrowArrayView** array_views,
+                                          int64_t n_array_views, struct ArrowArray* out,
+                                          struct ArrowError* error) {
+  if (n_array_views < 0) {
+    ArrowErrorSet(error, "Expected n_array_views >= 0 but got %" PRId64, n_array_views);
+    return EINVAL;
+  }
+
+  struct ArrowArrayConcatSegment* segs = NULL;
+  if (n_array_views > 0) {
+    segs = (struct ArrowArrayConcatSegment*)ArrowMalloc(
+        sizeof(struct ArrowArrayConcatSegment) * n_array_views);
+    if (segs == NULL) {
+      ArrowErrorSet(error, "Failed to allocate %" PRId64 " segments", n_array_views);
+      return ENOMEM;
+    }
+  }
+
+  for (int64_t i = 0; i < n_array_views; i++) {
+    segs[i].array_view = array_views[i];
+    segs[i].start = 0;
+    segs[i].length = array_views[i]->length;
+  }
+
+  int result = ArrowArrayConcatSegments(schema, segs, n_array_views, out, error);
+  ArrowFree(segs);
+  return result;
+}
+
+ArrowErrorCode ArrowArrayConcatenate(const struct ArrowSchema* schema,
+                                     struct ArrowArray** arrays, int64_t n_arrays,
+                                     struct ArrowArray* out, struct ArrowError* error) {
+  if (n_arrays < 0) {
+    ArrowErrorSet(error, "Expected n_arrays >= 0 but got %" PRId64, n_arrays);
+    return EINVAL;
+  }
+
+  // Parse the schema once for all array views
+  struct ArrowSchemaViewTree tree;
+  NANOARROW_RETURN_NOT_OK(ArrowSchemaViewTreeInit(&tree, schema, error));
+
+  struct ArrowArrayView* array_views = NULL;
+  struct ArrowArrayConcatSegment* segs = NULL;
+  if (n_arrays > 0) {
+    array_views =
+        (struct ArrowArrayView*)ArrowMalloc(sizeof(struct ArrowArrayView) * n_arrays);
+    segs = (struct ArrowArrayConcatSegment*)ArrowMalloc(
+        sizeof(struct ArrowArrayConcatSegment) * n_arrays);
+    if (array_views == NULL || segs == NULL) {
+      ArrowFree(array_views);
+      ArrowFree(segs);
+      ArrowSchemaViewTreeReset(&tree);
+      ArrowErrorSet(error, "Failed to allocate %" PRId64 " array views", n_arrays);
+      return ENOMEM;
+    }
+  }
+
+  int result = NANOARROW_OK;
+  int64_t n_initialized = 0;
+  for (; n_initialized < n_arrays; n_initialized++) {
+    result = ArrowArrayViewInitFromSchemaViewTree(array_views + n_initialized, &tree,
+                                                  error);
+    if (result != NANOARROW_OK) {
+      break;
+    }
+
+    result = ArrowArrayViewSetArray(array_views + n_initialized, arrays[n_initialized],
+                                    error);
+    if (result != NANOARROW_OK) {
+      ArrowArrayViewReset(array_views + n_initialized);
+      break;
+    }
+
+    segs[n_initialized].array_view = array_views + n_initialized;
+    segs[n_initialized].start = 0;
+    segs[n_initialized].length = arrays[n_initialized]->length;
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayConcatSegments(schema, segs, n_arrays, out, error);
+  }
+
+  for (int64_t i = 0; i < n_initialized; i++) {
+    ArrowArrayViewReset(array_views + i);
+  }
+
+  ArrowFree(array_views);
+  ArrowFree(segs);
+  ArrowSchemaViewTreeReset(&tree);
+  return result;
+}
+
+// Gather the bits of src at src_offset + indices[i] into dst one output byte at a
+// time. All ceil(n_indices / 8) bytes of dst are written.
+static void ArrowArrayTakeBits(const uint8_t* src, int64_t src_offset,
+                               const int64_t* indices, int64_t n_indices, uint8_t* dst) {
+  int64_t i = 0;
+  for (; (i + 8) <= n_indices; i += 8) {
+    uint8_t out_byte = 0;
+    for (int k = 0; k < 8; k++) {
+      out_byte |= (uint8_t)(ArrowBitGet(src, src_offset + indices[i + k]) << k);
+    }
+    dst[i / 8] = out_byte;
+  }
+
+  if (i < n_indices) {
+    uint8_t out_byte = 0;
+    for (int k = 0; i + k < n_indices; k++) {
+      out_byte |= (uint8_t)(ArrowBitGet(src, src_offset + indices[i + k]) << k);
+    }
+    dst[i / 8] = out_byte;
+  }
+}
+
+static ArrowErrorCode ArrowArrayTakeValidity(struct ArrowArray* array,
+                                             const struct ArrowArrayView* array_view,
+                                             const int64_t* indices, int64_t n_indices) {
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  if (array_view->null_count == 0 || validity == NULL) {
+    array->null_count = 0;
+    return NANOARROW_OK;
+  }
+
+  struct ArrowBitmap* bitmap = ArrowArrayValidityBitmap(array);
+  NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap, n_indices));
+  ArrowArrayTakeBits(validity, array_view->offset, indices, n_indices,
+                     bitmap->buffer.data);
+  bitmap->size_bits = n_indices;
+  bitmap->buffer.size_bytes = _ArrowBytesForBits(n_indices);
+  array->null_count = n_indices - ArrowBitCountSet(bitmap->buffer.data, 0, n_indices);
+  return NANOARROW_OK;
+}
+
+// Gather fixed-width elements. The loops for common element sizes are simple
+// enough to be vectorized (e.g., using gather instructions) by the compiler.
+static ArrowErrorCode ArrowArrayTakeFixedWidth(struct ArrowBuffer* buffer,
+                                               const uint8_t* src,
+                                               int64_t bytes_per_element,
+                                               const int64_t* indices,
+                                               int64_t n_indices) {
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, n_indices * bytes_per_element));
+  uint8_t* dst = buffer->data + buffer->size_bytes;
+
+  switch (bytes_per_element) {
+    case 1:
+      for (int64_t i = 0; i < n_indices; i++) {
+        dst[i] = src[indices[i]];
+      }
+      break;
+    case 2: {
+      const uint16_t* src16 = (const uint16_t*)src;
+      uint16_t* dst16 = (uint16_t*)dst;
+      for (int64_t i = 0; i < n_indices; i++) {
+        dst16[i] = src16[indices[i]];
+      }
+      break;
+    }
+    case 4: {
+      const uint32_t* src32 = (const uint32_t*)src;
+      uint32_t* dst32 = (uint32_t*)dst;
+      for (int64_t i = 0; i < n_indices; i++) {
+        dst32[i] = src32[indices[i]];
+      }
+      break;
+    }
+    case 8: {
+      const uint64_t* src64 = (const uint64_t*)src;
+      uint64_t* dst64 = (uint64_t*)dst;
+      for (int64_t i = 0; i < n_indices; i++) {
+        dst64[i] = src64[indices[i]];
+      }
+      break;
+    }
+    default:
+      for (int64_t i = 0; i < n_indices; i++) {
+        memcpy(dst + i * bytes_per_element, src + indices[i] * bytes_per_element,
+               (size_t)bytes_per_element);
+      }
+      break;
+  }
+
+  buffer->size_bytes += n_indices * bytes_per_element;
+  return NANOARROW_OK;
+}
+
+// Get the start and end offsets of element i (including array_view->offset) of
+// a binary, string, or list array
+static inline void ArrowArrayTakeGetRange(const struct ArrowArrayView* array_view,
+                                          int is_large, int64_t i, int64_t* start,
+                                          int64_t* end) {
+  if (is_large) {
+    *start = array_view->buffer_views[1].data.as_int64[i];
+    *end = array_view->buffer_views[1].data.as_int64[i + 1];
+  } else {
+    *start = array_view->buffer_views[1].data.as_int32[i];
+    *end = array_view->buffer_views[1].data.as_int32[i + 1];
+  }
+}
+
+// Write offsets for the selected elements in a single pass and return the total
+// number of child elements or bytes they reference
+static ArrowErrorCode ArrowArrayTakeOffsets(struct ArrowArray* array,
+                                            const struct ArrowArrayView* array_view,
+                                            const int64_t* indices, int64_t n_indices,
+                                            int64_t* child_length,
+                                            struct ArrowError* error) {
+  const int is_large = array_view->layout.element_size_bits[1] == 64;
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  const int64_t offset_size = is_large ? 8 : 4;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offsets, (n_indices + 1) * offset_size));
+
+  int64_t total = 0;
+  int64_t start;
+  int64_t end;
+  if (is_large) {
+    int64_t* dst = (int64_t*)offsets->data;
+    dst[0] = 0;
+    for (int64_t i = 0; i < n_indices; i++) {
+      ArrowArrayTakeGetRange(array_view, 1, array_view->offset + indices[i], &start,
+                             &end);
+      total += end - start;
+      dst[i + 1] = total;
+    }
+  } else {
+    int32_t* dst = (int32_t*)offsets->data;
+    dst[0] = 0;
+    for (int64_t i = 0; i < n_indices; i++) {
+      ArrowArrayTakeGetRange(array_view, 0, array_view->offset + indices[i], &start,
+                             &end);
+      total += end - start;
+      if (total > INT32_MAX) {
+        ArrowErrorSet(error,
+                      "Selected elements require more than %d elements or bytes which "
+                      "can't be represented with 32-bit offsets",
+                      (int)INT32_MAX);
+        return EOVERFLOW;
+      }
+      dst[i + 1] = (int32_t)total;
+    }
+  }
+
+  offsets->size_bytes = (n_indices + 1) * offset_size;
+  *child_length = total;
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayTakeBinary(struct ArrowArray* array,
+                                           const struct ArrowArrayView* array_view,
+                                           const int64_t* indices, int64_t n_indices,
+                                           struct ArrowError* error) {
+  int64_t n_bytes;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayTakeOffsets(array, array_view, indices, n_indices, &n_bytes, error));
+
+  struct ArrowBuffer* data = ArrowArrayBuffer(array, 2);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data, n_bytes));
+
+  const int is_large = array_view->layout.element_size_bits[1] == 64;
+  const uint8_t* src = array_view->buffer_views[2].data.as_uint8;
+  int64_t start;
+  int64_t end;
+  for (int64_t i = 0; i < n_indices; i++) {
+    ArrowArrayTakeGetRange(array_view, is_large, array_view->offset + indices[i], &start,
+                           &end);
+    if (end > start) {
+      ArrowBufferAppendUnsafe(data, src + start, end - start);
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayTakeBinaryView(struct ArrowArray* array,
+                                               const struct ArrowArrayView* array_view,
+                                               const int64_t* indices,
+                                               int64_t n_indices) {
+  struct ArrowBuffer* views = ArrowArrayBuffer(array, 1);
+  NANOARROW_RETURN_NOT_OK(ArrowArrayTakeFixedWidth(
+      views, (const uint8_t*)(array_view->buffer_views[1].data.as_binary_view +
+                              array_view->offset),
+      sizeof(union ArrowBinaryView), indices, n_indices));
+
+  // Out-of-line data for the selected elements is compacted into new data buffers
+  union ArrowBinaryView* dst = (union ArrowBinaryView*)views->data;
+  int64_t n_bytes = 0;
+  for (int64_t i = 0; i < n_indices; i++) {
+    if (dst[i].inlined.size > NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+      n_bytes += dst[i].inlined.size;
+    }
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  int32_t buffer_i = -1;
+  struct ArrowBuffer* buffer = NULL;
+  for (int64_t i = 0; i < n_indices; i++) {
+    int32_t size = dst[i].inlined.size;
+    if (size <= NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+      continue;
+    }
+
+    if (buffer == NULL || (buffer->size_bytes + size) > INT32_MAX) {
+      NANOARROW_RETURN_NOT_OK(ArrowArrayAddVariadicBuffers(array, 1));
+      buffer_i++;
+      buffer = private_data->variadic_buffers + buffer_i;
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferReserve(buffer, n_bytes < INT32_MAX ? n_bytes : INT32_MAX));
+    }
+
+    const uint8_t* src =
+        (const uint8_t*)array_view->variadic_buffers[dst[i].ref.buffer_index];
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(buffer, src + dst[i].ref.offset, size));
+    dst[i].ref.buffer_index = buffer_i;
+    dst[i].ref.offset = (int32_t)(buffer->size_bytes - size);
+    private_data->variadic_buffer_sizes[buffer_i] = buffer->size_bytes;
+    n_bytes -= size;
+  }
+
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowArrayTakeInternal(struct ArrowArray* array,
+                                             const struct ArrowArrayView* array_view,
+                                             const int64_t* indices, int64_t n_indices,
+                                             struct ArrowError* error);
+
+// Select the child elements referenced by the selected elements of a list,
+// large list, map, or list view
+static ArrowErrorCode ArrowArrayTakeListChild(struct ArrowArray* array,
+                                              const struct ArrowArrayView* array_view,
+                                              const int64_t* indices, int64_t n_indices,
+                                              int64_t child_length,
+                                              struct ArrowError* error) {
+  int64_t* child_indices = NULL;
+  if (child_length > 0) {
+    child_indices = (int64_t*)ArrowMalloc(sizeof(int64_t) * child_length);
+    if (child_indices == NULL) {
+      ArrowErrorSet(error, "Failed to allocate %" PRId64 " child indices", child_length);
+      return ENOMEM;
+    }
+  }
+
+  const int is_large = array_view->layout.element_size_bits[1] == 64;
+  const int is_list_view = array_view->storage_type == NANOARROW_TYPE_LIST_VIEW ||
+                           array_view->storage_type == NANOARROW_TYPE_LARGE_LIST_VIEW;
+  int64_t child_i = 0;
+  for (int64_t i = 0; i < n_indices; i++) {
+    const int64_t j = array_view->offset + indices[i];
+    int64_t start;
+    int64_t end;
+    if (!is_list_view) {
+      ArrowArrayTakeGetRange(array_view, is_large, j, &start, &end);
+    } else if (is_large) {
+      start = array_view->buffer_views[1].data.as_int64[j];
+      end = start + array_view->buffer_views[2].data.as_int64[j];
+    } else {
+      start = array_view->buffer_views[1].data.as_int32[j];
+      end = start + array_view->buffer_views[2].data.as_int32[j];
+    }
+
+    for (int64_t k = start; k < end; k++) {
+      child_indices[child_i++] = k;
+    }
+  }
+
+  int result = ArrowArrayTakeInternal(array->children[0], array_view->children[0],
+                                      child_indices, child_length, error);
+  ArrowFree(child_indices);
+  return result;
+}
+
+static ArrowErrorCode ArrowArrayTakeListView(struct ArrowArray* array,
+                                             const struct ArrowArrayView* array_view,
+                                             const int64_t* indices, int64_t n_indices,
+                                             struct ArrowError* error) {
+  const int is_large = array_view->layout.element_size_bits[1] == 64;
+  const int64_t offset_size = is_large ? 8 : 4;
+
+  // The selected views are laid out contiguously in the child
+  struct ArrowBuffer* sizes = ArrowArrayBuffer(array, 2);
+  NANOARROW_RETURN_NOT_OK(ArrowArrayTakeFixedWidth(
+      sizes, array_view->buffer_views[2].data.as_uint8 + array_view->offset * offset_size,
+      offset_size, indices, n_indices));
+
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(offsets, n_indices * offset_size));
+  int64_t total = 0;
+  for (int64_t i = 0; i < n_indices; i++) {
+    if (is_large) {
+      ((int64_t*)offsets->data)[i] = total;
+      total += ((int64_t*)sizes->data)[i];
+    } else {
+      ((int32_t*)offsets->data)[i] = (int32_t)total;
+      total += ((int32_t*)sizes->data)[i];
+      if (total > INT32_MAX) {
+        ArrowErrorSet(error,
+                      "Selected elements require more than %d child elements which "
+                      "can't be represented with 32-bit offsets",
+                      (int)INT32_MAX);
+        return EOVERFLOW;
+      }
+    }
+  }
+
+  offsets->size_bytes = n_indices * offset_size;
+  return ArrowArrayTakeListChild(array, array_view, indices, n_indices, total, error);
+}
+
+static ArrowErrorCode ArrowArrayTakeDenseUnion(struct ArrowArray* array,
+                                               const struct ArrowArrayView* array_view,
+                                               const int64_t* indices, int64_t n_indices,
+                                               struct ArrowError* error) {
+  const int64_t n_children = array_view->n_children;
+  int64_t child_starts[129];
+  memset(child_starts, 0, sizeof(child_starts));
+
+  // Count the selected elements of each child to place its indices contiguously
+  for (int64_t i = 0; i < n_indices; i++) {
+    child_starts[ArrowArrayViewUnionChildIndex(array_view, indices[i]) + 1]++;
+  }
+
+  for (int64_t c = 0; c < n_children; c++) {
+    child_starts[c + 1] += child_starts[c];
+  }
+
+  int64_t* child_indices = NULL;
+  if (n_indices > 0) {
+    child_indices = (int64_t*)ArrowMalloc(sizeof(int64_t) * n_indices);
+    if (child_indices == NULL) {
+      ArrowErrorSet(error, "Failed to allocate %" PRId64 " child indices", n_indices);
+      return ENOMEM;
+    }
+  }
+
+  struct ArrowBuffer* offsets = ArrowArrayBuffer(array, 1);
+  int result = ArrowBufferReserve(offsets, n_indices * (int64_t)sizeof(int32_t));
+  if (result != NANOARROW_OK) {
+    ArrowFree(child_indices);
+    return result;
+  }
+
+  int64_t child_pos[128];
+  memcpy(child_pos, child_starts, sizeof(child_pos));
+  for (int64_t i = 0; i < n_indices; i++) {
+    int8_t c = ArrowArrayViewUnionChildIndex(array_view, indices[i]);
+    int32_t offset = (int32_t)(child_pos[c] - child_starts[c]);
+    ArrowBufferAppendUnsafe(offsets, &offset, sizeof(int32_t));
+    child_indices[child_pos[c]++] =
+        ArrowArrayViewUnionChildOffset(array_view, indices[i]);
+  }
+
+  for (int64_t c = 0; c < n_children; c++) {
+    result = ArrowArrayTakeInternal(array->children[c], array_view->children[c],
+                                    child_indices + child_starts[c],
+                                    child_starts[c + 1] - child_starts[c], error);
+    if (result != NANOARROW_OK) {
+      break;
+    }
+  }
+
+  ArrowFree(child_indices);
+  return result;
+}
+
+static ArrowErrorCode ArrowArrayTakeRunEndEncoded(struct ArrowArray* array,
+                                                  const struct ArrowArrayView* array_view,
+                                                  const int64_t* indices,
+                                                  int64_t n_indices,
+                                                  struct ArrowError* error) {
+  const struct ArrowArrayView* run_ends_view = array_view->children[0];
+  const int64_t run_end_size = run_ends_view->layout.element_size_bits[1] / 8;
+  const int64_t max_length =
+      run_end_size == 2 ? INT16_MAX : (run_end_size == 4 ? INT32_MAX : INT64_MAX);
+  if (n_indices > max_length) {
+    ArrowErrorSet(error,
+                  "Can't select %" PRId64
+                  " elements from a run-end encoded array with maximum run end %" PRId64,
+                  n_indices, max_length);
+    return EOVERFLOW;
+  }
+
+  int64_t* run_indices = NULL;
+  if (n_indices > 0) {
+    run_indices = (int64_t*)ArrowMalloc(sizeof(int64_t) * n_indices);
+    if (run_indices == NULL) {
+      ArrowErrorSet(error, "Failed to allocate %" PRId64 " run indices", n_indices);
+      return ENOMEM;
+    }
+  }
+
+  // Consecutive selected elements that belong to the same run are merged
+  struct ArrowBuffer* run_ends = ArrowArrayBuffer(array->children[0], 1);
+  int result = ArrowBufferReserve(run_ends, n_indices * run_end_size);
+  int64_t n_runs = 0;
+  for (int64_t i = 0; i < n_indices && result == NANOARROW_OK; i++) {
+    const int64_t j = array_view->offset + indices[i];
+    int64_t lo = 0;
+    int64_t hi = run_ends_view->length;
+    while (lo < hi) {
+      int64_t mid = lo + (hi - lo) / 2;
+      if (ArrowArrayViewGetIntUnsafe(run_ends_view, mid) > j) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+
+    if (n_runs == 0 || run_indices[n_runs - 1] != lo) {
+      run_indices[n_runs++] = lo;
+      run_ends->size_bytes += run_end_size;
+    }
+
+    switch (run_end_size) {
+      case 2:
+        ((int16_t*)run_ends->data)[n_runs - 1] = (int16_t)(i + 1);
+        break;
+      case 4:
+        ((int32_t*)run_ends->data)[n_runs - 1] = (int32_t)(i + 1);
+        break;
+      default:
+        ((int64_t*)run_ends->data)[n_runs - 1] = i + 1;
+        break;
+    }
+  }
+
+  if (result == NANOARROW_OK) {
+    array->children[0]->length = n_runs;
+    array->children[0]->null_count = 0;
+    result = ArrowArrayTakeInternal(array->children[1], array_view->children[1],
+                                    run_indices, n_runs, error);
+  }
+
+  ArrowFree(run_indices);
+  return result;
+}
+
+static ArrowErrorCode ArrowArrayTakeInternal(struct ArrowArray* array,
+                                             const struct ArrowArrayView* array_view,
+                                             const int64_t* indices, int64_t n_indices,
+                                             struct ArrowError* error) {
+  if (array_view->layout.buffer_type[0] == NANOARROW_BUFFER_TYPE_VALIDITY) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowArrayTakeValidity(array, array_view, indices, n_indices));
+  } else {
+    array->null_count = 0;
+  }
+
+  // For struct, sparse union, and fixed-size list arrays, children are indexed by
+  // the parent's physical index
+  int64_t* child_indices = NULL;
+  int64_t n_child_indices = 0;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_STRUCT:
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_FIXED_SIZE_LIST: {
+      const int64_t fixed_size =
+          array_view->storage_type == NANOARROW_TYPE_FIXED_SIZE_LIST
+              ? array_view->layout.child_size_elements
+              : 1;
+      if (array_view->offset == 0 && fixed_size == 1) {
+        child_indices = (int64_t*)indices;
+        n_child_indices = n_indices;
+        break;
+      }
+
+      n_child_indices = n_indices * fixed_size;
+      if (n_child_indices == 0) {
+        break;
+      }
+
+      child_indices = (int64_t*)ArrowMalloc(sizeof(int64_t) * n_child_indices);
+      if (child_indices == NULL) {
+        ArrowErrorSet(error, "Failed to allocate %" PRId64 " child indices",
+                      n_child_indices);
+        return ENOMEM;
+      }
+
+      for (int64_t i = 0; i < n_indices; i++) {
+        const int64_t first = (array_view->offset + indices[i]) * fixed_size;
+        for (int64_t k = 0; k < fixed_size; k++) {
+          child_indices[i * fixed_size + k] = first + k;
+        }
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  int result = NANOARROW_OK;
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_NA:
+      array->null_count = n_indices;
+      break;
+
+    case NANOARROW_TYPE_BOOL: {
+      struct ArrowBuffer* data = ArrowArrayBuffer(array, 1);
+      result = ArrowBufferReserve(data, _ArrowBytesForBits(n_indices));
+      if (result == NANOARROW_OK) {
+        ArrowArrayTakeBits(array_view->buffer_views[1].data.as_uint8, array_view->offset,
+                           indices, n_indices, data->data);
+        data->size_bytes = _ArrowBytesForBits(n_indices);
+      }
+      break;
+    }
+
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      result = ArrowArrayTakeBinary(array, array_view, indices, n_indices, error);
+      break;
+
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      result = ArrowArrayTakeBinaryView(array, array_view, indices, n_indices);
+      break;
+
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_MAP: {
+      int64_t child_length;
+      result = ArrowArrayTakeOffsets(array, array_view, indices, n_indices,
+                                     &child_length, error);
+      if (result == NANOARROW_OK) {
+        result = ArrowArrayTakeListChild(array, array_view, indices, n_indices,
+                                         child_length, error);
+      }
+      break;
+    }
+
+    case NANOARROW_TYPE_LIST_VIEW:
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      result = ArrowArrayTakeListView(array, array_view, indices, n_indices, error);
+      break;
+
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      result = ArrowArrayTakeInternal(array->children[0], array_view->children[0],
+                                      child_indices, n_child_indices, error);
+      break;
+
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_STRUCT:
+      if (array_view->storage_type == NANOARROW_TYPE_SPARSE_UNION) {
+        result = ArrowArrayTakeFixedWidth(
+            ArrowArrayBuffer(array, 0),
+            array_view->buffer_views[0].data.as_uint8 + array_view->offset, 1, indices,
+            n_indices);
+      }
+
+      for (int64_t c = 0; c < array_view->n_children && result == NANOARROW_OK; c++) {
+        result = ArrowArrayTakeInternal(array->children[c], array_view->children[c],
+                                        child_indices, n_child_indices, error);
+      }
+      break;
+
+    case NANOARROW_TYPE_DENSE_UNION:
+      result = ArrowArrayTakeFixedWidth(
+          ArrowArrayBuffer(array, 0),
+          array_view->buffer_views[0].data.as_uint8 + array_view->offset, 1, indices,
+          n_indices);
+      if (result == NANOARROW_OK) {
+        result = ArrowArrayTakeDenseUnion(array, array_view, indices, n_indices, error);
+      }
+      break;
+
+    case NANOARROW_TYPE_RUN_END_ENCODED:
+      result = ArrowArrayTakeRunEndEncoded(array, array_view, indices, n_indices, error);
+      break;
+
+    default: {
+      if (array_view->layout.buffer_type[1] != NANOARROW_BUFFER_TYPE_DATA ||
+          (array_view->layout.element_size_bits[1] % 8) != 0 ||
+          array_view->n_children != 0) {
+        ArrowErrorSet(error, "Selection from %s arrays is not supported",
+                      ArrowTypeString(array_view->storage_type));
+        result = ENOTSUP;
+        break;
+      }
+
+      const int64_t bytes_per_element = array_view->layout.element_size_bits[1] / 8;
+      result = ArrowArrayTakeFixedWidth(
+          ArrowArrayBuffer(array, 1),
+          array_view->buffer_views[1].data.as_uint8 +
+              array_view->offset * bytes_per_element,
+          bytes_per_element, indices, n_indices);
+      if (result != NANOARROW_OK || array_view->dictionary == NULL) {
+        break;
+      }
+
+      // The dictionary is copied as-is
+      const int64_t dictionary_length = array_view->dictionary->length;
+      if (dictionary_length > 0) {
+        child_indices = (int64_t*)ArrowMalloc(sizeof(int64_t) * dictionary_length);
+        if (child_indices == NULL) {
+          result = ENOMEM;
+          break;
+        }
+
+        for (int64_t i = 0; i < dictionary_length; i++) {
+          child_indices[i] = i;
+        }
+      }
+
+      result = ArrowArrayTakeInternal(array->dictionary, array_view->dictionary,
+                                      child_indices, dictionary_length, error);
+      break;
+    }
+  }
+
+  if (child_indices != indices) {
+    ArrowFree(child_indices);
+  }
+
+  NANOARROW_RETURN_NOT_OK(result);
+  array->length = n_indices;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayTake(const struct ArrowArrayView* array_view,
+                              const int64_t* indices, int64_t n_indices,
+                              struct ArrowArray* out, struct ArrowError* error) {
+  for (int64_t i = 0; i < n_indices; i++) {
+    if (indices[i] < 0 || indices[i] >= array_view->length) {
+      ArrowErrorSet(error,
+                    "Index %" PRId64 " is out of range for array of length %" PRId64,
+                    indices[i], array_view->length);
+      return EINVAL;
+    }
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(out, array_view, error));
+
+  int result = ArrowArrayTakeInternal(out, array_view, indices, n_indices, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuildingDefault(out, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowArrayRelease(out);
+  }
+
+  return result;
+}
+
+ArrowErrorCode ArrowArrayFilter(const struct ArrowArrayView* array_view,
+                                const uint8_t* mask, struct ArrowArray* out,
+                                struct ArrowError* error) {
+  const int64_t length = array_view->length;
+  const int64_t n_indices = ArrowBitCountSet(mask, 0, length);
+
+  int64_t* indices = NULL;
+  if (n_indices > 0) {
+    indices = (int64_t*)ArrowMalloc(sizeof(int64_t) * n_indices);
+    if (indices == NULL) {
+      ArrowErrorSet(error, "Failed to allocate %" PRId64 " indices", n_indices);
+      return ENOMEM;
+    }
+  }
+
+  // Convert the mask to indices a byte at a time, skipping empty bytes and
+  // expanding full bytes without testing each bit
+  int64_t n = 0;
+  const int64_t n_full_bytes = length / 8;
+  for (int64_t byte_i = 0; byte_i < n_full_bytes; byte_i++) {
+    const uint8_t mask_byte = mask[byte_i];
+    if (mask_byte == 0) {
+      continue;
+    }
+
+    const int64_t first = byte_i * 8;
+    if (mask_byte == 0xff) {
+      for (int k = 0; k < 8; k++) {
+        indices[n++] = first + k;
+      }
+    } else {
+      for (int k = 0; k < 8; k++) {
+        if ((mask_byte >> k) & 1) {
+          indices[n++] = first + k;
+        }
+      }
+    }
+  }
+
+  for (int64_t i = n_full_bytes * 8; i < length; i++) {
+    if (ArrowBitGet(mask, i)) {
+      indices[n++] = i;
+    }
+  }
+
+  int result = ArrowArrayTake(array_view, indices, n_indices, out, error);
+  ArrowFree(indices);
+  return result;
+}
+
+// An entry in the ArrowDictionaryBuilder hash table. The lower 32 bits of the hash
+// of each value are stored next to its dictionary index such that most
+// mismatches can be rejected (and the table can be grown) without touching the
+// value data. Empty slots have an index of -1.
+struct ArrowDictionaryBuilderEntry {
+  uint32_t hash;
+  int32_t index;
+};
+
+#define NANOARROW_DICTIONARY_BUILDER_INITIAL_CAPACITY 64
+
+static ArrowErrorCode ArrowDictionaryBuilderInitArray(struct ArrowArray* array,
+                                                      enum ArrowType value_type) {
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array, NANOARROW_TYPE_INT32));
+
+  int result = ArrowArrayAllocateDictionary(array);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayInitFromType(array->dictionary, value_type);
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayStartAppending(array);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowArrayRelease(array);
+  }
+
+  return result;
+}
+
+static void ArrowDictionaryBuilderClearTable(struct ArrowDictionaryBuilder* builder) {
+  // All bits set gives an index of -1 for every slot
+  memset(builder->table.data, 0xff,
+         (size_t)builder->table_capacity * sizeof(struct ArrowDictionaryBuilderEntry));
+}
+
+static ArrowErrorCode ArrowDictionaryBuilderGrow(struct ArrowDictionaryBuilder* builder) {
+  const int64_t capacity = builder->table_capacity * 2;
+  const uint64_t mask = (uint64_t)capacity - 1;
+
+  struct ArrowBuffer table;
+  ArrowBufferInit(&table);
+  NANOARROW_RETURN_NOT_OK(
+      ArrowBufferReserve(&table, capacity * sizeof(struct ArrowDictionaryBuilderEntry)));
+  memset(table.data, 0xff, (size_t)capacity * sizeof(struct ArrowDictionaryBuilderEntry));
+
+  // Reinsert using the stored hashes (the table never has more than 2^32 slots)
+  const struct ArrowDictionaryBuilderEntry* old_entries =
+      (const struct ArrowDictionaryBuilderEntry*)builder->table.data;
+  struct ArrowDictionaryBuilderEntry* entries =
+      (struct ArrowDictionaryBuilderEntry*)table.data;
+  for (int64_t i = 0; i < builder->table_capacity; i++) {
+    if (old_entries[i].index == -1) {
+      continue;
+    }
+
+    uint64_t slot = old_entries[i].hash & mask;
+    while (entries[slot].index != -1) {
+      slot = (slot + 1) & mask;
+    }
+
+    entries[slot] = old_entries[i];
+  }
+
+  ArrowBufferReset(&builder->table);
+  ArrowBufferMove(&table, &builder->table);
+  builder->table_capacity = capacity;
+  return NANOARROW_OK;
+}
+
+// Find the dictionary index of a value, adding it to the dictionary if it has
+// not been seen before
+static inline ArrowErrorCode ArrowDictionaryBuilderIntern(
+    struct ArrowDictionaryBuilder* builder, const uint8_t* data, int64_t size,
+    int32_t* index_out) {
+  struct ArrowArray* dictionary = builder->array.dictionary;
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)dictionary->private_data;
+  const int large_offsets = private_data->storage_type == NANOARROW_TYPE_LARGE_STRING ||
+                            private_data->storage_type == NANOARROW_TYPE_LARGE_BINARY;
+  const uint8_t* offsets = ArrowArrayBuffer(dictionary, 1)->data;
+  const uint8_t* values = ArrowArrayBuffer(dictionary, 2)->data;
+
+  const uint64_t hash = _ArrowHashBytes(data, size);
+  const uint32_t short_hash = (uint32_t)hash;
+  const uint64_t mask = (uint64_t)builder->table_capacity - 1;
+  struct ArrowDictionaryBuilderEntry* entries =
+      (struct ArrowDictionaryBuilderEntry*)builder->table.data;
+
+  uint64_t slot = short_hash & mask;
+  while (entries[slot].index != -1) {
+    if (entries[slot].hash == short_hash) {
+      const int32_t index = entries[slot].index;
+      int64_t start;
+      int64_t end;
+      if (large_offsets) {
+        start = ((const int64_t*)offsets)[index];
+        end = ((const int64_t*)offsets)[index + 1];
+      } else {
+        start = ((const int32_t*)offsets)[index];
+        end = ((const int32_t*)offsets)[index + 1];
+      }
+
+      if ((end - start) == size &&
+          (size == 0 || memcmp(values + start, data, (size_t)size) == 0)) {
+        *index_out = index;
+        return NANOARROW_OK;
+      }
+    }
+
+    slot = (slot + 1) & mask;
+  }
+
+  const int64_t index = dictionary->length;
+  if (index == INT32_MAX) {
+    return EOVERFLOW;
+  }
+
+  struct ArrowBufferView value;
+  value.data.as_uint8 = data;
+  value.size_bytes = size;
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendBytes(dictionary, value));
+
+  entries[slot].hash = short_hash;
+  entries[slot].index = (int32_t)index;
+  *index_out = (int32_t)index;
+
+  // Keep the load factor at or below 0.5
+  if ((index + 1) * 2 > builder->table_capacity) {
+    NANOARROW_RETURN_NOT_OK(ArrowDictionaryBuilderGrow(builder));
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDictionaryBuilderInit(struct ArrowDictionaryBuilder* builder,
+                                          enum ArrowType value_type) {
+  switch (value_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_BINARY:
+      break;
+    default:
+      return EINVAL;
+  }
+
+  ArrowBufferInit(&builder->table);
+  builder->table_capacity = NANOARROW_DICTIONARY_BUILDER_INITIAL_CAPACITY;
+  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(
+      &builder->table,
+      builder->table_capacity * sizeof(struct ArrowDictionaryBuilderEntry)));
+  ArrowDictionaryBuilderClearTable(builder);
+
+  int result = ArrowDictionaryBuilderInitArray(&builder->array, value_type);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(&builder->table);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendString(struct ArrowDictionaryBuilder* builder,
+                                                  struct ArrowStringView value) {
+  int32_t index;
+  NANOARROW_RETURN_NOT_OK(ArrowDictionaryBuilderIntern(
+      builder, (const uint8_t*)value.data, value.size_bytes, &index));
+  return ArrowArrayAppendInt(&builder->array, index);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendNull(struct ArrowDictionaryBuilder* builder,
+                                                int64_t n) {
+  return ArrowArrayAppendNull(&builder->array, n);
+}
+
+ArrowErrorCode ArrowDictionaryBuilderAppendArrayView(
+    struct ArrowDictionaryBuilder* builder, const struct ArrowArrayView* array_view,
+    struct ArrowError* error) {
+  switch (array_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_STRING_VIEW:
+    case NANOARROW_TYPE_BINARY_VIEW:
+      break;
+    default:
+      ArrowErrorSet(error, "Can't dictionary-encode array of type %s",
+                    ArrowTypeString(array_view->storage_type));
+      return EINVAL;
+  }
+
+  const int64_t length = array_view->length;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowArrayReserve(&builder->array, builder->array.length + length), error);
+
+  const uint8_t* validity = array_view->buffer_views[0].data.as_uint8;
+  const int64_t offset = array_view->offset;
+  const uint8_t* data = array_view->buffer_views[2].data.as_uint8;
+  int32_t index;
+  int result;
+
+  for (int64_t i = 0; i < length; i++) {
+    if (validity != NULL && !ArrowBitGet(validity, offset + i)) {
+      result = ArrowArrayAppendNull(&builder->array, 1);
+    } else {
+      switch (array_view->storage_type) {
+        case NANOARROW_TYPE_STRING:
+        case NANOARROW_TYPE_BINARY: {
+          const int32_t* offsets = array_view->buffer_views[1].data.as_int32 + offset;
+          result = ArrowDictionaryBuilderIntern(builder, data + offsets[i],
+                                                offsets[i + 1] - offsets[i], &index);
+          break;
+        }
+        case NANOARROW_TYPE_LARGE_STRING:
+        case NANOARROW_TYPE_LARGE_BINARY: {
+          const int64_t* offsets = array_view->buffer_views[1].data.as_int64 + offset;
+          result = ArrowDictionaryBuilderIntern(builder, data + offsets[i],
+                                                offsets[i + 1] - offsets[i], &index);
+          break;
+        }
+        default: {
+          struct ArrowBufferView value = ArrowArrayViewGetBytesUnsafe(array_view, i);
+          result = ArrowDictionaryBuilderIntern(builder, value.data.as_uint8,
+                                                value.size_bytes, &index);
+          break;
+        }
+      }
+
+      if (result == NANOARROW_OK) {
+        result = ArrowArrayAppendInt(&builder->array, index);
+      }
+    }
+
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "Failed to dictionary-encode element %" PRId64, i);
+      return result;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowDictionaryBuilderFinish(struct ArrowDictionaryBuilder* builder,
+                                            struct ArrowArray* out,
+                                            struct ArrowError* error) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)builder->array.dictionary->private_data;
+
+  // Initialize the next array first such that a failure leaves the builder as-is
+  struct ArrowArray next;
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowDictionaryBuilderInitArray(&next, private_data->storage_type), error);
+
+  int result = ArrowArrayFinishBuildingDefault(&builder->array, error);
+  if (result != NANOARROW_OK) {
+    ArrowArrayRelease(&next);
+    return result;
+  }
+
+  ArrowArrayMove(&builder->array, out);
+  ArrowArrayMove(&next, &builder->array);
+  ArrowDictionaryBuilderClearTable(builder);
+  return NANOARROW_OK;
+}
+
+void ArrowDictionaryBuilderReset(struct ArrowDictionaryBuilder* builder) {
+  if (builder->array.release != NULL) {
+    ArrowArrayRelease(&builder->array);
+  }
+
+  ArrowBufferReset(&builder->table);
+  builder->table_capacity = 0;
+}
+
+// Pick the dictionary element that null indices are gathered from. Using the
+// shortest element avoids copying data for null slots of binary or list arrays
+// (ideally none when the dictionary contains an empty value).
+static int64_t ArrowArrayDictionaryDecodePlaceholder(
+    const struct ArrowArrayView* dictionary_view) {
+  switch (dictionary_view->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_BINARY:
+    case NANOARROW_TYPE_LARGE_BINARY:
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LARGE_LIST:
+    case NANOARROW_TYPE_MAP:
+      break;
+    default:
+      return 0;
+  }
+
+  const int is_large = dictionary_view->layout.element_size_bits[1] == 64;
+  int64_t placeholder = 0;
+  int64_t min_size = INT64_MAX;
+  int64_t start;
+  int64_t end;
+  for (int64_t i = 0; i < dictionary_view->length; i++) {
+    ArrowArrayTakeGetRange(dictionary_view, is_large, dictionary_view->offset + i,
+                           &start, &end);
+    if ((end - start) < min_size) {
+      placeholder = i;
+      min_size = end - start;
+      if (min_size == 0) {
+        break;
+      }
+    }
+  }
+
+  return placeholder;
+}
+
+// Combine the validity of the indices with the validity of the gathered
+// dictionary values
+static ArrowErrorCode ArrowArrayDictionaryDecodeValidity(
+    struct ArrowArray* array, const struct ArrowArrayView* array_view,
+    struct ArrowError* error) {
+  const int64_t length = array_view->length;
+  const uint8_t* index_validity = array_view->buffer_views[0].data.as_uint8;
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  if (private_data->layout.buffer_type[0] != NANOARROW_BUFFER_TYPE_VALIDITY) {
+    if (private_data->storage_type == NANOARROW_TYPE_NA) {
+      return NANOARROW_OK;
+    }
+
+    ArrowErrorSet(error,
+                  "Can't decode null dictionary indices into array of type %s without "
+                  "a validity buffer",
+                  ArrowTypeString(private_data->storage_type));
+    return ENOTSUP;
+  }
+
+  struct ArrowBitmap* bitmap = ArrowArrayValidityBitmap(array);
+  if (bitmap->size_bits == 0) {
+    // No gathered values were null: the result has the same validity as the indices
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap, length));
+    ArrowArrayConcatBits(index_validity, array_view->offset, length, bitmap->buffer.data,
+                         0);
+    bitmap->size_bits = length;
+    bitmap->buffer.size_bytes = _ArrowBytesForBits(length);
+  } else {
+    struct ArrowBuffer aligned;
+    ArrowBufferInit(&aligned);
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(&aligned, _ArrowBytesForBits(length)));
+    ArrowArrayConcatBits(index_validity, array_view->offset, length, aligned.data, 0);
+    for (int64_t i = 0; i < _ArrowBytesForBits(length); i++) {
+      bitmap->buffer.data[i] &= aligned.data[i];
+    }
+    ArrowBufferReset(&aligned);
+  }
+
+  array->null_count = length - ArrowBitCountSet(bitmap->buffer.data, 0, length);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayDictionaryDecode(const struct ArrowArrayView* array_view,
+                                          struct ArrowArray* out,
+                                          struct ArrowError* error) {
+  const struct ArrowArrayView* dictionary_view = array_view->dictionary;
+  if (dictionary_view == NULL) {
+    ArrowErrorSet(error, "Can't decode ArrowArrayView without a dictionary");
+    return EINVAL;
+  }
+
+  const int64_t length = array_view->length;
+  const uint8_t* index_validity = array_view->buffer_views[0].data.as_uint8;
+  const int has_nulls = index_validity != NULL && array_view->null_count != 0;
+
+  // If every index is null there may be nothing to gather from
+  if (dictionary_view->length == 0) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromArrayView(out, dictionary_view, error));
+    int result = ArrowArrayStartAppending(out);
+    for (int64_t i = 0; i < length && result == NANOARROW_OK; i++) {
+      if (!has_nulls || ArrowBitGet(index_validity, array_view->offset + i)) {
+        ArrowErrorSet(error,
+                      "Index %" PRId64 " is out of range for dictionary of length 0",
+                      ArrowArrayViewGetIntUnsafe(array_view, i));
+        result = EINVAL;
+      }
+    }
+
+    if (result == NANOARROW_OK) {
+      result = ArrowArrayAppendNull(out, length);
+    }
+
+    if (result == NANOARROW_OK) {
+      result = ArrowArrayFinishBuildingDefault(out, error);
+    }
+
+    if (result != NANOARROW_OK) {
+      ArrowArrayRelease(out);
+    }
+
+    return result;
+  }
+
+  // Widen the indices to int64, checking their bounds and replacing null indices
+  // with one that is safe to gather from
+  int64_t* indices = NULL;
+  if (length > 0) {
+    indices = (int64_t*)ArrowMalloc(sizeof(int64_t) * length);
+    if (indices == NULL) {
+      ArrowErrorSet(error, "Failed to allocate %" PRId64 " indices", length);
+      return ENOMEM;
+    }
+  }
+
+  const int64_t placeholder =
+      has_nulls ? ArrowArrayDictionaryDecodePlaceholder(dictionary_view) : 0;
+  for (int64_t i = 0; i < length; i++) {
+    if (has_nulls && !ArrowBitGet(index_validity, array_view->offset + i)) {
+      indices[i] = placeholder;
+      continue;
+    }
+
+    indices[i] = ArrowArrayViewGetIntUnsafe(array_view, i);
+    if (indices[i] < 0 || indices[i] >= dictionary_view->length) {
+      ArrowErrorSet(error,
+                    "Index %" PRId64 " is out of range for dictionary of length %" PRId64,
+                    indices[i], dictionary_view->length);
+      ArrowFree(indices);
+      return EINVAL;
+    }
+  }
+
+  int result = ArrowArrayInitFromArrayView(out, dictionary_view, error);
+  if (result != NANOARROW_OK) {
+    ArrowFree(indices);
+    return result;
+  }
+
+  result = ArrowArrayTakeInternal(out, dictionary_view, indices, length, error);
+  ArrowFree(indices);
+
+  if (result == NANOARROW_OK && has_nulls) {
+    result = ArrowArrayDictionaryDecodeValidity(out, array_view, error);
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayFinishBuildingDefault(out, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    ArrowArrayRelease(out);
+  }
+
+  return result;
+}
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <errno.h>
+#include <string.h>
 
 #include "nanoarrow/nanoarrow.h"
 
@@ -152,3 +153,312 @@ ArrowErrorCode ArrowBasicArrayStreamValidate(const struct ArrowArrayStream* arra
   ArrowArrayViewReset(&array_view);
   return NANOARROW_OK;
 }
+
+struct RechunkArrayStreamPrivate {
+  struct ArrowArrayStream src;
+  struct ArrowSchema schema;
+  struct ArrowArrayView array_view;
+  int64_t target_rows;
+  int64_t target_bytes;
+
+  // The input array currently being consumed and the number of its rows that
+  // have already been emitted
+  struct ArrowArray current;
+  int64_t current_offset;
+
+  // Slices of one or more input arrays waiting to be concatenated, the total number
+  // of rows they contain, and the number of rows of the batch they belong to. Pieces
+  // are kept if emitting a batch fails such that no input rows are lost.
+  struct ArrowArray* pieces;
+  int64_t n_pieces;
+  int64_t pieces_capacity;
+  int64_t pieces_length;
+  int64_t batch_rows;
+
+  struct ArrowError error;
+};
+
+// Sum the buffer sizes of an ArrowArrayView and its children
+static int64_t ArrowRechunkArrayStreamSizeBytes(const struct ArrowArrayView* array_view) {
+  int64_t size_bytes = 0;
+  for (int i = 0; i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
+    size_bytes += array_view->buffer_views[i].size_bytes;
+  }
+
+  for (int32_t i = 0; i < array_view->n_variadic_buffers; i++) {
+    size_bytes += array_view->variadic_buffer_sizes[i];
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    size_bytes += ArrowRechunkArrayStreamSizeBytes(array_view->children[i]);
+  }
+
+  if (array_view->dictionary != NULL) {
+    size_bytes += ArrowRechunkArrayStreamSizeBytes(array_view->dictionary);
+  }
+
+  return size_bytes;
+}
+
+// Compute the number of rows to emit in the next batch based on the array that
+// will be used to start it
+static ArrowErrorCode ArrowRechunkArrayStreamTargetRows(
+    struct RechunkArrayStreamPrivate* private_data, int64_t* out) {
+  int64_t target_rows = private_data->target_rows > 0 ? private_data->target_rows
+                                                      : INT64_MAX;
+  if (private_data->target_bytes > 0) {
+    NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(
+        &private_data->array_view, &private_data->current, &private_data->error));
+    int64_t total_length = private_data->current.offset + private_data->current.length;
+    int64_t size_bytes = ArrowRechunkArrayStreamSizeBytes(&private_data->array_view);
+    int64_t bytes_per_row = size_bytes / total_length;
+    if (bytes_per_row < 1) {
+      bytes_per_row = 1;
+    }
+
+    int64_t target_rows_from_bytes = private_data->target_bytes / bytes_per_row;
+    if (target_rows_from_bytes < 1) {
+      target_rows_from_bytes = 1;
+    }
+
+    if (target_rows_from_bytes < target_rows) {
+      target_rows = target_rows_from_bytes;
+    }
+  }
+
+  *out = target_rows;
+  return NANOARROW_OK;
+}
+
+// Make sure private_data->current contains an array with unconsumed rows or is
+// released at the end of the input
+static ArrowErrorCode ArrowRechunkArrayStreamAdvance(
+    struct RechunkArrayStreamPrivate* private_data) {
+  while (private_data->current.release == NULL ||
+         private_data->current_offset == private_data->current.length) {
+    if (private_data->current.release != NULL) {
+      ArrowArrayRelease(&private_data->current);
+    }
+
+    private_data->current_offset = 0;
+    int result = ArrowArrayStreamGetNext(&private_data->src, &private_data->current,
+                                         &private_data->error);
+    if (result != NANOARROW_OK) {
+      private_data->current.release = NULL;
+      return result;
+    }
+
+    if (private_data->current.release == NULL) {
+      return NANOARROW_OK;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+static void ArrowRechunkArrayStreamReleasePieces(
+    struct RechunkArrayStreamPrivate* private_data) {
+  for (int64_t i = 0; i < private_data->n_pieces; i++) {
+    if (private_data->pieces[i].release != NULL) {
+      ArrowArrayRelease(&private_data->pieces[i]);
+    }
+  }
+
+  private_data->n_pieces = 0;
+  private_data->pieces_length = 0;
+}
+
+static ArrowErrorCode ArrowRechunkArrayStreamAddPiece(
+    struct RechunkArrayStreamPrivate* private_data, int64_t length) {
+  if (private_data->n_pieces == private_data->pieces_capacity) {
+    int64_t new_capacity =
+        private_data->pieces_capacity == 0 ? 8 : private_data->pieces_capacity * 2;
+    struct ArrowArray* new_pieces = (struct ArrowArray*)ArrowRealloc(
+        private_data->pieces, sizeof(struct ArrowArray) * new_capacity);
+    if (new_pieces == NULL) {
+      return ENOMEM;
+    }
+
+    private_data->pieces = new_pieces;
+    private_data->pieces_capacity = new_capacity;
+  }
+
+  struct ArrowArray* piece = private_data->pieces + private_data->n_pieces;
+  if (private_data->current_offset == 0 && length == private_data->current.length) {
+    ArrowArrayMove(&private_data->current, piece);
+  } else {
+    // Slicing consumes an array that doesn't already share its buffers, so the input
+    // is replaced with a shared copy of itself before the first piece is taken
+    if (!ArrowArrayIsShared(&private_data->current)) {
+      struct ArrowArray shared;
+      NANOARROW_RETURN_NOT_OK(ArrowArraySlice(&private_data->current, 0,
+                                              private_data->current.length, &shared));
+      ArrowArrayMove(&shared, &private_data->current);
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowArraySlice(
+        &private_data->current, private_data->current_offset, length, piece));
+    private_data->current_offset += length;
+  }
+
+  private_data->n_pieces++;
+  private_data->pieces_length += length;
+  return NANOARROW_OK;
+}
+
+static int ArrowRechunkArrayStreamGetSchema(struct ArrowArrayStream* array_stream,
+                                            struct ArrowSchema* schema) {
+  struct RechunkArrayStreamPrivate* private_data =
+      (struct RechunkArrayStreamPrivate*)array_stream->private_data;
+  return ArrowSchemaDeepCopy(&private_data->schema, schema);
+}
+
+static int ArrowRechunkArrayStreamGetNextInternal(
+    struct RechunkArrayStreamPrivate* private_data, struct ArrowArray* array) {
+  // If a previous call failed, continue with the pieces it collected
+  if (private_data->n_pieces == 0) {
+    NANOARROW_RETURN_NOT_OK(ArrowRechunkArrayStreamAdvance(private_data));
+    if (private_data->current.release == NULL) {
+      array->release = NULL;
+      return NANOARROW_OK;
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        ArrowRechunkArrayStreamTargetRows(private_data, &private_data->batch_rows));
+  }
+
+  // Collect slices of input arrays until batch_rows is reached or the input is
+  // exhausted
+  while (private_data->pieces_length < private_data->batch_rows) {
+    NANOARROW_RETURN_NOT_OK(ArrowRechunkArrayStreamAdvance(private_data));
+    if (private_data->current.release == NULL) {
+      break;
+    }
+
+    int64_t length = private_data->current.length - private_data->current_offset;
+    if (length > (private_data->batch_rows - private_data->pieces_length)) {
+      length = private_data->batch_rows - private_data->pieces_length;
+    }
+
+    NANOARROW_RETURN_NOT_OK(ArrowRechunkArrayStreamAddPiece(private_data, length));
+  }
+
+  // A single piece (e.g., a slice of a larger input array) is emitted without copying
+  if (private_data->n_pieces == 1) {
+    ArrowArrayMove(&private_data->pieces[0], array);
+    private_data->n_pieces = 0;
+    private_data->pieces_length = 0;
+    return NANOARROW_OK;
+  }
+
+  // Otherwise, the pieces are copied into a single array
+  struct ArrowArray** arrays = (struct ArrowArray**)ArrowMalloc(
+      sizeof(struct ArrowArray*) * private_data->n_pieces);
+  if (arrays == NULL) {
+    return ENOMEM;
+  }
+
+  for (int64_t i = 0; i < private_data->n_pieces; i++) {
+    arrays[i] = private_data->pieces + i;
+  }
+
+  int result = ArrowArrayConcatenate(&private_data->schema, arrays,
+                                     private_data->n_pieces, array, &private_data->error);
+  ArrowFree(arrays);
+  NANOARROW_RETURN_NOT_OK(result);
+
+  ArrowRechunkArrayStreamReleasePieces(private_data);
+  return NANOARROW_OK;
+}
+
+static int ArrowRechunkArrayStreamGetNext(struct ArrowArrayStream* array_stream,
+                                          struct ArrowArray* array) {
+  struct RechunkArrayStreamPrivate* private_data =
+      (struct RechunkArrayStreamPrivate*)array_stream->private_data;
+  ArrowErrorInit(&private_data->error);
+  return ArrowRechunkArrayStreamGetNextInternal(private_data, array);
+}
+
+static const char* ArrowRechunkArrayStreamGetLastError(
+    struct ArrowArrayStream* array_stream) {
+  struct RechunkArrayStreamPrivate* private_data =
+      (struct RechunkArrayStreamPrivate*)array_stream->private_data;
+  return private_data->error.message;
+}
+
+static void ArrowRechunkArrayStreamRelease(struct ArrowArrayStream* array_stream) {
+  if (array_stream == NULL || array_stream->release == NULL) {
+    return;
+  }
+
+  struct RechunkArrayStreamPrivate* private_data =
+      (struct RechunkArrayStreamPrivate*)array_stream->private_data;
+
+  ArrowRechunkArrayStreamReleasePieces(private_data);
+  ArrowFree(private_data->pieces);
+
+  if (private_data->current.release != NULL) {
+    ArrowArrayRelease(&private_data->current);
+  }
+
+  ArrowArrayViewReset(&private_data->array_view);
+
+  if (private_data->schema.release != NULL) {
+    ArrowSchemaRelease(&private_data->schema);
+  }
+
+  if (private_data->src.release != NULL) {
+    ArrowArrayStreamRelease(&private_data->src);
+  }
+
+  ArrowFree(private_data);
+  array_stream->release = NULL;
+}
+
+ArrowErrorCode ArrowRechunkArrayStreamInit(struct ArrowArrayStream* array_stream,
+                                           struct ArrowArrayStream* src,
+                                           int64_t target_rows, int64_t target_bytes,
+                                           struct ArrowError* error) {
+  if (target_rows <= 0 && target_bytes <= 0) {
+    ArrowErrorSet(error, "Expected target_rows > 0 or target_bytes > 0");
+    return EINVAL;
+  }
+
+  struct RechunkArrayStreamPrivate* private_data =
+      (struct RechunkArrayStreamPrivate*)ArrowMalloc(
+          sizeof(struct RechunkArrayStreamPrivate));
+  if (private_data == NULL) {
+    ArrowErrorSet(error, "Failed to allocate RechunkArrayStreamPrivate");
+    return ENOMEM;
+  }
+
+  memset(private_data, 0, sizeof(struct RechunkArrayStreamPrivate));
+  ArrowArrayViewInitFromType(&private_data->array_view, NANOARROW_TYPE_UNINITIALIZED);
+  private_data->target_rows = target_rows;
+  private_data->target_bytes = target_bytes;
+
+  int result = ArrowArrayStreamGetSchema(src, &private_data->schema, error);
+  if (result == NANOARROW_OK) {
+    ArrowArrayViewReset(&private_data->array_view);
+    result = ArrowArrayViewInitFromSchema(&private_data->array_view,
+                                          &private_data->schema, error);
+  }
+
+  if (result != NANOARROW_OK) {
+    if (private_data->schema.release != NULL) {
+      ArrowSchemaRelease(&private_data->schema);
+    }
+
+    ArrowFree(private_data);
+    return result;
+  }
+
+  ArrowArrayStreamMove(src, &private_data->src);
+
+  array_stream->get_schema = &ArrowRechunkArrayStreamGetSchema;
+  array_stream->get_next = &ArrowRechunkArrayStreamGetNext;
+  array_stream->get_last_error = &ArrowRechunkArrayStreamGetLastError;
+  array_stream->release = &ArrowRechunkArrayStreamRelease;
+  array_stream->private_data = private_data;
+  return NANOARROW_OK;
+}
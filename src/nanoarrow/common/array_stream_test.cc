@@ -125,3 +125,200 @@ TEST(ArrayStreamTest, ArrayStreamTestInvalid) {
 
   ArrowArrayStreamRelease(&array_stream);
 }
+
+// Create a stream of int32 arrays with the given lengths whose values are
+// 0, 1, 2, ... across all arrays
+static void MakeSequenceStream(struct ArrowArrayStream* array_stream,
+                               const std::vector<int64_t>& lengths) {
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowBasicArrayStreamInit(array_stream, schema.get(),
+                                      static_cast<int64_t>(lengths.size())),
+            NANOARROW_OK);
+
+  int32_t value = 0;
+  for (size_t i = 0; i < lengths.size(); i++) {
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    for (int64_t j = 0; j < lengths[i]; j++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array.get(), value++), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+    ArrowBasicArrayStreamSetArray(array_stream, static_cast<int64_t>(i), array.get());
+  }
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestRechunkRows) {
+  nanoarrow::UniqueArrayStream src;
+  MakeSequenceStream(src.get(), {3, 4, 25, 0, 2, 6});
+
+  nanoarrow::UniqueArrayStream array_stream;
+  ASSERT_EQ(ArrowRechunkArrayStreamInit(array_stream.get(), src.get(), 10, 0, nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(src->release, nullptr);
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowArrayStreamGetSchema(array_stream.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema->format, "i");
+
+  std::vector<int64_t> lengths;
+  std::vector<int64_t> offsets;
+  int32_t expected_value = 0;
+  nanoarrow::ViewArrayStream array_stream_view(array_stream.get());
+  for (ArrowArray& array : array_stream_view) {
+    lengths.push_back(array.length);
+    offsets.push_back(array.offset);
+    for (auto value : nanoarrow::ViewArrayAs<int32_t>(&array)) {
+      EXPECT_EQ(value, expected_value++);
+    }
+  }
+
+  EXPECT_EQ(array_stream_view.code(), NANOARROW_OK);
+  EXPECT_EQ(expected_value, 40);
+  EXPECT_THAT(lengths, ElementsAre(10, 10, 10, 10));
+
+  // Arrays made of a single slice of an input array keep its offset; arrays that
+  // combine several input arrays are copied
+  EXPECT_THAT(offsets, ElementsAre(0, 3, 13, 0));
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestRechunkZeroCopy) {
+  nanoarrow::UniqueArrayStream src;
+  MakeSequenceStream(src.get(), {25});
+
+  nanoarrow::UniqueArrayStream array_stream;
+  ASSERT_EQ(ArrowRechunkArrayStreamInit(array_stream.get(), src.get(), 10, 0, nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray first;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), first.get(), nullptr),
+            NANOARROW_OK);
+  nanoarrow::UniqueArray second;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), second.get(), nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray third;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), third.get(), nullptr),
+            NANOARROW_OK);
+
+  // Every slice shares the input buffers
+  for (struct ArrowArray* array : {first.get(), second.get(), third.get()}) {
+    EXPECT_TRUE(ArrowArrayIsShared(array));
+    EXPECT_EQ(array->buffers[1], first->buffers[1]);
+  }
+
+  EXPECT_EQ(second->offset, 10);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(second.get()),
+              ElementsAre(10, 11, 12, 13, 14, 15, 16, 17, 18, 19));
+  EXPECT_EQ(third->offset, 20);
+  EXPECT_EQ(third->length, 5);
+}
+
+// An ArrowArrayStream that forwards another stream but fails once when get_next()
+// is called for the fail_at-th time
+struct FailOnceArrayStream {
+  nanoarrow::UniqueArrayStream src;
+  int64_t n_calls{0};
+  int64_t fail_at{0};
+
+  static int GetSchema(struct ArrowArrayStream* stream, struct ArrowSchema* schema) {
+    auto self = reinterpret_cast<FailOnceArrayStream*>(stream->private_data);
+    return ArrowArrayStreamGetSchema(self->src.get(), schema, nullptr);
+  }
+
+  static int GetNext(struct ArrowArrayStream* stream, struct ArrowArray* array) {
+    auto self = reinterpret_cast<FailOnceArrayStream*>(stream->private_data);
+    if (++self->n_calls == self->fail_at) {
+      return EIO;
+    }
+
+    return ArrowArrayStreamGetNext(self->src.get(), array, nullptr);
+  }
+
+  static const char* GetLastError(struct ArrowArrayStream*) { return "fail once"; }
+
+  static void Release(struct ArrowArrayStream* stream) {
+    delete reinterpret_cast<FailOnceArrayStream*>(stream->private_data);
+    stream->release = nullptr;
+  }
+
+  static void Export(FailOnceArrayStream* self, struct ArrowArrayStream* out) {
+    out->get_schema = &GetSchema;
+    out->get_next = &GetNext;
+    out->get_last_error = &GetLastError;
+    out->release = &Release;
+    out->private_data = self;
+  }
+};
+
+TEST(ArrayStreamTest, ArrayStreamTestRechunkResumesAfterError) {
+  // The third call fails after the first two arrays were collected for a batch
+  auto failing = new FailOnceArrayStream();
+  MakeSequenceStream(failing->src.get(), {3, 4, 25});
+  failing->fail_at = 3;
+  nanoarrow::UniqueArrayStream src;
+  FailOnceArrayStream::Export(failing, src.get());
+
+  nanoarrow::UniqueArrayStream array_stream;
+  ASSERT_EQ(ArrowRechunkArrayStreamInit(array_stream.get(), src.get(), 10, 0, nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray out;
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), out.get(), nullptr), EIO);
+
+  // No rows are lost when the next call succeeds
+  std::vector<int64_t> lengths;
+  int32_t expected_value = 0;
+  nanoarrow::ViewArrayStream array_stream_view(array_stream.get());
+  for (ArrowArray& array : array_stream_view) {
+    lengths.push_back(array.length);
+    for (auto value : nanoarrow::ViewArrayAs<int32_t>(&array)) {
+      EXPECT_EQ(value, expected_value++);
+    }
+  }
+
+  EXPECT_EQ(array_stream_view.code(), NANOARROW_OK);
+  EXPECT_EQ(expected_value, 32);
+  EXPECT_THAT(lengths, ElementsAre(10, 10, 10, 2));
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestRechunkBytes) {
+  nanoarrow::UniqueArrayStream src;
+  MakeSequenceStream(src.get(), {12});
+
+  // Four bytes per row with no validity buffer
+  nanoarrow::UniqueArrayStream array_stream;
+  ASSERT_EQ(ArrowRechunkArrayStreamInit(array_stream.get(), src.get(), 0, 20, nullptr),
+            NANOARROW_OK);
+
+  std::vector<int64_t> lengths;
+  nanoarrow::ViewArrayStream array_stream_view(array_stream.get());
+  for (ArrowArray& array : array_stream_view) {
+    lengths.push_back(array.length);
+  }
+
+  EXPECT_EQ(array_stream_view.code(), NANOARROW_OK);
+  EXPECT_THAT(lengths, ElementsAre(5, 5, 2));
+}
+
+TEST(ArrayStreamTest, ArrayStreamTestRechunkInvalid) {
+  nanoarrow::UniqueArrayStream src;
+  MakeSequenceStream(src.get(), {});
+
+  struct ArrowError error;
+  nanoarrow::UniqueArrayStream array_stream;
+  EXPECT_EQ(ArrowRechunkArrayStreamInit(array_stream.get(), src.get(), 0, 0, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected target_rows > 0 or target_bytes > 0");
+  EXPECT_NE(src->release, nullptr);
+
+  // An empty input results in an empty output
+  ASSERT_EQ(ArrowRechunkArrayStreamInit(array_stream.get(), src.get(), 10, 0, &error),
+            NANOARROW_OK);
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(array->release, nullptr);
+}
@@ -860,6 +860,56 @@ TEST(ArrayTest, ArrayTestAppendToFloatArray) {
 #endif
 }
 
+TEST(ArrayTest, ArrayTestAppendFloatN) {
+  std::vector<float> values = {1.0f, -2.5f, 3.14159f, INFINITY, 65520.0f, 0.0f,
+                               1e-6f, -0.0f, 100.0f};
+
+  for (const auto type :
+       {NANOARROW_TYPE_HALF_FLOAT, NANOARROW_TYPE_FLOAT, NANOARROW_TYPE_DOUBLE}) {
+    SCOPED_TRACE(ArrowTypeString(type));
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromType(array.get(), type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendFloatN(array.get(), values.data(), 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendFloatN(array.get(), values.data() + 2,
+                                     static_cast<int64_t>(values.size() - 2)),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+    EXPECT_EQ(array->length, 10);
+    EXPECT_EQ(array->null_count, 1);
+    auto validity_buffer = reinterpret_cast<const uint8_t*>(array->buffers[0]);
+    EXPECT_EQ(validity_buffer[0], 0b11111011);
+    EXPECT_EQ(validity_buffer[1], 0b00000011);
+
+    nanoarrow::UniqueArrayView array_view;
+    ArrowArrayViewInitFromType(array_view.get(), type);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+              NANOARROW_OK);
+
+    std::vector<double> actual;
+    for (int64_t i = 0; i < array->length; i++) {
+      if (i != 2) {
+        actual.push_back(ArrowArrayViewGetDoubleUnsafe(array_view.get(), i));
+      }
+    }
+
+    if (type == NANOARROW_TYPE_HALF_FLOAT) {
+      // Values are rounded to the nearest half float
+      EXPECT_EQ(actual, std::vector<double>({1.0, -2.5, 3.140625, INFINITY, INFINITY,
+                                             0.0, 1.0132789611816406e-06, -0.0, 100.0}));
+    } else {
+      EXPECT_EQ(actual, std::vector<double>(values.begin(), values.end()));
+    }
+  }
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayAppendFloatN(array.get(), values.data(), 1), EINVAL);
+}
+
 TEST(ArrayTest, ArrayTestAppendToHalfFloatArray) {
   struct ArrowArray array;
 
@@ -888,9 +938,9 @@ TEST(ArrayTest, ArrayTestAppendToHalfFloatArray) {
   EXPECT_EQ(data_buffer[1], 0);
   EXPECT_EQ(data_buffer[2], 0);
   EXPECT_FLOAT_EQ(ArrowHalfFloatToFloat(data_buffer[3]), 3.0);
-  EXPECT_FLOAT_EQ(ArrowHalfFloatToFloat(data_buffer[4]), static_cast<float>(3.138672));
-  EXPECT_FLOAT_EQ(ArrowHalfFloatToFloat(data_buffer[5]),
-                  std::numeric_limits<float>::max());
+  // Values are rounded to the nearest half float and overflow to infinity
+  EXPECT_FLOAT_EQ(ArrowHalfFloatToFloat(data_buffer[4]), 3.140625);
+  EXPECT_EQ(ArrowHalfFloatToFloat(data_buffer[5]), INFINITY);
   EXPECT_TRUE(std::isnan(ArrowHalfFloatToFloat(data_buffer[6])));
   EXPECT_FLOAT_EQ(ArrowHalfFloatToFloat(data_buffer[7]), INFINITY);
   EXPECT_FLOAT_EQ(ArrowHalfFloatToFloat(data_buffer[8]), -INFINITY);
@@ -3886,6 +3936,77 @@ TEST(ArrayTest, ArrayViewTestUnionChildIndices) {
   ArrowArrayRelease(&array);
 }
 
+TEST(ArrayTest, ArrayViewTestInitFromSchemaViewTree) {
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormat(schema->children[0], "+us:6,2"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema->children[0], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0]->children[0],
+                                    NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0]->children[1],
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema->children[1]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[1]->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeFixedSize(schema->children[2],
+                                        NANOARROW_TYPE_FIXED_SIZE_LIST, 3),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_DOUBLE),
+            NANOARROW_OK);
+
+  struct ArrowSchemaViewTree tree;
+  ASSERT_EQ(ArrowSchemaViewTreeInit(&tree, schema.get(), nullptr), NANOARROW_OK);
+
+  // Initializing more than one ArrowArrayView from the same tree should give
+  // the same result as ArrowArrayViewInitFromSchema()
+  nanoarrow::UniqueArrayView expected;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(expected.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+
+  for (int i = 0; i < 2; i++) {
+    nanoarrow::UniqueArrayView array_view;
+    ASSERT_EQ(ArrowArrayViewInitFromSchemaViewTree(array_view.get(), &tree, nullptr),
+              NANOARROW_OK);
+
+    EXPECT_EQ(array_view->storage_type, NANOARROW_TYPE_STRUCT);
+    ASSERT_EQ(array_view->n_children, 3);
+
+    struct ArrowArrayView* union_view = array_view->children[0];
+    EXPECT_EQ(union_view->storage_type, NANOARROW_TYPE_SPARSE_UNION);
+    ASSERT_EQ(union_view->n_children, 2);
+    EXPECT_EQ(union_view->children[0]->storage_type, NANOARROW_TYPE_INT32);
+    EXPECT_EQ(union_view->children[1]->storage_type, NANOARROW_TYPE_STRING);
+    ASSERT_NE(union_view->union_type_id_map, nullptr);
+    EXPECT_EQ(memcmp(union_view->union_type_id_map,
+                     expected->children[0]->union_type_id_map, 256),
+              0);
+
+    struct ArrowArrayView* dict_view = array_view->children[1];
+    EXPECT_EQ(dict_view->storage_type, NANOARROW_TYPE_INT16);
+    EXPECT_EQ(dict_view->n_children, 0);
+    ASSERT_NE(dict_view->dictionary, nullptr);
+    EXPECT_EQ(dict_view->dictionary->storage_type, NANOARROW_TYPE_STRING);
+
+    struct ArrowArrayView* list_view = array_view->children[2];
+    EXPECT_EQ(list_view->storage_type, NANOARROW_TYPE_FIXED_SIZE_LIST);
+    EXPECT_EQ(list_view->layout.child_size_elements, 3);
+    ASSERT_EQ(list_view->n_children, 1);
+    EXPECT_EQ(list_view->children[0]->storage_type, NANOARROW_TYPE_DOUBLE);
+  }
+
+  ArrowSchemaViewTreeReset(&tree);
+
+  struct ArrowArrayView array_view;
+  struct ArrowError error;
+  EXPECT_EQ(ArrowArrayViewInitFromSchemaViewTree(&array_view, &tree, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected initialized ArrowSchemaViewTree");
+}
+
 TEST(ArrayTest, ArrayViewTestDenseUnionGet) {
   struct ArrowArrayView array_view;
   struct ArrowArray array;
@@ -3978,6 +4099,1111 @@ TEST(ArrayTest, ArrayViewTestSparseUnionGet) {
   ArrowArrayRelease(&array);
 }
 
+TEST(ArrayTest, ArrayTestSlice) {
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+  for (int i = 3; i <= 6; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.get(), i), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  const void* data_buffer = array->buffers[1];
+
+  nanoarrow::UniqueArray out;
+  EXPECT_EQ(ArrowArraySlice(array.get(), 5, 2, out.get()), EINVAL);
+  EXPECT_EQ(ArrowArraySlice(array.get(), -1, 2, out.get()), EINVAL);
+  EXPECT_EQ(ArrowArraySlice(array.get(), 0, -1, out.get()), EINVAL);
+
+  EXPECT_NE(array->release, nullptr);
+
+  // Slicing an array that doesn't share its buffers moves it into out without copying
+  // buffers. The full range retains the null count.
+  nanoarrow::UniqueArray shared;
+  ASSERT_EQ(ArrowArraySlice(array.get(), 0, 6, shared.get()), NANOARROW_OK);
+  EXPECT_EQ(array->release, nullptr);
+  EXPECT_EQ(ArrowArrayIsShared(shared.get()), 1);
+  EXPECT_EQ(shared->buffers[1], data_buffer);
+  EXPECT_EQ(shared->null_count, 1);
+
+  // Slicing a shared array doesn't modify it
+  nanoarrow::UniqueArray slice;
+  ASSERT_EQ(ArrowArraySlice(shared.get(), 1, 4, slice.get()), NANOARROW_OK);
+  EXPECT_EQ(shared->buffers[1], data_buffer);
+  EXPECT_EQ(slice->buffers[1], data_buffer);
+  EXPECT_EQ(slice->offset, 1);
+  EXPECT_EQ(slice->length, 4);
+  EXPECT_EQ(slice->null_count, -1);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(shared.get()),
+              ElementsAre(1, NA, 3, 4, 5, 6));
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(slice.get()), ElementsAre(NA, 3, 4, 5));
+
+  // Slicing a slice shares the same buffers
+  nanoarrow::UniqueArray slice2;
+  ASSERT_EQ(ArrowArraySlice(slice.get(), 2, 2, slice2.get()), NANOARROW_OK);
+  EXPECT_EQ(slice2->buffers[1], data_buffer);
+  EXPECT_EQ(slice2->offset, 3);
+
+  ASSERT_EQ(ArrowArraySlice(slice.get(), 4, 0, out.get()), NANOARROW_OK);
+  EXPECT_EQ(out->length, 0);
+  EXPECT_EQ(out->null_count, 0);
+  out.reset();
+
+  // Buffers must remain valid until the last reference is released
+  shared.reset();
+  slice.reset();
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(slice2.get()), ElementsAre(4, 5));
+}
+
+TEST(ArrayTest, ArrayTestSliceRejectsBuilders) {
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array.get(), "abc"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayIsShared(array.get()), 0);
+
+  // The slice has no builder private data
+  nanoarrow::UniqueArray slice;
+  ASSERT_EQ(ArrowArraySlice(array.get(), 0, 1, slice.get()), NANOARROW_OK);
+  EXPECT_EQ(array->release, nullptr);
+
+  struct ArrowError error;
+  EXPECT_EQ(ArrowArrayIsShared(slice.get()), 1);
+  EXPECT_EQ(ArrowArrayStartAppending(slice.get()), EINVAL);
+  EXPECT_EQ(ArrowArrayShrinkToFit(slice.get()), EINVAL);
+  EXPECT_EQ(ArrowArrayReserve(slice.get(), 1), EINVAL);
+
+  nanoarrow::UniqueBuffer buffer;
+  EXPECT_EQ(ArrowArraySetBuffer(slice.get(), 1, buffer.get()), EINVAL);
+
+  EXPECT_EQ(ArrowArrayFinishBuildingDefault(slice.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Can't finish building an array that shares its buffers");
+
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(slice.get()), ElementsAre("abc"_asv));
+}
+
+TEST(ArrayTest, ArrayTestSliceChildren) {
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->children[0], "abc"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->children[0], "defg"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArray slice;
+  ASSERT_EQ(ArrowArraySlice(array.get(), 1, 1, slice.get()), NANOARROW_OK);
+  ASSERT_EQ(slice->n_children, 1);
+  EXPECT_EQ(slice->children[0]->offset, 0);
+  EXPECT_EQ(slice->children[0]->length, 2);
+
+  // Children of a slice may be moved out and outlive their parent
+  nanoarrow::UniqueArray child;
+  ArrowArrayMove(slice->children[0], child.get());
+  slice.reset();
+  array.reset();
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(child.get()),
+              ElementsAre("abc"_asv, "defg"_asv));
+}
+
+// ArrowArraySlice() consumes an array that doesn't already share its buffers, so
+// tests that take several slices of an array first replace it with a shared copy
+static void ShareArray(struct ArrowArray* array) {
+  if (ArrowArrayIsShared(array)) {
+    return;
+  }
+
+  nanoarrow::UniqueArray shared;
+  ASSERT_EQ(ArrowArraySlice(array, 0, array->length, shared.get()), NANOARROW_OK);
+  ArrowArrayMove(shared.get(), array);
+}
+
+// Concatenating slices that cover array should reproduce it exactly. Because bits
+// past the end of a validity bitmap are not initialized by the append functions,
+// arrays with a validity buffer should have a length that is a multiple of 8.
+static void ExpectConcatenatedSlicesIdentical(struct ArrowSchema* schema,
+                                              struct ArrowArray* array) {
+  const int64_t n = array->length;
+  const std::vector<std::pair<int64_t, int64_t>> ranges = {
+      {0, n / 3}, {n / 3, 0}, {n / 3, n - n / 3 - 1}, {n - 1, 1}};
+
+  ShareArray(array);
+  std::vector<nanoarrow::UniqueArray> slices(ranges.size());
+  std::vector<struct ArrowArray*> slice_ptrs;
+  for (size_t i = 0; i < ranges.size(); i++) {
+    ASSERT_EQ(ArrowArraySlice(array, ranges[i].first, ranges[i].second, slices[i].get()),
+              NANOARROW_OK);
+    slice_ptrs.push_back(slices[i].get());
+  }
+
+  struct ArrowError error;
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayConcatenate(schema, slice_ptrs.data(),
+                                  static_cast<int64_t>(slice_ptrs.size()), out.get(),
+                                  &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueArrayView actual;
+  nanoarrow::UniqueArrayView expected;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(actual.get(), schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(expected.get(), schema, &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(actual.get(), out.get(), &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowArrayViewValidate(actual.get(), NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowArrayViewSetArray(expected.get(), array, &error), NANOARROW_OK);
+
+  int is_equal = 0;
+  ASSERT_EQ(ArrowArrayViewCompare(actual.get(), expected.get(),
+                                  NANOARROW_COMPARE_IDENTICAL, &is_equal, &error),
+            NANOARROW_OK);
+  EXPECT_TRUE(is_equal) << error.message;
+}
+
+TEST(ArrayTest, ArrayTestConcatenatePrimitive) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+
+  for (auto type : {NANOARROW_TYPE_INT32, NANOARROW_TYPE_BOOL, NANOARROW_TYPE_DOUBLE}) {
+    schema.reset();
+    array.reset();
+    ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    for (int i = 0; i < 40; i++) {
+      if (i % 5 == 1) {
+        ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendInt(array.get(), i % 3), NANOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+    ExpectConcatenatedSlicesIdentical(schema.get(), array.get());
+  }
+
+  // Zero arrays results in an empty array
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayConcatenate(schema.get(), nullptr, 0, out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(out->length, 0);
+
+  // Arrays without a validity buffer mixed with arrays with one
+  nanoarrow::UniqueArray no_nulls;
+  ASSERT_EQ(ArrowArrayInitFromSchema(no_nulls.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(no_nulls.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(no_nulls.get(), 10), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(no_nulls.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(no_nulls->buffers[0], nullptr);
+
+  struct ArrowArray* arrays[] = {no_nulls.get(), array.get(), no_nulls.get()};
+  out.reset();
+  ASSERT_EQ(ArrowArrayConcatenate(schema.get(), arrays, 3, out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(out->length, 42);
+  EXPECT_EQ(out->null_count, array->null_count);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), out.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.get(), 0), 10);
+  EXPECT_TRUE(ArrowArrayViewIsNull(array_view.get(), 2));
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.get(), 3), 2);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.get(), 41), 10);
+
+  // The same concatenation described by array views
+  nanoarrow::UniqueArrayView no_nulls_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(no_nulls_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(no_nulls_view.get(), no_nulls.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  const struct ArrowArrayView* array_views[] = {no_nulls_view.get(), array_view.get(),
+                                                no_nulls_view.get()};
+  nanoarrow::UniqueArray out_views;
+  ASSERT_EQ(ArrowArrayConcatenateViews(schema.get(), array_views, 3, out_views.get(),
+                                       nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(out_views->length, 42);
+  EXPECT_EQ(out_views->null_count, array->null_count);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), out_views.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.get(), 0), 10);
+  EXPECT_TRUE(ArrowArrayViewIsNull(array_view.get(), 2));
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.get(), 3), 2);
+  EXPECT_EQ(ArrowArrayViewGetDoubleUnsafe(array_view.get(), 41), 10);
+  EXPECT_EQ(ArrowArrayConcatenateViews(schema.get(), nullptr, -1, out_views.get(),
+                                       nullptr),
+            EINVAL);
+}
+
+TEST(ArrayTest, ArrayTestConcatenateBinary) {
+  for (auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_BINARY,
+                    NANOARROW_TYPE_STRING_VIEW}) {
+    nanoarrow::UniqueSchema schema;
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), type), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    std::vector<std::string> expected;
+    for (int i = 0; i < 24; i++) {
+      if (i % 7 == 3) {
+        ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+        expected.push_back("<null>");
+      } else {
+        std::string value = std::string(static_cast<size_t>(i), 'a') + std::to_string(i);
+        ASSERT_EQ(ArrowArrayAppendString(array.get(), ArrowCharView(value.c_str())),
+                  NANOARROW_OK);
+        expected.push_back(value);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+    if (type != NANOARROW_TYPE_STRING_VIEW) {
+      ExpectConcatenatedSlicesIdentical(schema.get(), array.get());
+      continue;
+    }
+
+    // String view data buffers are copied whole, so check the values instead
+    ShareArray(array.get());
+    nanoarrow::UniqueArray first;
+    nanoarrow::UniqueArray second;
+    ASSERT_EQ(ArrowArraySlice(array.get(), 0, 15, first.get()), NANOARROW_OK);
+    ASSERT_EQ(ArrowArraySlice(array.get(), 12, 12, second.get()), NANOARROW_OK);
+    struct ArrowArray* arrays[] = {first.get(), second.get()};
+    nanoarrow::UniqueArray out;
+    ASSERT_EQ(ArrowArrayConcatenate(schema.get(), arrays, 2, out.get(), nullptr),
+              NANOARROW_OK);
+
+    nanoarrow::UniqueArrayView array_view;
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), out.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(array_view->length, 27);
+    for (int64_t i = 0; i < array_view->length; i++) {
+      const std::string& value = expected[i < 15 ? i : i - 3];
+      if (ArrowArrayViewIsNull(array_view.get(), i)) {
+        EXPECT_EQ(value, "<null>");
+      } else {
+        struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(array_view.get(), i);
+        EXPECT_EQ(std::string(item.data, static_cast<size_t>(item.size_bytes)), value);
+      }
+    }
+  }
+}
+
+TEST(ArrayTest, ArrayTestConcatenateNested) {
+  // list<int32>, fixed_size_list<int32, 2>, and struct<int32, string>
+  for (int i = 0; i < 3; i++) {
+    nanoarrow::UniqueSchema schema;
+    ArrowSchemaInit(schema.get());
+    if (i == 0) {
+      ASSERT_EQ(ArrowSchemaSetType(schema.get(), NANOARROW_TYPE_LIST), NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32),
+                NANOARROW_OK);
+    } else if (i == 1) {
+      ASSERT_EQ(ArrowSchemaSetTypeFixedSize(schema.get(), NANOARROW_TYPE_FIXED_SIZE_LIST,
+                                            2),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32),
+                NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 2), NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_STRING),
+                NANOARROW_OK);
+    }
+
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    for (int j = 0; j < 16; j++) {
+      if (j % 4 == 2) {
+        ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+        continue;
+      }
+
+      if (i == 0) {
+        for (int k = 0; k < j % 3; k++) {
+          ASSERT_EQ(ArrowArrayAppendInt(array->children[0], j * 10 + k), NANOARROW_OK);
+        }
+      } else if (i == 1) {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], j), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], -j), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], j), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayAppendString(array->children[1], "abc"_asv), NANOARROW_OK);
+      }
+      ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+    ExpectConcatenatedSlicesIdentical(schema.get(), array.get());
+  }
+}
+
+TEST(ArrayTest, ArrayTestConcatenateListView) {
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetType(schema.get(), NANOARROW_TYPE_LIST_VIEW), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  for (int j = 0; j < 16; j++) {
+    if (j % 4 == 2) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+      continue;
+    }
+
+    for (int k = 0; k < j % 3; k++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[0], j * 10 + k), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  ShareArray(array.get());
+  nanoarrow::UniqueArray first;
+  nanoarrow::UniqueArray second;
+  ASSERT_EQ(ArrowArraySlice(array.get(), 3, 6, first.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArraySlice(array.get(), 7, 9, second.get()), NANOARROW_OK);
+  struct ArrowArray* arrays[] = {first.get(), second.get()};
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayConcatenate(schema.get(), arrays, 2, out.get(), nullptr),
+            NANOARROW_OK);
+
+  // Only the referenced range of each child is copied
+  EXPECT_EQ(out->children[0]->length, 6 + 6);
+
+  nanoarrow::UniqueArrayView actual;
+  nanoarrow::UniqueArrayView expected;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(actual.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(expected.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(actual.get(), out.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowArrayViewValidate(actual.get(), NANOARROW_VALIDATION_LEVEL_FULL, nullptr),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(expected.get(), array.get(), nullptr), NANOARROW_OK);
+
+  ASSERT_EQ(actual->length, 15);
+  for (int64_t i = 0; i < actual->length; i++) {
+    const int64_t j = i < 6 ? i + 3 : i + 1;
+    ASSERT_EQ(ArrowArrayViewIsNull(actual.get(), i),
+              ArrowArrayViewIsNull(expected.get(), j));
+    const int32_t size = actual->buffer_views[2].data.as_int32[i];
+    ASSERT_EQ(size, expected->buffer_views[2].data.as_int32[j]);
+    const int32_t actual_offset = actual->buffer_views[1].data.as_int32[i];
+    const int32_t expected_offset = expected->buffer_views[1].data.as_int32[j];
+    for (int32_t k = 0; k < size; k++) {
+      EXPECT_EQ(ArrowArrayViewGetIntUnsafe(actual->children[0], actual_offset + k),
+                ArrowArrayViewGetIntUnsafe(expected->children[0], expected_offset + k));
+    }
+  }
+}
+
+TEST(ArrayTest, ArrayTestConcatenateUnion) {
+  for (auto type : {NANOARROW_TYPE_SPARSE_UNION, NANOARROW_TYPE_DENSE_UNION}) {
+    nanoarrow::UniqueSchema schema;
+    ArrowSchemaInit(schema.get());
+    ASSERT_EQ(ArrowSchemaSetTypeUnion(schema.get(), type, 2), NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT64),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_STRING),
+              NANOARROW_OK);
+
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    for (int i = 0; i < 16; i++) {
+      if (i % 3 == 0) {
+        ASSERT_EQ(ArrowArrayAppendString(array->children[1], "abc"_asv), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayFinishUnionElement(array.get(), 1), NANOARROW_OK);
+      } else if (i % 5 == 0) {
+        ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayFinishUnionElement(array.get(), 0), NANOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+    ExpectConcatenatedSlicesIdentical(schema.get(), array.get());
+  }
+}
+
+TEST(ArrayTest, ArrayTestConcatenateRunEndEncoded) {
+  // [1, 1, 1, 1, null, null, 2, 3, 3, 3]
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(schema.get(), NANOARROW_TYPE_INT16),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  for (int run_end : {4, 6, 7, 10}) {
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], run_end), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendInt(array->children[1], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array->children[1], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array->children[1], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array->children[1], 3), NANOARROW_OK);
+  array->length = 10;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  // Slices that start and end in the middle of runs
+  ShareArray(array.get());
+  nanoarrow::UniqueArray first;
+  nanoarrow::UniqueArray second;
+  ASSERT_EQ(ArrowArraySlice(array.get(), 2, 3, first.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArraySlice(array.get(), 5, 4, second.get()), NANOARROW_OK);
+  struct ArrowArray* arrays[] = {first.get(), second.get(), array.get()};
+
+  struct ArrowError error;
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayConcatenate(schema.get(), arrays, 3, out.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(out->length, 17);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int16_t>(out->children[0]),
+              ElementsAre(2, 3, 4, 5, 7, 11, 13, 14, 17));
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(out->children[1]),
+              ElementsAre(1, NA, NA, 2, 3, 1, NA, 2, 3));
+}
+
+TEST(ArrayTest, ArrayTestConcatenateDictionary) {
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->dictionary, "abc"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->dictionary, "def"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  struct ArrowArray* arrays[] = {array.get(), array.get()};
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayConcatenate(schema.get(), arrays, 2, out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int8_t>(out.get()), ElementsAre(1, NA, 0, 3, NA, 2));
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(out->dictionary),
+              ElementsAre("abc"_asv, "def"_asv, "abc"_asv, "def"_asv));
+
+  // Dictionaries that can't be indexed by the index type
+  nanoarrow::UniqueArray big;
+  ASSERT_EQ(ArrowArrayInitFromSchema(big.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(big.get()), NANOARROW_OK);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(ArrowArrayAppendString(big->dictionary, "abc"_asv), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(big.get(), nullptr), NANOARROW_OK);
+
+  struct ArrowError error;
+  struct ArrowArray* big_arrays[] = {big.get(), big.get()};
+  out.reset();
+  EXPECT_EQ(ArrowArrayConcatenate(schema.get(), big_arrays, 2, out.get(), &error),
+            EOVERFLOW);
+  EXPECT_STREQ(error.message,
+               "Concatenated dictionary of length 200 can't be indexed by an index type "
+               "with maximum value 127");
+}
+
+// Build a 16-element array of the given type with nulls at every fourth element
+static void MakeSelectionTestArray(enum ArrowType type, struct ArrowSchema* schema,
+                                   struct ArrowArray* array) {
+  ArrowSchemaInit(schema);
+  switch (type) {
+    case NANOARROW_TYPE_LIST:
+    case NANOARROW_TYPE_LIST_VIEW:
+      ASSERT_EQ(ArrowSchemaSetType(schema, type), NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32),
+                NANOARROW_OK);
+      break;
+    case NANOARROW_TYPE_FIXED_SIZE_LIST:
+      ASSERT_EQ(ArrowSchemaSetTypeFixedSize(schema, type, 2), NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32),
+                NANOARROW_OK);
+      break;
+    case NANOARROW_TYPE_STRUCT:
+      ASSERT_EQ(ArrowSchemaSetTypeStruct(schema, 2), NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_STRING),
+                NANOARROW_OK);
+      break;
+    case NANOARROW_TYPE_SPARSE_UNION:
+    case NANOARROW_TYPE_DENSE_UNION:
+      ASSERT_EQ(ArrowSchemaSetTypeUnion(schema, type, 2), NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_STRING),
+                NANOARROW_OK);
+      break;
+    default:
+      ASSERT_EQ(ArrowSchemaSetType(schema, type), NANOARROW_OK);
+      break;
+  }
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int i = 0; i < 16; i++) {
+    if (i % 4 == 2) {
+      ASSERT_EQ(ArrowArrayAppendNull(array, 1), NANOARROW_OK);
+      continue;
+    }
+
+    std::string value = std::string(static_cast<size_t>(i), 'x') + std::to_string(i);
+    struct ArrowStringView value_view = ArrowCharView(value.c_str());
+    switch (type) {
+      case NANOARROW_TYPE_LIST:
+      case NANOARROW_TYPE_LIST_VIEW:
+        for (int k = 0; k < i % 3; k++) {
+          ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i * 10 + k), NANOARROW_OK);
+        }
+        ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+        break;
+      case NANOARROW_TYPE_FIXED_SIZE_LIST:
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], -i), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+        break;
+      case NANOARROW_TYPE_STRUCT:
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayAppendString(array->children[1], value_view), NANOARROW_OK);
+        ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+        break;
+      case NANOARROW_TYPE_SPARSE_UNION:
+      case NANOARROW_TYPE_DENSE_UNION:
+        if (i % 3 == 0) {
+          ASSERT_EQ(ArrowArrayAppendString(array->children[1], value_view), NANOARROW_OK);
+          ASSERT_EQ(ArrowArrayFinishUnionElement(array, 1), NANOARROW_OK);
+        } else {
+          ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i), NANOARROW_OK);
+          ASSERT_EQ(ArrowArrayFinishUnionElement(array, 0), NANOARROW_OK);
+        }
+        break;
+      case NANOARROW_TYPE_STRING:
+      case NANOARROW_TYPE_LARGE_BINARY:
+      case NANOARROW_TYPE_STRING_VIEW:
+        ASSERT_EQ(ArrowArrayAppendString(array, value_view), NANOARROW_OK);
+        break;
+      default:
+        ASSERT_EQ(ArrowArrayAppendInt(array, i % 5), NANOARROW_OK);
+        break;
+    }
+  }
+
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+// Taking elements should be equivalent to concatenating single-element slices
+static void ExpectTakeMatchesSlices(struct ArrowSchema* schema, struct ArrowArray* array,
+                                    const std::vector<int64_t>& indices) {
+  ShareArray(array);
+  struct ArrowError error;
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array, &error), NANOARROW_OK);
+
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayTake(array_view.get(), indices.data(),
+                           static_cast<int64_t>(indices.size()), out.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+
+  std::vector<nanoarrow::UniqueArray> slices(indices.size());
+  std::vector<struct ArrowArray*> slice_ptrs;
+  for (size_t i = 0; i < indices.size(); i++) {
+    ASSERT_EQ(ArrowArraySlice(array, indices[i], 1, slices[i].get()), NANOARROW_OK);
+    slice_ptrs.push_back(slices[i].get());
+  }
+
+  nanoarrow::UniqueArray expected;
+  ASSERT_EQ(ArrowArrayConcatenate(schema, slice_ptrs.data(),
+                                  static_cast<int64_t>(slice_ptrs.size()), expected.get(),
+                                  &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueArrayView actual_view;
+  nanoarrow::UniqueArrayView expected_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(actual_view.get(), schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(expected_view.get(), schema, &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(actual_view.get(), out.get(), &error), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowArrayViewValidate(actual_view.get(), NANOARROW_VALIDATION_LEVEL_FULL, &error),
+      NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowArrayViewSetArray(expected_view.get(), expected.get(), &error),
+            NANOARROW_OK);
+
+  int is_equal = 0;
+  ASSERT_EQ(ArrowArrayViewCompare(actual_view.get(), expected_view.get(),
+                                  NANOARROW_COMPARE_IDENTICAL, &is_equal, &error),
+            NANOARROW_OK);
+  EXPECT_TRUE(is_equal) << ArrowTypeString(array_view->storage_type) << ": "
+                        << error.message;
+}
+
+TEST(ArrayTest, ArrayTestTake) {
+  const std::vector<int64_t> indices = {5, 0, 0, 9, 3, 12, 15, 8, 8, 1, 2};
+  const std::vector<int64_t> sliced_indices = {5, 0, 0, 9, 3, 12, 8, 8, 1, 2};
+
+  for (auto type :
+       {NANOARROW_TYPE_INT32, NANOARROW_TYPE_BOOL, NANOARROW_TYPE_DOUBLE,
+        NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_BINARY, NANOARROW_TYPE_LIST,
+        NANOARROW_TYPE_LIST_VIEW, NANOARROW_TYPE_FIXED_SIZE_LIST, NANOARROW_TYPE_STRUCT,
+        NANOARROW_TYPE_SPARSE_UNION, NANOARROW_TYPE_DENSE_UNION}) {
+    nanoarrow::UniqueSchema schema;
+    nanoarrow::UniqueArray array;
+    MakeSelectionTestArray(type, schema.get(), array.get());
+    ExpectTakeMatchesSlices(schema.get(), array.get(), indices);
+
+    // Selecting from an array with an offset
+    nanoarrow::UniqueArray sliced;
+    ASSERT_EQ(ArrowArraySlice(array.get(), 3, 13, sliced.get()), NANOARROW_OK);
+    ExpectTakeMatchesSlices(schema.get(), sliced.get(), sliced_indices);
+
+    // Selecting nothing
+    ExpectTakeMatchesSlices(schema.get(), array.get(), {});
+  }
+}
+
+TEST(ArrayTest, ArrayTestTakeInvalid) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  MakeSelectionTestArray(NANOARROW_TYPE_INT32, schema.get(), array.get());
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  struct ArrowError error;
+  nanoarrow::UniqueArray out;
+  int64_t indices[] = {0, 16};
+  EXPECT_EQ(ArrowArrayTake(array_view.get(), indices, 2, out.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Index 16 is out of range for array of length 16");
+  EXPECT_EQ(out->release, nullptr);
+}
+
+TEST(ArrayTest, ArrayTestFilter) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  MakeSelectionTestArray(NANOARROW_TYPE_STRING, schema.get(), array.get());
+
+  // Elements 0-7 and 9, 11, and 15 (a full byte followed by a partial byte)
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  uint8_t mask[] = {0xff, 0x8a};
+
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayFilter(array_view.get(), mask, out.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(out->length, 11);
+  EXPECT_EQ(out->null_count, 2);
+  EXPECT_THAT(
+      nanoarrow::ViewArrayAsBytes<32>(out.get()),
+      ElementsAre("0"_asv, "x1"_asv, NA, "xxx3"_asv, "xxxx4"_asv, "xxxxx5"_asv, NA,
+                  "xxxxxxx7"_asv, "xxxxxxxxx9"_asv, "xxxxxxxxxxx11"_asv,
+                  "xxxxxxxxxxxxxxx15"_asv));
+
+  // A mask that does not span whole bytes
+  array_view->length = 11;
+  uint8_t partial_mask[] = {0x00, 0x04};
+  out.reset();
+  ASSERT_EQ(ArrowArrayFilter(array_view.get(), partial_mask, out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(out.get()), ElementsAre(NA));
+}
+
+TEST(ArrayTest, ArrayTestTakeStringView) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  MakeSelectionTestArray(NANOARROW_TYPE_STRING_VIEW, schema.get(), array.get());
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  int64_t indices[] = {15, 1, 13, 14};
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayTake(array_view.get(), indices, 4, out.get(), nullptr),
+            NANOARROW_OK);
+
+  // Only out-of-line data for the selected elements is copied
+  nanoarrow::UniqueArrayView out_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(out_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(out_view.get(), out.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(out_view->n_variadic_buffers, 1);
+  EXPECT_EQ(out_view->variadic_buffer_sizes[0], 17 + 15);
+  EXPECT_THAT(nanoarrow::ViewBinaryViewArrayAsBytes(out_view.get()),
+              ElementsAre("xxxxxxxxxxxxxxx15"_asv, "x1"_asv, "xxxxxxxxxxxxx13"_asv, NA));
+}
+
+TEST(ArrayTest, ArrayTestTakeRunEndEncoded) {
+  // [1, 1, 1, 1, null, null, 2, 3, 3, 3]
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(schema.get(), NANOARROW_TYPE_INT16),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  for (int run_end : {4, 6, 7, 10}) {
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], run_end), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendInt(array->children[1], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array->children[1], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array->children[1], 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array->children[1], 3), NANOARROW_OK);
+  array->length = 10;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  // Consecutive elements from the same run are merged
+  int64_t indices[] = {0, 3, 9, 8, 4, 6, 1};
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayTake(array_view.get(), indices, 7, out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(out->length, 7);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int16_t>(out->children[0]),
+              ElementsAre(2, 4, 5, 6, 7));
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(out->children[1]),
+              ElementsAre(1, 3, NA, 2, 1));
+}
+
+TEST(ArrayTest, ArrayTestTakeDictionary) {
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->dictionary, "abc"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->dictionary, "def"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 0), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  int64_t indices[] = {2, 1, 0};
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayTake(array_view.get(), indices, 3, out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int8_t>(out.get()), ElementsAre(0, NA, 1));
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(out->dictionary),
+              ElementsAre("abc"_asv, "def"_asv));
+}
+
+TEST(ArrayTest, ArrayTestDictionaryBuilder) {
+  struct ArrowDictionaryBuilder builder;
+  ASSERT_EQ(ArrowDictionaryBuilderInit(&builder, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, "abc"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, "def"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendNull(&builder, 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, "abc"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, ""_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, "def"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, ""_asv), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowDictionaryBuilderFinish(&builder, array.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(array->length, 8);
+  EXPECT_EQ(array->null_count, 2);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(array.get()),
+              ElementsAre(0, 1, NA, NA, 0, 2, 1, 2));
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(array->dictionary),
+              ElementsAre("abc"_asv, "def"_asv, ""_asv));
+
+  // The builder can be reused and starts with a new dictionary
+  ASSERT_EQ(ArrowDictionaryBuilderAppendString(&builder, "def"_asv), NANOARROW_OK);
+  array.reset();
+  ASSERT_EQ(ArrowDictionaryBuilderFinish(&builder, array.get(), nullptr), NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(array.get()), ElementsAre(0));
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(array->dictionary),
+              ElementsAre("def"_asv));
+
+  ArrowDictionaryBuilderReset(&builder);
+
+  EXPECT_EQ(ArrowDictionaryBuilderInit(&builder, NANOARROW_TYPE_INT32), EINVAL);
+}
+
+TEST(ArrayTest, ArrayTestDictionaryBuilderArrayView) {
+  // Enough distinct values to grow the hash table several times
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+  nanoarrow::UniqueArray values;
+  ASSERT_EQ(ArrowArrayInitFromSchema(values.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(values.get()), NANOARROW_OK);
+  for (int i = 0; i < 10000; i++) {
+    if (i % 7 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(values.get(), 1), NANOARROW_OK);
+    } else {
+      std::string value = "value" + std::to_string(i % 1000);
+      ASSERT_EQ(ArrowArrayAppendString(values.get(), ArrowCharView(value.c_str())),
+                NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(values.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView values_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(values_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(values_view.get(), values.get(), nullptr),
+            NANOARROW_OK);
+
+  // Encode a slice of the values to check that the offset is respected
+  values_view->offset = 1;
+  values_view->length = 9999;
+
+  struct ArrowDictionaryBuilder builder;
+  ASSERT_EQ(ArrowDictionaryBuilderInit(&builder, NANOARROW_TYPE_BINARY), NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, values_view.get(), nullptr),
+            NANOARROW_OK);
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowDictionaryBuilderFinish(&builder, array.get(), nullptr), NANOARROW_OK);
+  ArrowDictionaryBuilderReset(&builder);
+
+  nanoarrow::UniqueSchema dictionary_schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(dictionary_schema.get(), NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(dictionary_schema.get()), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowSchemaInitFromType(dictionary_schema->dictionary, NANOARROW_TYPE_BINARY),
+      NANOARROW_OK);
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(
+      ArrowArrayViewInitFromSchema(array_view.get(), dictionary_schema.get(), nullptr),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(array_view.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+                                   nullptr),
+            NANOARROW_OK);
+
+  EXPECT_EQ(array->length, 9999);
+  EXPECT_EQ(array->null_count, 9999 / 7);
+  EXPECT_EQ(array->dictionary->length, 1000);
+  for (int64_t i = 0; i < array->length; i++) {
+    ASSERT_EQ(ArrowArrayViewIsNull(array_view.get(), i),
+              ArrowArrayViewIsNull(values_view.get(), i));
+    if (ArrowArrayViewIsNull(array_view.get(), i)) {
+      continue;
+    }
+
+    int64_t index = ArrowArrayViewGetIntUnsafe(array_view.get(), i);
+    struct ArrowBufferView expected = ArrowArrayViewGetBytesUnsafe(values_view.get(), i);
+    struct ArrowBufferView actual =
+        ArrowArrayViewGetBytesUnsafe(array_view->dictionary, index);
+    ASSERT_EQ(std::string(actual.data.as_char, actual.size_bytes),
+              std::string(expected.data.as_char, expected.size_bytes));
+  }
+
+  // Non-string input is an error
+  nanoarrow::UniqueArrayView int_view;
+  ArrowArrayViewInitFromType(int_view.get(), NANOARROW_TYPE_INT32);
+  struct ArrowError error;
+  ASSERT_EQ(ArrowDictionaryBuilderInit(&builder, NANOARROW_TYPE_STRING), NANOARROW_OK);
+  EXPECT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, int_view.get(), &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Can't dictionary-encode array of type int32");
+  ArrowDictionaryBuilderReset(&builder);
+}
+
+TEST(ArrayTest, ArrayTestDictionaryBuilderStringView) {
+  nanoarrow::UniqueArrayView values_view;
+  nanoarrow::UniqueArray values;
+  ASSERT_EQ(ArrowArrayInitFromType(values.get(), NANOARROW_TYPE_STRING_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(values.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(values.get(), "a string longer than 12"_asv),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(values.get(), "short"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(values.get(), "a string longer than 12"_asv),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(values.get(), nullptr), NANOARROW_OK);
+  ArrowArrayViewInitFromType(values_view.get(), NANOARROW_TYPE_STRING_VIEW);
+  ASSERT_EQ(ArrowArrayViewSetArray(values_view.get(), values.get(), nullptr),
+            NANOARROW_OK);
+
+  struct ArrowDictionaryBuilder builder;
+  ASSERT_EQ(ArrowDictionaryBuilderInit(&builder, NANOARROW_TYPE_LARGE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowDictionaryBuilderAppendArrayView(&builder, values_view.get(), nullptr),
+            NANOARROW_OK);
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowDictionaryBuilderFinish(&builder, array.get(), nullptr), NANOARROW_OK);
+  ArrowDictionaryBuilderReset(&builder);
+
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(array.get()), ElementsAre(0, 1, 0));
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<64>(array->dictionary),
+              ElementsAre("a string longer than 12"_asv, "short"_asv));
+}
+
+TEST(ArrayTest, ArrayTestDictionaryDecode) {
+  // Null indices and null dictionary values both produce null elements
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT16), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->dictionary, NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->dictionary, "abc"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array->dictionary, 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(array->dictionary, "defg"_asv), NANOARROW_OK);
+  for (int index : {2, 0, -1, 1, 2, 2, -1, 0, 0}) {
+    if (index == -1) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array.get(), index), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayDictionaryDecode(array_view.get(), out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(out->length, 9);
+  EXPECT_EQ(out->null_count, 3);
+  EXPECT_EQ(out->dictionary, nullptr);
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(out.get()),
+              ElementsAre("defg"_asv, "abc"_asv, NA, NA, "defg"_asv, "defg"_asv, NA,
+                          "abc"_asv, "abc"_asv));
+
+  // Null indices gather the shortest dictionary value (here, the null one)
+  const int32_t* offsets = reinterpret_cast<const int32_t*>(out->buffers[1]);
+  EXPECT_EQ(offsets[3] - offsets[2], 0);
+  EXPECT_EQ(offsets[7] - offsets[6], 0);
+
+  // With an offset
+  array_view->offset = 4;
+  array_view->length = 5;
+  out.reset();
+  ASSERT_EQ(ArrowArrayDictionaryDecode(array_view.get(), out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(out->null_count, 1);
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(out.get()),
+              ElementsAre("defg"_asv, "defg"_asv, NA, "abc"_asv, "abc"_asv));
+}
+
+TEST(ArrayTest, ArrayTestDictionaryDecodeFixedWidth) {
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_UINT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->dictionary, NANOARROW_TYPE_DOUBLE),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(array->dictionary, 1.5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDouble(array->dictionary, 2.5), NANOARROW_OK);
+  for (int index : {1, 1, 0, 1}) {
+    ASSERT_EQ(ArrowArrayAppendInt(array.get(), index), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray out;
+  ASSERT_EQ(ArrowArrayDictionaryDecode(array_view.get(), out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<double>(out.get()),
+              ElementsAre(2.5, 2.5, 1.5, 2.5, NA));
+
+  // Out-of-range index
+  struct ArrowError error;
+  reinterpret_cast<uint8_t*>(ArrowArrayBuffer(array.get(), 1)->data)[2] = 2;
+  out.reset();
+  EXPECT_EQ(ArrowArrayDictionaryDecode(array_view.get(), out.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Index 2 is out of range for dictionary of length 2");
+
+  // All-null indices into an empty dictionary
+  array.reset();
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(array.get(), 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  out.reset();
+  ASSERT_EQ(ArrowArrayDictionaryDecode(array_view.get(), out.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<double>(out.get()), ElementsAre(NA, NA, NA));
+
+  // Not a dictionary
+  nanoarrow::UniqueArrayView int_view;
+  ArrowArrayViewInitFromType(int_view.get(), NANOARROW_TYPE_INT32);
+  out.reset();
+  EXPECT_EQ(ArrowArrayDictionaryDecode(int_view.get(), out.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Can't decode ArrowArrayView without a dictionary");
+}
+
 // In Arrow C++, HalfFloatType::ctype gives uint16_t; however, this is not
 // the "value type" that would correspond to what ArrowArrayViewGetDoubleUnsafe()
 // or ArrowArrayAppendDouble() do since they operate on the logical/represented
@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef NANOARROW_COMMON_ATOMIC_INTERNAL_H_INCLUDED
+#define NANOARROW_COMMON_ATOMIC_INTERNAL_H_INCLUDED
+
+// Internal header shared by the nanoarrow and nanoarrow_ipc sources (it is not
+// installed and is inlined into the bundled sources).
+//
+// For thread safe reference counts we need C11 + stdatomic.h
+// Can compile with -DNANOARROW_USE_STDATOMIC=0 or 1 to override
+// automatic detection. For the IPC extension, -DNANOARROW_IPC_USE_STDATOMIC=0 or 1
+// is also accepted.
+#if !defined(NANOARROW_USE_STDATOMIC) && defined(NANOARROW_IPC_USE_STDATOMIC)
+#define NANOARROW_USE_STDATOMIC NANOARROW_IPC_USE_STDATOMIC
+#endif
+
+#if !defined(NANOARROW_USE_STDATOMIC)
+#define NANOARROW_USE_STDATOMIC 0
+
+// Check for C11
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+
+// Check for GCC 4.8, which doesn't include stdatomic.h but does
+// not define __STDC_NO_ATOMICS__
+#if defined(__clang__) || !defined(__GNUC__) || __GNUC__ >= 5
+
+#if !defined(__STDC_NO_ATOMICS__)
+#undef NANOARROW_USE_STDATOMIC
+#define NANOARROW_USE_STDATOMIC 1
+#endif
+#endif
+#endif
+
+#endif
+
+#if NANOARROW_USE_STDATOMIC
+#include <stdatomic.h>
+#endif
+
+#endif
@@ -120,6 +120,11 @@ static inline int8_t _ArrowUnionTypeIdsWillEqualChildIndices(const char* type_id
 }
 
 static inline ArrowErrorCode ArrowArrayStartAppending(struct ArrowArray* array) {
+  // Arrays that share their buffers (i.e., slices) don't have builder private data
+  if (ArrowArrayIsShared(array)) {
+    return EINVAL;
+  }
+
   struct ArrowArrayPrivateData* private_data =
       (struct ArrowArrayPrivateData*)array->private_data;
 
@@ -165,6 +170,10 @@ static inline ArrowErrorCode ArrowArrayStartAppending(struct ArrowArray* array)
 }
 
 static inline ArrowErrorCode ArrowArrayShrinkToFit(struct ArrowArray* array) {
+  if (ArrowArrayIsShared(array)) {
+    return EINVAL;
+  }
+
   for (int64_t i = 0; i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
     struct ArrowBuffer* buffer = ArrowArrayBuffer(array, i);
     NANOARROW_RETURN_NOT_OK(ArrowBufferResize(buffer, buffer->size_bytes, 1));
@@ -491,6 +500,45 @@ static inline ArrowErrorCode ArrowArrayAppendDouble(struct ArrowArray* array,
   return NANOARROW_OK;
 }
 
+static inline ArrowErrorCode ArrowArrayAppendFloatN(struct ArrowArray* array,
+                                                    const float* values, int64_t n) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  struct ArrowBuffer* data_buffer = ArrowArrayBuffer(array, 1);
+
+  switch (private_data->storage_type) {
+    case NANOARROW_TYPE_DOUBLE:
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferReserve(data_buffer, n * (int64_t)sizeof(double)));
+      for (int64_t i = 0; i < n; i++) {
+        ((double*)(data_buffer->data + data_buffer->size_bytes))[i] = values[i];
+      }
+      data_buffer->size_bytes += n * (int64_t)sizeof(double);
+      break;
+    case NANOARROW_TYPE_FLOAT:
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferAppend(data_buffer, values, n * (int64_t)sizeof(float)));
+      break;
+    case NANOARROW_TYPE_HALF_FLOAT:
+      NANOARROW_RETURN_NOT_OK(
+          ArrowBufferReserve(data_buffer, n * (int64_t)sizeof(uint16_t)));
+      ArrowFloatToHalfFloatN(values,
+                             (uint16_t*)(data_buffer->data + data_buffer->size_bytes), n);
+      data_buffer->size_bytes += n * (int64_t)sizeof(uint16_t);
+      break;
+    default:
+      return EINVAL;
+  }
+
+  if (private_data->bitmap.buffer.data != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, n));
+  }
+
+  array->length += n;
+  return NANOARROW_OK;
+}
+
 // Binary views only have two fixed buffers, but be aware that they must also
 // always have more 1 buffer to store variadic buffer sizes (even if there are none)
 #define NANOARROW_BINARY_VIEW_FIXED_BUFFERS 2
@@ -80,55 +80,73 @@ static inline int64_t _ArrowGrowByFactor(int64_t current_capacity, int64_t new_c
   }
 }
 
-// float to half float conversion, adapted from Arrow Go
-// https://github.com/apache/arrow/blob/main/go/arrow/float16/float16.go
+// IEEE 754 float to half float conversion with round-to-nearest-even and support
+// for subnormal values such that the result matches hardware conversion instructions
 static inline uint16_t ArrowFloatToHalfFloat(float value) {
-  union {
-    float f;
-    uint32_t b;
-  } u;
-  u.f = value;
-
-  uint16_t sn = (uint16_t)((u.b >> 31) & 0x1);
-  uint16_t exp = (u.b >> 23) & 0xff;
-  int16_t res = (int16_t)(exp - 127 + 15);
-  uint16_t fc = (uint16_t)(u.b >> 13) & 0x3ff;
-
-  if (exp == 0) {
-    res = 0;
-  } else if (exp == 0xff) {
-    res = 0x1f;
-  } else if (res > 0x1e) {
-    res = 0x1f;
-    fc = 0;
-  } else if (res < 0x01) {
-    res = 0;
-    fc = 0;
-  }
-
-  return (uint16_t)((sn << 15) | (uint16_t)(res << 10) | fc);
-}
-
-// half float to float conversion, adapted from Arrow Go
-// https://github.com/apache/arrow/blob/main/go/arrow/float16/float16.go
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(uint32_t));
+  uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+  uint32_t abs_bits = bits & 0x7fffffff;
+
+  if (abs_bits >= 0x7f800000) {
+    // Infinity or NaN (NaNs are quieted and keep the high bits of their payload)
+    if (abs_bits == 0x7f800000) {
+      return (uint16_t)(sign | 0x7c00);
+    } else {
+      return (uint16_t)(sign | 0x7e00 | ((abs_bits >> 13) & 0x3ff));
+    }
+  } else if (abs_bits >= 0x477ff000) {
+    // Values that round to a magnitude greater than 65504 overflow to infinity
+    return (uint16_t)(sign | 0x7c00);
+  } else if (abs_bits >= 0x38800000) {
+    // Normal half float: rebias the exponent and round the mantissa
+    abs_bits += 0xfff + ((abs_bits >> 13) & 1);
+    return (uint16_t)(sign | ((abs_bits - 0x38000000) >> 13));
+  } else if (abs_bits <= 0x33000000) {
+    // Values with a magnitude of 2^-25 or less round to zero
+    return sign;
+  } else {
+    // Subnormal half float: shift the mantissa with its implicit leading bit
+    uint32_t shift = 126 - (abs_bits >> 23);
+    uint32_t mantissa = (abs_bits & 0x7fffff) | 0x800000;
+    uint32_t result = mantissa >> shift;
+    uint32_t remainder = mantissa & ((1U << shift) - 1);
+    uint32_t halfway = 1U << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (result & 1))) {
+      result++;
+    }
+
+    return (uint16_t)(sign | result);
+  }
+}
+
+// half float to float conversion (which is always exact), including subnormal values
 static inline float ArrowHalfFloatToFloat(uint16_t value) {
-  uint32_t sn = (uint32_t)((value >> 15) & 0x1);
+  uint32_t sign = (uint32_t)(value & 0x8000) << 16;
   uint32_t exp = (value >> 10) & 0x1f;
-  uint32_t res = exp + 127 - 15;
-  uint32_t fc = value & 0x3ff;
+  uint32_t mantissa = value & 0x3ff;
+  uint32_t bits;
+
+  if (exp == 0x1f) {
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  } else if (exp != 0) {
+    bits = sign | ((exp + 127 - 15) << 23) | (mantissa << 13);
+  } else if (mantissa == 0) {
+    bits = sign;
+  } else {
+    // Normalize the subnormal value
+    exp = 127 - 15 + 1;
+    while ((mantissa & 0x400) == 0) {
+      mantissa <<= 1;
+      exp--;
+    }
 
-  if (exp == 0) {
-    res = 0;
-  } else if (exp == 0x1f) {
-    res = 0xff;
+    bits = sign | (exp << 23) | ((mantissa & 0x3ff) << 13);
   }
 
-  union {
-    float f;
-    uint32_t b;
-  } u;
-  u.b = (uint32_t)(sn << 31) | (uint32_t)(res << 23) | (uint32_t)(fc << 13);
-  return u.f;
+  float out;
+  memcpy(&out, &bits, sizeof(float));
+  return out;
 }
 
 static inline void ArrowBufferInit(struct ArrowBuffer* buffer) {
@@ -331,6 +349,35 @@ static inline int64_t _ArrowBytesForBits(int64_t bits) {
   return (bits >> 3) + ((bits & 7) != 0);
 }
 
+// A word-at-a-time multiply/rotate hash used by the hash tables in nanoarrow
+// (e.g., ArrowDictionaryBuilder, ArrowMetadataIndex). This only needs to be good
+// enough to distribute values across a table and its values are not stable across
+// versions.
+static inline uint64_t _ArrowHashBytes(const uint8_t* data, int64_t size) {
+  uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)size;
+  uint64_t word;
+
+  while (size >= 8) {
+    memcpy(&word, data, sizeof(uint64_t));
+    hash ^= word * 0xBF58476D1CE4E5B9ULL;
+    hash = ((hash << 31) | (hash >> 33)) * 0x94D049BB133111EBULL;
+    data += 8;
+    size -= 8;
+  }
+
+  if (size > 0) {
+    word = 0;
+    memcpy(&word, data, (size_t)size);
+    hash ^= word * 0xBF58476D1CE4E5B9ULL;
+    hash = ((hash << 31) | (hash >> 33)) * 0x94D049BB133111EBULL;
+  }
+
+  hash ^= hash >> 32;
+  hash *= 0xD6E8FEB86659FD93ULL;
+  hash ^= hash >> 32;
+  return hash;
+}
+
 static inline void _ArrowBitsUnpackInt8(const uint8_t word, int8_t* out) {
   out[0] = (word & 0x1) != 0;
   out[1] = (word & 0x2) != 0;
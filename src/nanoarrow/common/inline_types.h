@@ -214,6 +214,20 @@ typedef int ArrowErrorCode;
 #define NANOARROW_FLAG_ALL_SUPPORTED \
   (ARROW_FLAG_DICTIONARY_ORDERED | ARROW_FLAG_NULLABLE | ARROW_FLAG_MAP_KEYS_SORTED)
 
+/// \brief Options for ArrowSchemaHash() and ArrowSchemaEquals()
+///
+/// By default, only the type information of each node (its format string,
+/// flags other than ARROW_FLAG_NULLABLE, children, and dictionary) is considered.
+/// \ingroup nanoarrow-schema
+/// @{
+#define NANOARROW_SCHEMA_COMPARE_NAMES 1
+#define NANOARROW_SCHEMA_COMPARE_METADATA 2
+#define NANOARROW_SCHEMA_COMPARE_NULLABILITY 4
+#define NANOARROW_SCHEMA_COMPARE_ALL                                         \
+  (NANOARROW_SCHEMA_COMPARE_NAMES | NANOARROW_SCHEMA_COMPARE_METADATA | \
+   NANOARROW_SCHEMA_COMPARE_NULLABILITY)
+/// @}
+
 /// \brief Error type containing a UTF-8 encoded message.
 /// \ingroup nanoarrow-errors
 struct ArrowError {
@@ -317,6 +331,68 @@ static inline void ArrowErrorSetString(struct ArrowError* error, const char* src
 #define NANOARROW_DCHECK(EXPR)
 #endif
 
+/// \brief Instrumented points recorded when built with NANOARROW_ENABLE_TRACING
+/// \ingroup nanoarrow-tracing
+enum ArrowTraceEvent {
+  /// \brief Finalizing buffers in ArrowArrayFinishBuilding() (excluding validation)
+  NANOARROW_TRACE_ARRAY_FINISH_BUILDING,
+  /// \brief Validating an ArrowArrayView
+  NANOARROW_TRACE_ARRAY_VIEW_VALIDATE,
+  /// \brief Reading bytes from an ArrowIpcInputStream
+  NANOARROW_TRACE_IPC_READ_INPUT,
+  /// \brief Verifying a flatbuffer message header
+  NANOARROW_TRACE_IPC_VERIFY_HEADER,
+  /// \brief Decoding a message header
+  NANOARROW_TRACE_IPC_DECODE_HEADER,
+  /// \brief Decompressing a message body buffer
+  NANOARROW_TRACE_IPC_DECOMPRESS,
+  /// \brief Allocating (and copying into) message body or output buffers
+  NANOARROW_TRACE_IPC_ALLOCATE_BUFFER,
+  /// \brief Swapping the endianness of a message body buffer
+  NANOARROW_TRACE_IPC_SWAP_ENDIAN,
+  /// \brief Encoding a record batch message and its body
+  NANOARROW_TRACE_IPC_ENCODE_RECORD_BATCH,
+  /// \brief The number of values in this enumerator
+  NANOARROW_TRACE_NUM_EVENTS
+};
+
+/// \brief Accumulated timers and counters for each ArrowTraceEvent
+/// \ingroup nanoarrow-tracing
+struct ArrowTraceStats {
+  /// \brief The number of times each event was recorded
+  int64_t count[NANOARROW_TRACE_NUM_EVENTS];
+  /// \brief The total wall time spent in each event in nanoseconds
+  int64_t elapsed_ns[NANOARROW_TRACE_NUM_EVENTS];
+  /// \brief The total number of bytes processed by each event (zero for events that
+  /// do not process a known number of bytes, such as validation)
+  int64_t bytes[NANOARROW_TRACE_NUM_EVENTS];
+};
+
+/// \brief Callback invoked each time an event is recorded
+/// \ingroup nanoarrow-tracing
+typedef void (*ArrowTraceCallback)(enum ArrowTraceEvent event, int64_t elapsed_ns,
+                                   int64_t bytes, void* private_data);
+
+#if defined(NANOARROW_ENABLE_TRACING)
+/// \brief Start a timer for an instrumented section
+/// \ingroup nanoarrow-tracing
+///
+/// Declares a local variable NAME holding the current time. If nanoarrow was not
+/// built with NANOARROW_ENABLE_TRACING, this statement has no effect.
+#define NANOARROW_TRACE_BEGIN(NAME) const int64_t NAME = ArrowTraceNowNs()
+
+/// \brief Record the time elapsed since NANOARROW_TRACE_BEGIN(NAME) for an event
+/// \ingroup nanoarrow-tracing
+///
+/// If nanoarrow was not built with NANOARROW_ENABLE_TRACING, this statement has
+/// no effect and BYTES is not evaluated.
+#define NANOARROW_TRACE_END(EVENT, NAME, BYTES) \
+  ArrowTraceRecord(EVENT, ArrowTraceNowNs() - (NAME), (int64_t)(BYTES))
+#else
+#define NANOARROW_TRACE_BEGIN(NAME)
+#define NANOARROW_TRACE_END(EVENT, NAME, BYTES)
+#endif
+
 static inline void ArrowSchemaMove(struct ArrowSchema* src, struct ArrowSchema* dst) {
   NANOARROW_DCHECK(src != NULL);
   NANOARROW_DCHECK(dst != NULL);
@@ -877,6 +953,22 @@ struct ArrowArrayPrivateData {
   int64_t list_view_offset;
 };
 
+/// \brief A builder for dictionary-encoded string and binary arrays
+/// \ingroup nanoarrow-dictionary-builder
+///
+/// This structure should be initialized with ArrowDictionaryBuilderInit() and
+/// released with ArrowDictionaryBuilderReset().
+struct ArrowDictionaryBuilder {
+  /// \brief The int32 indices being built with the dictionary values attached
+  struct ArrowArray array;
+
+  /// \brief An open-addressing hash table mapping values to dictionary indices
+  struct ArrowBuffer table;
+
+  /// \brief The number of slots in table (always a power of two)
+  int64_t table_capacity;
+};
+
 /// \brief A representation of an interval.
 /// \ingroup nanoarrow-utils
 struct ArrowInterval {
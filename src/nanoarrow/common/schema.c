@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "nanoarrow/common/atomic_internal.h"
 #include "nanoarrow/nanoarrow.h"
 
 static void ArrowSchemaReleaseInternal(struct ArrowSchema* schema) {
@@ -64,6 +65,68 @@ static void ArrowSchemaReleaseInternal(struct ArrowSchema* schema) {
   schema->release = NULL;
 }
 
+// A schema created by ArrowSchemaCompact() shares a single allocation among all of its
+// nodes, child pointer arrays, and strings. Each node holds a reference to the
+// allocation such that a child moved out of its parent remains valid after the parent
+// is released.
+#if NANOARROW_USE_STDATOMIC
+struct ArrowSchemaCompactPrivate {
+  atomic_long reference_count;
+};
+
+static int64_t ArrowSchemaCompactUpdate(struct ArrowSchemaCompactPrivate* private_data,
+                                        int delta) {
+  int64_t old_count = atomic_fetch_add(&private_data->reference_count, delta);
+  return old_count + delta;
+}
+
+static void ArrowSchemaCompactSet(struct ArrowSchemaCompactPrivate* private_data,
+                                  int64_t count) {
+  atomic_store(&private_data->reference_count, count);
+}
+#else
+struct ArrowSchemaCompactPrivate {
+  int64_t reference_count;
+};
+
+static int64_t ArrowSchemaCompactUpdate(struct ArrowSchemaCompactPrivate* private_data,
+                                        int delta) {
+  private_data->reference_count += delta;
+  return private_data->reference_count;
+}
+
+static void ArrowSchemaCompactSet(struct ArrowSchemaCompactPrivate* private_data,
+                                  int64_t count) {
+  private_data->reference_count = count;
+}
+#endif
+
+static void ArrowSchemaCompactRelease(struct ArrowSchema* schema) {
+  // Children and the dictionary live in the same allocation. If they have been moved
+  // out of this schema, their release callback here will have been set to NULL.
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    if (schema->children[i]->release != NULL) {
+      ArrowSchemaRelease(schema->children[i]);
+    }
+  }
+
+  if (schema->dictionary != NULL && schema->dictionary->release != NULL) {
+    ArrowSchemaRelease(schema->dictionary);
+  }
+
+  struct ArrowSchemaCompactPrivate* private_data =
+      (struct ArrowSchemaCompactPrivate*)schema->private_data;
+  if (ArrowSchemaCompactUpdate(private_data, -1) == 0) {
+    ArrowFree(private_data);
+  }
+
+  schema->release = NULL;
+}
+
+static int ArrowSchemaIsCompact(const struct ArrowSchema* schema) {
+  return schema->release == &ArrowSchemaCompactRelease;
+}
+
 static const char* ArrowSchemaFormatTemplate(enum ArrowType type) {
   switch (type) {
     case NANOARROW_TYPE_UNINITIALIZED:
@@ -487,6 +550,10 @@ ArrowErrorCode ArrowSchemaSetTypeUnion(struct ArrowSchema* schema, enum ArrowTyp
 }
 
 ArrowErrorCode ArrowSchemaSetFormat(struct ArrowSchema* schema, const char* format) {
+  if (ArrowSchemaIsCompact(schema)) {
+    return EINVAL;
+  }
+
   if (schema->format != NULL) {
     ArrowFree((void*)schema->format);
   }
@@ -507,6 +574,10 @@ ArrowErrorCode ArrowSchemaSetFormat(struct ArrowSchema* schema, const char* form
 }
 
 ArrowErrorCode ArrowSchemaSetName(struct ArrowSchema* schema, const char* name) {
+  if (ArrowSchemaIsCompact(schema)) {
+    return EINVAL;
+  }
+
   if (schema->name != NULL) {
     ArrowFree((void*)schema->name);
   }
@@ -527,6 +598,10 @@ ArrowErrorCode ArrowSchemaSetName(struct ArrowSchema* schema, const char* name)
 }
 
 ArrowErrorCode ArrowSchemaSetMetadata(struct ArrowSchema* schema, const char* metadata) {
+  if (ArrowSchemaIsCompact(schema)) {
+    return EINVAL;
+  }
+
   if (schema->metadata != NULL) {
     ArrowFree((void*)schema->metadata);
   }
@@ -548,6 +623,10 @@ ArrowErrorCode ArrowSchemaSetMetadata(struct ArrowSchema* schema, const char* me
 
 ArrowErrorCode ArrowSchemaAllocateChildren(struct ArrowSchema* schema,
                                            int64_t n_children) {
+  if (ArrowSchemaIsCompact(schema)) {
+    return EINVAL;
+  }
+
   if (schema->children != NULL) {
     return EEXIST;
   }
@@ -579,6 +658,10 @@ ArrowErrorCode ArrowSchemaAllocateChildren(struct ArrowSchema* schema,
 }
 
 ArrowErrorCode ArrowSchemaAllocateDictionary(struct ArrowSchema* schema) {
+  if (ArrowSchemaIsCompact(schema)) {
+    return EINVAL;
+  }
+
   if (schema->dictionary != NULL) {
     return EEXIST;
   }
@@ -647,6 +730,256 @@ ArrowErrorCode ArrowSchemaDeepCopy(const struct ArrowSchema* schema,
   return NANOARROW_OK;
 }
 
+struct ArrowSchemaCompactState {
+  int64_t n_nodes;
+  int64_t n_child_pointers;
+  int64_t n_string_bytes;
+  struct ArrowSchema* next_node;
+  struct ArrowSchema** next_child_pointer;
+  char* next_string;
+  struct ArrowSchemaCompactPrivate* private_data;
+};
+
+static void ArrowSchemaCompactMeasure(const struct ArrowSchema* schema,
+                                      struct ArrowSchemaCompactState* state) {
+  state->n_nodes++;
+  state->n_child_pointers += schema->n_children;
+  if (schema->format != NULL) {
+    state->n_string_bytes += (int64_t)strlen(schema->format) + 1;
+  }
+
+  if (schema->name != NULL) {
+    state->n_string_bytes += (int64_t)strlen(schema->name) + 1;
+  }
+
+  if (schema->metadata != NULL) {
+    state->n_string_bytes += ArrowMetadataSizeOf(schema->metadata);
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    ArrowSchemaCompactMeasure(schema->children[i], state);
+  }
+
+  if (schema->dictionary != NULL) {
+    ArrowSchemaCompactMeasure(schema->dictionary, state);
+  }
+}
+
+static const char* ArrowSchemaCompactString(struct ArrowSchemaCompactState* state,
+                                            const char* value, size_t size) {
+  char* out = state->next_string;
+  memcpy(out, value, size);
+  state->next_string += size;
+  return out;
+}
+
+static void ArrowSchemaCompactCopy(const struct ArrowSchema* schema,
+                                   struct ArrowSchema* schema_out,
+                                   struct ArrowSchemaCompactState* state) {
+  schema_out->format = NULL;
+  schema_out->name = NULL;
+  schema_out->metadata = NULL;
+  if (schema->format != NULL) {
+    schema_out->format =
+        ArrowSchemaCompactString(state, schema->format, strlen(schema->format) + 1);
+  }
+
+  if (schema->name != NULL) {
+    schema_out->name =
+        ArrowSchemaCompactString(state, schema->name, strlen(schema->name) + 1);
+  }
+
+  if (schema->metadata != NULL) {
+    schema_out->metadata = ArrowSchemaCompactString(
+        state, schema->metadata, (size_t)ArrowMetadataSizeOf(schema->metadata));
+  }
+
+  schema_out->flags = schema->flags;
+  schema_out->n_children = schema->n_children;
+  schema_out->children = NULL;
+  if (schema->n_children > 0) {
+    schema_out->children = state->next_child_pointer;
+    state->next_child_pointer += schema->n_children;
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    schema_out->children[i] = state->next_node++;
+    ArrowSchemaCompactCopy(schema->children[i], schema_out->children[i], state);
+  }
+
+  schema_out->dictionary = NULL;
+  if (schema->dictionary != NULL) {
+    schema_out->dictionary = state->next_node++;
+    ArrowSchemaCompactCopy(schema->dictionary, schema_out->dictionary, state);
+  }
+
+  schema_out->private_data = state->private_data;
+  schema_out->release = &ArrowSchemaCompactRelease;
+}
+
+ArrowErrorCode ArrowSchemaCompact(const struct ArrowSchema* schema,
+                                  struct ArrowSchema* schema_out) {
+  struct ArrowSchemaCompactState state;
+  memset(&state, 0, sizeof(state));
+  ArrowSchemaCompactMeasure(schema, &state);
+
+  // The root node is schema_out itself, which is owned by the caller. Sections are
+  // ordered by decreasing alignment requirement.
+  const int64_t header_size = (int64_t)sizeof(struct ArrowSchemaCompactPrivate);
+  const int64_t nodes_size = (state.n_nodes - 1) * (int64_t)sizeof(struct ArrowSchema);
+  const int64_t child_pointers_size =
+      state.n_child_pointers * (int64_t)sizeof(struct ArrowSchema*);
+  uint8_t* data = (uint8_t*)ArrowMalloc(header_size + nodes_size + child_pointers_size +
+                                        state.n_string_bytes);
+  if (data == NULL) {
+    return ENOMEM;
+  }
+
+  state.private_data = (struct ArrowSchemaCompactPrivate*)data;
+  ArrowSchemaCompactSet(state.private_data, state.n_nodes);
+  state.next_node = (struct ArrowSchema*)(data + header_size);
+  state.next_child_pointer =
+      (struct ArrowSchema**)(data + header_size + nodes_size);
+  state.next_string = (char*)(data + header_size + nodes_size + child_pointers_size);
+
+  ArrowSchemaCompactCopy(schema, schema_out, &state);
+  return NANOARROW_OK;
+}
+
+static inline int ArrowStringViewEqual(struct ArrowStringView lhs,
+                                       struct ArrowStringView rhs) {
+  return lhs.size_bytes == rhs.size_bytes &&
+         memcmp(lhs.data, rhs.data, (size_t)lhs.size_bytes) == 0;
+}
+
+// Names and metadata are compared such that NULL is equivalent to an empty
+// value (i.e., a name of "" or metadata with zero keys)
+static struct ArrowStringView ArrowSchemaNameView(const struct ArrowSchema* schema) {
+  struct ArrowStringView out = ArrowCharView(schema->name);
+  if (out.data == NULL) {
+    out.data = "";
+  }
+
+  return out;
+}
+
+static struct ArrowStringView ArrowSchemaMetadataView(const struct ArrowSchema* schema) {
+  struct ArrowStringView out;
+  out.data = schema->metadata;
+  out.size_bytes = ArrowMetadataSizeOf(schema->metadata);
+  if (out.size_bytes <= (int64_t)sizeof(int32_t)) {
+    out.data = "";
+    out.size_bytes = 0;
+  }
+
+  return out;
+}
+
+static inline int64_t ArrowSchemaCompareFlags(const struct ArrowSchema* schema,
+                                              int64_t compare_flags) {
+  if (compare_flags & NANOARROW_SCHEMA_COMPARE_NULLABILITY) {
+    return schema->flags;
+  } else {
+    return schema->flags & ~((int64_t)ARROW_FLAG_NULLABLE);
+  }
+}
+
+static inline uint64_t ArrowSchemaHashCombine(uint64_t seed, uint64_t value) {
+  return seed ^ (value + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2));
+}
+
+static inline uint64_t ArrowSchemaHashStringView(uint64_t seed,
+                                                 struct ArrowStringView value) {
+  return ArrowSchemaHashCombine(
+      seed, _ArrowHashBytes((const uint8_t*)value.data, value.size_bytes));
+}
+
+static uint64_t ArrowSchemaHashInternal(const struct ArrowSchema* schema,
+                                        int64_t compare_flags, uint64_t seed) {
+  if (schema == NULL || schema->release == NULL) {
+    return ArrowSchemaHashCombine(seed, 0);
+  }
+
+  uint64_t hash = ArrowSchemaHashStringView(seed, ArrowCharView(schema->format));
+  hash = ArrowSchemaHashCombine(
+      hash, (uint64_t)ArrowSchemaCompareFlags(schema, compare_flags));
+  hash = ArrowSchemaHashCombine(hash, (uint64_t)schema->n_children);
+
+  if (compare_flags & NANOARROW_SCHEMA_COMPARE_NAMES) {
+    hash = ArrowSchemaHashStringView(hash, ArrowSchemaNameView(schema));
+  }
+
+  if (compare_flags & NANOARROW_SCHEMA_COMPARE_METADATA) {
+    hash = ArrowSchemaHashStringView(hash, ArrowSchemaMetadataView(schema));
+  }
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    hash = ArrowSchemaHashInternal(schema->children[i], compare_flags, hash);
+  }
+
+  hash = ArrowSchemaHashCombine(hash, schema->dictionary != NULL);
+  if (schema->dictionary != NULL) {
+    hash = ArrowSchemaHashInternal(schema->dictionary, compare_flags, hash);
+  }
+
+  return hash;
+}
+
+uint64_t ArrowSchemaHash(const struct ArrowSchema* schema, int64_t compare_flags) {
+  return ArrowSchemaHashInternal(schema, compare_flags, 0);
+}
+
+char ArrowSchemaEquals(const struct ArrowSchema* lhs, const struct ArrowSchema* rhs,
+                       int64_t compare_flags) {
+  if (lhs == rhs) {
+    return 1;
+  }
+
+  int lhs_valid = lhs != NULL && lhs->release != NULL;
+  int rhs_valid = rhs != NULL && rhs->release != NULL;
+  if (!lhs_valid || !rhs_valid) {
+    return lhs_valid == rhs_valid;
+  }
+
+  if (lhs->format == NULL || rhs->format == NULL) {
+    if (lhs->format != rhs->format) {
+      return 0;
+    }
+  } else if (strcmp(lhs->format, rhs->format) != 0) {
+    return 0;
+  }
+
+  if (ArrowSchemaCompareFlags(lhs, compare_flags) !=
+          ArrowSchemaCompareFlags(rhs, compare_flags) ||
+      lhs->n_children != rhs->n_children) {
+    return 0;
+  }
+
+  if ((compare_flags & NANOARROW_SCHEMA_COMPARE_NAMES) &&
+      !ArrowStringViewEqual(ArrowSchemaNameView(lhs), ArrowSchemaNameView(rhs))) {
+    return 0;
+  }
+
+  if ((compare_flags & NANOARROW_SCHEMA_COMPARE_METADATA) &&
+      !ArrowStringViewEqual(ArrowSchemaMetadataView(lhs),
+                                  ArrowSchemaMetadataView(rhs))) {
+    return 0;
+  }
+
+  for (int64_t i = 0; i < lhs->n_children; i++) {
+    if (!ArrowSchemaEquals(lhs->children[i], rhs->children[i], compare_flags)) {
+      return 0;
+    }
+  }
+
+  if ((lhs->dictionary == NULL) != (rhs->dictionary == NULL)) {
+    return 0;
+  }
+
+  return lhs->dictionary == NULL ||
+         ArrowSchemaEquals(lhs->dictionary, rhs->dictionary, compare_flags);
+}
+
 static void ArrowSchemaViewSetPrimitive(struct ArrowSchemaView* schema_view,
                                         enum ArrowType type) {
   schema_view->type = type;
@@ -1272,6 +1605,34 @@ static ArrowErrorCode ArrowSchemaViewValidate(struct ArrowSchemaView* schema_vie
   return NANOARROW_OK;
 }
 
+// Extension types are resolved for every field of every schema that is parsed,
+// so both keys are extracted in a single pass over the metadata. As with
+// ArrowMetadataGetValue(), the first instance of each key is used.
+static ArrowErrorCode ArrowSchemaViewInitExtension(struct ArrowSchemaView* schema_view,
+                                                   const char* metadata) {
+  schema_view->extension_name = ArrowCharView(NULL);
+  schema_view->extension_metadata = ArrowCharView(NULL);
+
+  struct ArrowMetadataReader reader;
+  struct ArrowStringView key;
+  struct ArrowStringView value;
+  NANOARROW_RETURN_NOT_OK(ArrowMetadataReaderInit(&reader, metadata));
+
+  const struct ArrowStringView name_key = ArrowCharView("ARROW:extension:name");
+  const struct ArrowStringView metadata_key = ArrowCharView("ARROW:extension:metadata");
+  while (ArrowMetadataReaderRead(&reader, &key, &value) == NANOARROW_OK) {
+    if (schema_view->extension_name.data == NULL &&
+        ArrowStringViewEqual(key, name_key)) {
+      schema_view->extension_name = value;
+    } else if (schema_view->extension_metadata.data == NULL &&
+               ArrowStringViewEqual(key, metadata_key)) {
+      schema_view->extension_metadata = value;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
 ArrowErrorCode ArrowSchemaViewInit(struct ArrowSchemaView* schema_view,
                                    const struct ArrowSchema* schema,
                                    struct ArrowError* error) {
@@ -1358,18 +1719,90 @@ ArrowErrorCode ArrowSchemaViewInit(struct ArrowSchemaView* schema_view,
     schema_view->layout.child_size_elements = schema_view->fixed_size;
   }
 
-  schema_view->extension_name = ArrowCharView(NULL);
-  schema_view->extension_metadata = ArrowCharView(NULL);
-  NANOARROW_RETURN_NOT_OK(ArrowMetadataGetValue(schema->metadata,
-                                                ArrowCharView("ARROW:extension:name"),
-                                                &schema_view->extension_name));
-  NANOARROW_RETURN_NOT_OK(ArrowMetadataGetValue(schema->metadata,
-                                                ArrowCharView("ARROW:extension:metadata"),
-                                                &schema_view->extension_metadata));
+  return ArrowSchemaViewInitExtension(schema_view, schema->metadata);
+}
+
+static int64_t ArrowSchemaViewTreeCountNodes(const struct ArrowSchema* schema) {
+  // Invalid nodes are counted but not descended into (ArrowSchemaViewInit() will
+  // report the error when the node is parsed)
+  if (schema == NULL || schema->release == NULL) {
+    return 1;
+  }
+
+  int64_t n_nodes = 1;
+  if (schema->children != NULL) {
+    for (int64_t i = 0; i < schema->n_children; i++) {
+      n_nodes += ArrowSchemaViewTreeCountNodes(schema->children[i]);
+    }
+  }
+
+  if (schema->dictionary != NULL) {
+    n_nodes += ArrowSchemaViewTreeCountNodes(schema->dictionary);
+  }
+
+  return n_nodes;
+}
+
+static ArrowErrorCode ArrowSchemaViewTreeInitNode(struct ArrowSchemaViewTree* tree,
+                                                  const struct ArrowSchema* schema,
+                                                  int64_t* node,
+                                                  struct ArrowError* error) {
+  int64_t i_node = (*node)++;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowSchemaViewInit(tree->schema_views + i_node, schema, error));
+
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowSchemaViewTreeInitNode(tree, schema->children[i], node, error));
+  }
+
+  if (schema->dictionary != NULL) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowSchemaViewTreeInitNode(tree, schema->dictionary, node, error));
+  }
 
+  tree->subtree_end[i_node] = *node;
   return NANOARROW_OK;
 }
 
+ArrowErrorCode ArrowSchemaViewTreeInit(struct ArrowSchemaViewTree* tree,
+                                       const struct ArrowSchema* schema,
+                                       struct ArrowError* error) {
+  tree->n_nodes = 0;
+  tree->schema_views = NULL;
+  tree->subtree_end = NULL;
+
+  int64_t n_nodes = ArrowSchemaViewTreeCountNodes(schema);
+
+  // Both arrays share one allocation
+  tree->schema_views = (struct ArrowSchemaView*)ArrowMalloc(
+      n_nodes * (sizeof(struct ArrowSchemaView) + sizeof(int64_t)));
+  if (tree->schema_views == NULL) {
+    ArrowErrorSet(error, "Failed to allocate ArrowSchemaViewTree with %" PRId64 " nodes",
+                  n_nodes);
+    return ENOMEM;
+  }
+
+  tree->subtree_end = (int64_t*)(tree->schema_views + n_nodes);
+  tree->n_nodes = n_nodes;
+
+  int64_t node = 0;
+  int result = ArrowSchemaViewTreeInitNode(tree, schema, &node, error);
+  if (result != NANOARROW_OK) {
+    ArrowSchemaViewTreeReset(tree);
+    return result;
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowSchemaViewTreeReset(struct ArrowSchemaViewTree* tree) {
+  ArrowFree(tree->schema_views);
+  tree->n_nodes = 0;
+  tree->schema_views = NULL;
+  tree->subtree_end = NULL;
+}
+
 static int64_t ArrowSchemaTypeToStringInternal(struct ArrowSchemaView* schema_view,
                                                char* out, int64_t n) {
   const char* type_string = ArrowTypeString(schema_view->type);
@@ -1617,6 +2050,102 @@ char ArrowMetadataHasKey(const char* metadata, struct ArrowStringView key) {
   return value.data != NULL;
 }
 
+// Returns the slot where key is stored or the empty slot where it would be inserted
+static int64_t ArrowMetadataIndexProbe(const struct ArrowMetadataIndex* index,
+                                       struct ArrowStringView key) {
+  const int64_t mask = index->n_slots - 1;
+  int64_t slot =
+      (int64_t)(_ArrowHashBytes((const uint8_t*)key.data, key.size_bytes) & mask);
+  while (index->slots[slot] != -1 &&
+         !ArrowStringViewEqual(index->keys[index->slots[slot]], key)) {
+    slot = (slot + 1) & mask;
+  }
+
+  return slot;
+}
+
+ArrowErrorCode ArrowMetadataIndexInit(struct ArrowMetadataIndex* index,
+                                      const char* metadata) {
+  memset(index, 0, sizeof(struct ArrowMetadataIndex));
+  index->metadata = metadata;
+
+  struct ArrowMetadataReader reader;
+  NANOARROW_RETURN_NOT_OK(ArrowMetadataReaderInit(&reader, metadata));
+  if (reader.remaining_keys <= 0) {
+    return NANOARROW_OK;
+  }
+
+  // Keep the load factor of the table at or below 0.5
+  int64_t n_keys = reader.remaining_keys;
+  int64_t n_slots = 8;
+  while (n_slots < (n_keys * 2)) {
+    n_slots *= 2;
+  }
+
+  // The keys, values, and slots share one allocation
+  struct ArrowStringView* keys = (struct ArrowStringView*)ArrowMalloc(
+      n_keys * 2 * sizeof(struct ArrowStringView) + n_slots * sizeof(int32_t));
+  if (keys == NULL) {
+    return ENOMEM;
+  }
+
+  index->keys = keys;
+  index->values = keys + n_keys;
+  index->slots = (int32_t*)(keys + 2 * n_keys);
+  index->n_slots = n_slots;
+  memset(index->slots, -1, n_slots * sizeof(int32_t));
+
+  for (int64_t i = 0; i < n_keys; i++) {
+    int result = ArrowMetadataReaderRead(&reader, index->keys + i, index->values + i);
+    if (result != NANOARROW_OK) {
+      ArrowMetadataIndexReset(index);
+      return result;
+    }
+
+    // Only the first instance of a key is inserted such that lookups give the same
+    // result as ArrowMetadataGetValue()
+    int64_t slot = ArrowMetadataIndexProbe(index, index->keys[i]);
+    if (index->slots[slot] == -1) {
+      index->slots[slot] = (int32_t)i;
+    } else {
+      index->n_duplicate_keys++;
+    }
+
+    index->n_keys++;
+  }
+
+  return NANOARROW_OK;
+}
+
+int64_t ArrowMetadataIndexFind(const struct ArrowMetadataIndex* index,
+                               struct ArrowStringView key) {
+  if (index->n_slots == 0) {
+    return -1;
+  }
+
+  return index->slots[ArrowMetadataIndexProbe(index, key)];
+}
+
+ArrowErrorCode ArrowMetadataIndexGetValue(const struct ArrowMetadataIndex* index,
+                                          struct ArrowStringView key,
+                                          struct ArrowStringView* value_out) {
+  if (value_out == NULL) {
+    return EINVAL;
+  }
+
+  int64_t i = ArrowMetadataIndexFind(index, key);
+  if (i != -1) {
+    *value_out = index->values[i];
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowMetadataIndexReset(struct ArrowMetadataIndex* index) {
+  ArrowFree(index->keys);
+  memset(index, 0, sizeof(struct ArrowMetadataIndex));
+}
+
 ArrowErrorCode ArrowMetadataBuilderInit(struct ArrowBuffer* buffer,
                                         const char* metadata) {
   ArrowBufferInit(buffer);
@@ -729,6 +729,287 @@ TEST(SchemaTest, SchemaCopyMetadata) {
 }
 #endif
 
+static void MakeCompactTestSchema(struct ArrowSchema* schema) {
+  nanoarrow::UniqueBuffer metadata;
+  ASSERT_EQ(ArrowMetadataBuilderInit(metadata.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(metadata.get(), ArrowCharView("key"),
+                                       ArrowCharView("value")),
+            NANOARROW_OK);
+
+  ArrowSchemaInit(schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema, "root"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(schema, reinterpret_cast<char*>(metadata->data)),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col0"), NANOARROW_OK);
+  schema->children[0]->flags = 0;
+
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_LIST), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "col1"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1]->children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(schema->children[1]->children[0],
+                                   reinterpret_cast<char*>(metadata->data)),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2], NANOARROW_TYPE_INT8), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[2], "col2"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateDictionary(schema->children[2]), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[2]->dictionary,
+                                    NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+}
+
+static void ExpectSchemaIdentical(const struct ArrowSchema* actual,
+                                  const struct ArrowSchema* expected) {
+  EXPECT_STREQ(actual->format, expected->format);
+  if (expected->name == nullptr) {
+    EXPECT_EQ(actual->name, nullptr);
+  } else {
+    EXPECT_STREQ(actual->name, expected->name);
+  }
+
+  if (expected->metadata == nullptr) {
+    EXPECT_EQ(actual->metadata, nullptr);
+  } else {
+    int64_t metadata_size = ArrowMetadataSizeOf(expected->metadata);
+    ASSERT_EQ(ArrowMetadataSizeOf(actual->metadata), metadata_size);
+    EXPECT_EQ(memcmp(actual->metadata, expected->metadata, metadata_size), 0);
+  }
+
+  EXPECT_EQ(actual->flags, expected->flags);
+  ASSERT_EQ(actual->n_children, expected->n_children);
+  for (int64_t i = 0; i < expected->n_children; i++) {
+    ExpectSchemaIdentical(actual->children[i], expected->children[i]);
+  }
+
+  if (expected->dictionary == nullptr) {
+    EXPECT_EQ(actual->dictionary, nullptr);
+  } else {
+    ASSERT_NE(actual->dictionary, nullptr);
+    ExpectSchemaIdentical(actual->dictionary, expected->dictionary);
+  }
+}
+
+TEST(SchemaTest, SchemaTestCompact) {
+  nanoarrow::UniqueSchema schema;
+  MakeCompactTestSchema(schema.get());
+
+  nanoarrow::UniqueSchema compact;
+  ASSERT_EQ(ArrowSchemaCompact(schema.get(), compact.get()), NANOARROW_OK);
+  ExpectSchemaIdentical(compact.get(), schema.get());
+  EXPECT_EQ(ArrowSchemaToStdString(compact.get()), ArrowSchemaToStdString(schema.get()));
+
+  // A compact schema is read-only
+  EXPECT_EQ(ArrowSchemaSetName(compact.get(), "new name"), EINVAL);
+  EXPECT_EQ(ArrowSchemaSetFormat(compact->children[0], "l"), EINVAL);
+  EXPECT_EQ(ArrowSchemaSetMetadata(compact.get(), nullptr), EINVAL);
+  EXPECT_EQ(ArrowSchemaAllocateChildren(compact->children[0], 1), EINVAL);
+  EXPECT_EQ(ArrowSchemaAllocateDictionary(compact->children[0]), EINVAL);
+  EXPECT_STREQ(compact->name, "root");
+
+  // ...but a deep copy of it can be modified
+  nanoarrow::UniqueSchema copy;
+  ASSERT_EQ(ArrowSchemaDeepCopy(compact.get(), copy.get()), NANOARROW_OK);
+  ExpectSchemaIdentical(copy.get(), schema.get());
+  EXPECT_EQ(ArrowSchemaSetName(copy.get(), "new name"), NANOARROW_OK);
+
+  // Compacting a compact schema is also possible
+  nanoarrow::UniqueSchema compact2;
+  ASSERT_EQ(ArrowSchemaCompact(compact.get(), compact2.get()), NANOARROW_OK);
+  ExpectSchemaIdentical(compact2.get(), schema.get());
+
+  // A schema without children
+  nanoarrow::UniqueSchema leaf;
+  ASSERT_EQ(ArrowSchemaInitFromType(leaf.get(), NANOARROW_TYPE_DOUBLE), NANOARROW_OK);
+  compact.reset();
+  ASSERT_EQ(ArrowSchemaCompact(leaf.get(), compact.get()), NANOARROW_OK);
+  ExpectSchemaIdentical(compact.get(), leaf.get());
+}
+
+TEST(SchemaTest, SchemaTestCompactMoveChild) {
+  nanoarrow::UniqueSchema schema;
+  MakeCompactTestSchema(schema.get());
+
+  nanoarrow::UniqueSchema compact;
+  ASSERT_EQ(ArrowSchemaCompact(schema.get(), compact.get()), NANOARROW_OK);
+
+  // Children moved out of a compact schema must outlive their parent
+  nanoarrow::UniqueSchema list_child;
+  nanoarrow::UniqueSchema dict_child;
+  ArrowSchemaMove(compact->children[1], list_child.get());
+  ArrowSchemaMove(compact->children[2], dict_child.get());
+  compact.reset();
+
+  ExpectSchemaIdentical(list_child.get(), schema->children[1]);
+  ExpectSchemaIdentical(dict_child.get(), schema->children[2]);
+
+  nanoarrow::UniqueSchema dictionary;
+  ArrowSchemaMove(dict_child->dictionary, dictionary.get());
+  dict_child.reset();
+  ExpectSchemaIdentical(dictionary.get(), schema->children[2]->dictionary);
+}
+
+static void ExpectSchemaEqualsAndHash(const struct ArrowSchema* lhs,
+                                      const struct ArrowSchema* rhs,
+                                      int64_t compare_flags, bool expected) {
+  EXPECT_EQ(ArrowSchemaEquals(lhs, rhs, compare_flags), expected);
+  EXPECT_EQ(ArrowSchemaEquals(rhs, lhs, compare_flags), expected);
+  if (expected) {
+    EXPECT_EQ(ArrowSchemaHash(lhs, compare_flags), ArrowSchemaHash(rhs, compare_flags));
+  } else {
+    // Not guaranteed in general but should be true for these simple cases
+    EXPECT_NE(ArrowSchemaHash(lhs, compare_flags), ArrowSchemaHash(rhs, compare_flags));
+  }
+}
+
+TEST(SchemaTest, SchemaTestHashEquals) {
+  nanoarrow::UniqueSchema schema;
+  MakeCompactTestSchema(schema.get());
+
+  // A schema is equal to itself and to copies of itself
+  nanoarrow::UniqueSchema copy;
+  ASSERT_EQ(ArrowSchemaDeepCopy(schema.get(), copy.get()), NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), schema.get(), NANOARROW_SCHEMA_COMPARE_ALL,
+                            true);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), NANOARROW_SCHEMA_COMPARE_ALL,
+                            true);
+
+  nanoarrow::UniqueSchema compact;
+  ASSERT_EQ(ArrowSchemaCompact(schema.get(), compact.get()), NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), compact.get(), NANOARROW_SCHEMA_COMPARE_ALL,
+                            true);
+
+  // Names are only compared if requested (and NULL is equal to "")
+  ASSERT_EQ(ArrowSchemaSetName(copy->children[0], "something else"), NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), 0, true);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), NANOARROW_SCHEMA_COMPARE_NAMES,
+                            false);
+  ASSERT_EQ(ArrowSchemaSetName(copy->children[0], "col0"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(copy->children[2]->dictionary, ""), NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), NANOARROW_SCHEMA_COMPARE_ALL,
+                            true);
+
+  // Metadata is only compared if requested (and NULL is equal to zero keys)
+  nanoarrow::UniqueBuffer empty_metadata;
+  ASSERT_EQ(ArrowMetadataBuilderInit(empty_metadata.get(), nullptr), NANOARROW_OK);
+  int32_t zero = 0;
+  ASSERT_EQ(ArrowBufferAppendInt32(empty_metadata.get(), zero), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetMetadata(copy->children[0],
+                                   reinterpret_cast<char*>(empty_metadata->data)),
+            NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), NANOARROW_SCHEMA_COMPARE_ALL,
+                            true);
+
+  ASSERT_EQ(ArrowSchemaSetMetadata(copy->children[1]->children[0], nullptr),
+            NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), NANOARROW_SCHEMA_COMPARE_NAMES,
+                            true);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), NANOARROW_SCHEMA_COMPARE_METADATA,
+                            false);
+
+  // Nullability is only compared if requested
+  copy.reset();
+  ASSERT_EQ(ArrowSchemaDeepCopy(schema.get(), copy.get()), NANOARROW_OK);
+  copy->children[1]->flags = 0;
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(),
+                            NANOARROW_SCHEMA_COMPARE_NAMES |
+                                NANOARROW_SCHEMA_COMPARE_METADATA,
+                            true);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(),
+                            NANOARROW_SCHEMA_COMPARE_NULLABILITY, false);
+
+  // ...but other flags are always compared
+  copy.reset();
+  ASSERT_EQ(ArrowSchemaDeepCopy(schema.get(), copy.get()), NANOARROW_OK);
+  copy->children[2]->flags |= ARROW_FLAG_DICTIONARY_ORDERED;
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), 0, false);
+
+  // Types are always compared, including for children and dictionaries
+  copy.reset();
+  ASSERT_EQ(ArrowSchemaDeepCopy(schema.get(), copy.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormat(copy->children[1]->children[0], "U"), NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), 0, false);
+
+  copy.reset();
+  ASSERT_EQ(ArrowSchemaDeepCopy(schema.get(), copy.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormat(copy->children[2]->dictionary, "z"), NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), 0, false);
+
+  copy.reset();
+  ASSERT_EQ(ArrowSchemaDeepCopy(schema.get(), copy.get()), NANOARROW_OK);
+  ArrowSchemaRelease(copy->children[2]->dictionary);
+  ArrowFree(copy->children[2]->dictionary);
+  copy->children[2]->dictionary = nullptr;
+  ExpectSchemaEqualsAndHash(schema.get(), copy.get(), 0, false);
+
+  nanoarrow::UniqueSchema other;
+  ASSERT_EQ(ArrowSchemaInitFromType(other.get(), NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ExpectSchemaEqualsAndHash(schema.get(), other.get(), 0, false);
+
+  // Released schemas are only equal to other released schemas
+  nanoarrow::UniqueSchema released;
+  EXPECT_TRUE(ArrowSchemaEquals(released.get(), nullptr, 0));
+  EXPECT_FALSE(ArrowSchemaEquals(released.get(), schema.get(), 0));
+}
+
+TEST(SchemaViewTest, SchemaViewTree) {
+  nanoarrow::UniqueSchema schema;
+  MakeCompactTestSchema(schema.get());
+
+  struct ArrowSchemaViewTree tree;
+  ASSERT_EQ(ArrowSchemaViewTreeInit(&tree, schema.get(), nullptr), NANOARROW_OK);
+
+  // root, col0, col1, col1.item, col2, col2.dictionary
+  ASSERT_EQ(tree.n_nodes, 6);
+  const struct ArrowSchema* expected_schemas[] = {schema.get(),
+                                                   schema->children[0],
+                                                   schema->children[1],
+                                                   schema->children[1]->children[0],
+                                                   schema->children[2],
+                                                   schema->children[2]->dictionary};
+  const enum ArrowType expected_types[] = {
+      NANOARROW_TYPE_STRUCT, NANOARROW_TYPE_INT32,      NANOARROW_TYPE_LIST,
+      NANOARROW_TYPE_STRING, NANOARROW_TYPE_DICTIONARY, NANOARROW_TYPE_STRING};
+  const int64_t expected_subtree_end[] = {6, 2, 4, 4, 6, 6};
+
+  for (int64_t i = 0; i < tree.n_nodes; i++) {
+    EXPECT_EQ(tree.schema_views[i].schema, expected_schemas[i]);
+    EXPECT_EQ(tree.schema_views[i].type, expected_types[i]);
+    EXPECT_EQ(tree.subtree_end[i], expected_subtree_end[i]);
+  }
+
+  ArrowSchemaViewTreeReset(&tree);
+  EXPECT_EQ(tree.n_nodes, 0);
+  EXPECT_EQ(tree.schema_views, nullptr);
+}
+
+TEST(SchemaViewTest, SchemaViewTreeErrors) {
+  struct ArrowSchemaViewTree tree;
+  struct ArrowError error;
+
+  EXPECT_EQ(ArrowSchemaViewTreeInit(&tree, nullptr, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected non-NULL schema");
+  EXPECT_EQ(tree.schema_views, nullptr);
+
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetFormat(schema->children[1], "*"), NANOARROW_OK);
+  EXPECT_EQ(ArrowSchemaViewTreeInit(&tree, schema.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Error parsing schema->format: Unknown format: '*'");
+  EXPECT_EQ(tree.schema_views, nullptr);
+
+  ArrowSchemaRelease(schema->children[1]);
+  EXPECT_EQ(ArrowSchemaViewTreeInit(&tree, schema.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected valid schema at schema->children[1] but found a released "
+               "schema");
+}
+
 TEST(SchemaViewTest, SchemaViewInitErrors) {
   struct ArrowSchema schema;
   struct ArrowSchemaView schema_view;
@@ -1911,3 +2192,64 @@ TEST(MetadataTest, MetadataBuild) {
 
   ArrowBufferReset(&metadata_builder);
 }
+
+TEST(MetadataTest, MetadataIndex) {
+  using namespace nanoarrow::literals;
+
+  struct ArrowMetadataIndex index;
+  struct ArrowStringView value;
+
+  // NULL metadata
+  ASSERT_EQ(ArrowMetadataIndexInit(&index, nullptr), NANOARROW_OK);
+  EXPECT_EQ(index.n_keys, 0);
+  EXPECT_EQ(ArrowMetadataIndexFind(&index, "key"_asv), -1);
+  value = "default_val"_asv;
+  EXPECT_EQ(ArrowMetadataIndexGetValue(&index, "key"_asv, &value), NANOARROW_OK);
+  EXPECT_EQ(value, "default_val"_asv);
+  ArrowMetadataIndexReset(&index);
+
+  // Enough keys that the table must be larger than the initial size, including
+  // a duplicate key
+  nanoarrow::UniqueBuffer metadata;
+  ASSERT_EQ(ArrowMetadataBuilderInit(metadata.get(), nullptr), NANOARROW_OK);
+  std::vector<std::string> keys;
+  for (int i = 0; i < 100; i++) {
+    keys.push_back("key" + std::to_string(i));
+    ASSERT_EQ(ArrowMetadataBuilderAppend(metadata.get(), ArrowCharView(keys[i].c_str()),
+                                         ArrowCharView(keys[i].c_str())),
+              NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowMetadataBuilderAppend(metadata.get(), "key50"_asv, "duplicate"_asv),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowMetadataBuilderAppend(metadata.get(), ""_asv, "empty key"_asv),
+            NANOARROW_OK);
+
+  const char* metadata_data = reinterpret_cast<const char*>(metadata->data);
+  ASSERT_EQ(ArrowMetadataIndexInit(&index, metadata_data), NANOARROW_OK);
+  EXPECT_EQ(index.metadata, metadata_data);
+  EXPECT_EQ(index.n_keys, 102);
+  EXPECT_EQ(index.n_duplicate_keys, 1);
+  EXPECT_GE(index.n_slots, 2 * index.n_keys);
+
+  for (int i = 0; i < 100; i++) {
+    struct ArrowStringView key = ArrowCharView(keys[i].c_str());
+    EXPECT_EQ(ArrowMetadataIndexFind(&index, key), i);
+
+    struct ArrowStringView expected = ArrowCharView(nullptr);
+    ASSERT_EQ(ArrowMetadataGetValue(metadata_data, key, &expected), NANOARROW_OK);
+    value = ArrowCharView(nullptr);
+    ASSERT_EQ(ArrowMetadataIndexGetValue(&index, key, &value), NANOARROW_OK);
+    EXPECT_EQ(value, expected);
+  }
+
+  EXPECT_EQ(index.keys[100], "key50"_asv);
+  EXPECT_EQ(index.values[100], "duplicate"_asv);
+  EXPECT_EQ(ArrowMetadataIndexFind(&index, ""_asv), 101);
+  EXPECT_EQ(ArrowMetadataIndexFind(&index, "key100"_asv), -1);
+  EXPECT_EQ(ArrowMetadataIndexFind(&index, "key"_asv), -1);
+  EXPECT_EQ(ArrowMetadataIndexGetValue(&index, "key0"_asv, nullptr), EINVAL);
+
+  ArrowMetadataIndexReset(&index);
+  EXPECT_EQ(index.keys, nullptr);
+  EXPECT_EQ(index.n_keys, 0);
+}
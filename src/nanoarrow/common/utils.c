@@ -15,15 +15,33 @@
 // specific language governing permissions and limitations
 // under the License.
 
+// clock_gettime() is only declared by strict C99 headers when requested
+#if defined(NANOARROW_ENABLE_TRACING) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include <errno.h>
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
+#include "nanoarrow/common/atomic_internal.h"
 #include "nanoarrow/nanoarrow.h"
 
+// Bulk half float conversions use hardware instructions when the compiler targets
+// them (e.g., -mf16c or -mavx512f)
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define NANOARROW_HALF_FLOAT_F16C
+#endif
+
+#if defined(__AVX512F__) || defined(NANOARROW_HALF_FLOAT_F16C)
+#include <immintrin.h>
+#endif
+
 const char* ArrowNanoarrowVersion(void) { return NANOARROW_VERSION; }
 
 int ArrowNanoarrowVersionInt(void) { return NANOARROW_VERSION_INT; }
@@ -49,6 +67,152 @@ ArrowErrorCode ArrowErrorSet(struct ArrowError* error, const char* fmt, ...) {
   }
 }
 
+const char* ArrowTraceEventName(enum ArrowTraceEvent event) {
+  switch (event) {
+    case NANOARROW_TRACE_ARRAY_FINISH_BUILDING:
+      return "array_finish_building";
+    case NANOARROW_TRACE_ARRAY_VIEW_VALIDATE:
+      return "array_view_validate";
+    case NANOARROW_TRACE_IPC_READ_INPUT:
+      return "ipc_read_input";
+    case NANOARROW_TRACE_IPC_VERIFY_HEADER:
+      return "ipc_verify_header";
+    case NANOARROW_TRACE_IPC_DECODE_HEADER:
+      return "ipc_decode_header";
+    case NANOARROW_TRACE_IPC_DECOMPRESS:
+      return "ipc_decompress";
+    case NANOARROW_TRACE_IPC_ALLOCATE_BUFFER:
+      return "ipc_allocate_buffer";
+    case NANOARROW_TRACE_IPC_SWAP_ENDIAN:
+      return "ipc_swap_endian";
+    case NANOARROW_TRACE_IPC_ENCODE_RECORD_BATCH:
+      return "ipc_encode_record_batch";
+    default:
+      return NULL;
+  }
+}
+
+#if defined(NANOARROW_ENABLE_TRACING)
+
+// Statistics are shared by all threads and are only thread safe with C11 +
+// stdatomic.h (detected the same way as for shared array reference counts)
+#if NANOARROW_USE_STDATOMIC
+typedef atomic_llong ArrowTraceCounter;
+
+static inline void ArrowTraceCounterAdd(ArrowTraceCounter* counter, int64_t value) {
+  atomic_fetch_add_explicit(counter, (long long)value, memory_order_relaxed);
+}
+
+static inline int64_t ArrowTraceCounterLoad(ArrowTraceCounter* counter) {
+  return (int64_t)atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+static inline void ArrowTraceCounterStore(ArrowTraceCounter* counter, int64_t value) {
+  atomic_store_explicit(counter, (long long)value, memory_order_relaxed);
+}
+#else
+typedef int64_t ArrowTraceCounter;
+
+static inline void ArrowTraceCounterAdd(ArrowTraceCounter* counter, int64_t value) {
+  *counter += value;
+}
+
+static inline int64_t ArrowTraceCounterLoad(ArrowTraceCounter* counter) {
+  return *counter;
+}
+
+static inline void ArrowTraceCounterStore(ArrowTraceCounter* counter, int64_t value) {
+  *counter = value;
+}
+#endif
+
+struct ArrowTraceCounters {
+  ArrowTraceCounter count[NANOARROW_TRACE_NUM_EVENTS];
+  ArrowTraceCounter elapsed_ns[NANOARROW_TRACE_NUM_EVENTS];
+  ArrowTraceCounter bytes[NANOARROW_TRACE_NUM_EVENTS];
+};
+
+static struct ArrowTraceCounters trace_counters;
+
+// The callback and its private data are read without synchronization when an event
+// is recorded. They can't be updated together atomically, so ArrowTraceSetCallback()
+// may only be called while no other thread is using nanoarrow (as documented).
+static ArrowTraceCallback trace_callback = NULL;
+static void* trace_callback_private_data = NULL;
+
+int64_t ArrowTraceNowNs(void) {
+  struct timespec now;
+#if defined(_WIN32)
+  timespec_get(&now, TIME_UTC);
+#else
+  clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+  return (int64_t)now.tv_sec * 1000000000 + (int64_t)now.tv_nsec;
+}
+
+void ArrowTraceRecord(enum ArrowTraceEvent event, int64_t elapsed_ns, int64_t bytes) {
+  if ((int)event < 0 || event >= NANOARROW_TRACE_NUM_EVENTS) {
+    return;
+  }
+
+  ArrowTraceCounterAdd(&trace_counters.count[event], 1);
+  ArrowTraceCounterAdd(&trace_counters.elapsed_ns[event], elapsed_ns);
+  ArrowTraceCounterAdd(&trace_counters.bytes[event], bytes);
+
+  if (trace_callback != NULL) {
+    trace_callback(event, elapsed_ns, bytes, trace_callback_private_data);
+  }
+}
+
+ArrowErrorCode ArrowTraceGetStats(struct ArrowTraceStats* out) {
+  for (int i = 0; i < NANOARROW_TRACE_NUM_EVENTS; i++) {
+    out->count[i] = ArrowTraceCounterLoad(&trace_counters.count[i]);
+    out->elapsed_ns[i] = ArrowTraceCounterLoad(&trace_counters.elapsed_ns[i]);
+    out->bytes[i] = ArrowTraceCounterLoad(&trace_counters.bytes[i]);
+  }
+
+  return NANOARROW_OK;
+}
+
+void ArrowTraceResetStats(void) {
+  for (int i = 0; i < NANOARROW_TRACE_NUM_EVENTS; i++) {
+    ArrowTraceCounterStore(&trace_counters.count[i], 0);
+    ArrowTraceCounterStore(&trace_counters.elapsed_ns[i], 0);
+    ArrowTraceCounterStore(&trace_counters.bytes[i], 0);
+  }
+}
+
+ArrowErrorCode ArrowTraceSetCallback(ArrowTraceCallback callback, void* private_data) {
+  trace_callback = callback;
+  trace_callback_private_data = private_data;
+  return NANOARROW_OK;
+}
+
+#else
+
+int64_t ArrowTraceNowNs(void) { return 0; }
+
+void ArrowTraceRecord(enum ArrowTraceEvent event, int64_t elapsed_ns, int64_t bytes) {
+  NANOARROW_UNUSED(event);
+  NANOARROW_UNUSED(elapsed_ns);
+  NANOARROW_UNUSED(bytes);
+}
+
+ArrowErrorCode ArrowTraceGetStats(struct ArrowTraceStats* out) {
+  NANOARROW_UNUSED(out);
+  return ENOTSUP;
+}
+
+void ArrowTraceResetStats(void) {}
+
+ArrowErrorCode ArrowTraceSetCallback(ArrowTraceCallback callback, void* private_data) {
+  NANOARROW_UNUSED(callback);
+  NANOARROW_UNUSED(private_data);
+  return ENOTSUP;
+}
+
+#endif
+
 void ArrowLayoutInit(struct ArrowLayout* layout, enum ArrowType storage_type) {
   layout->buffer_type[0] = NANOARROW_BUFFER_TYPE_VALIDITY;
   layout->buffer_data_type[0] = NANOARROW_TYPE_BOOL;
@@ -276,18 +440,79 @@ struct ArrowBufferAllocator ArrowBufferDeallocator(
   return allocator;
 }
 
+void ArrowHalfFloatToFloatN(const uint16_t* values, float* out, int64_t n) {
+  int64_t i = 0;
+
+#if defined(__AVX512F__)
+  for (; (i + 16) <= n; i += 16) {
+    __m256i half = _mm256_loadu_si256((const __m256i*)(values + i));
+    _mm512_storeu_ps(out + i, _mm512_cvtph_ps(half));
+  }
+#endif
+
+#if defined(NANOARROW_HALF_FLOAT_F16C)
+  for (; (i + 8) <= n; i += 8) {
+    __m128i half = _mm_loadu_si128((const __m128i*)(values + i));
+    _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+  }
+#endif
+
+  for (; i < n; i++) {
+    out[i] = ArrowHalfFloatToFloat(values[i]);
+  }
+}
+
+void ArrowFloatToHalfFloatN(const float* values, uint16_t* out, int64_t n) {
+  int64_t i = 0;
+
+#if defined(__AVX512F__)
+  for (; (i + 16) <= n; i += 16) {
+    __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(values + i),
+                                   _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    _mm256_storeu_si256((__m256i*)(out + i), half);
+  }
+#endif
+
+#if defined(NANOARROW_HALF_FLOAT_F16C)
+  for (; (i + 8) <= n; i += 8) {
+    __m128i half =
+        _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128((__m128i*)(out + i), half);
+  }
+#endif
+
+  for (; i < n; i++) {
+    out[i] = ArrowFloatToHalfFloat(values[i]);
+  }
+}
+
 static const int kInt32DecimalDigits = 9;
 
 static const uint64_t kUInt32PowersOfTen[] = {
     1ULL,      10ULL,      100ULL,      1000ULL,      10000ULL,
     100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL};
 
+// The number of decimal digits that can always be parsed into a uint64_t
+static const int kUInt64DecimalDigits = 19;
+
+// The maximum number of characters needed to represent the digits of a decimal
+// (77 digits for the largest 256-bit value plus a sign)
+#define NANOARROW_DECIMAL_MAX_DIGITS_CHARS 80
+
+// Parses a run of characters already known to be digits into an integer. This is
+// much faster than strtoll() and doesn't require null-terminated input.
+static inline uint64_t ArrowDecimalParseDigitChunk(const char* digits, int64_t n) {
+  uint64_t out = 0;
+  for (int64_t i = 0; i < n; i++) {
+    out = out * 10 + (uint64_t)(digits[i] - '0');
+  }
+
+  return out;
+}
+
 // Adapted from Arrow C++ to use 32-bit words for better C portability
 // https://github.com/apache/arrow/blob/cd3321b28b0c9703e5d7105d6146c1270bbadd7f/cpp/src/arrow/util/decimal.cc#L524-L544
 static void ShiftAndAdd(struct ArrowStringView value, uint32_t* out, int64_t out_size) {
-  // We use strtoll for parsing, which needs input that is null-terminated
-  char chunk_string[16];
-
   for (int64_t posn = 0; posn < value.size_bytes;) {
     int64_t remaining = value.size_bytes - posn;
 
@@ -299,10 +524,7 @@ static void ShiftAndAdd(struct ArrowStringView value, uint32_t* out, int64_t out
     }
 
     const uint64_t multiple = kUInt32PowersOfTen[group_size];
-
-    memcpy(chunk_string, value.data + posn, group_size);
-    chunk_string[group_size] = '\0';
-    uint32_t chunk = (uint32_t)strtoll(chunk_string, NULL, 10);
+    uint32_t chunk = (uint32_t)ArrowDecimalParseDigitChunk(value.data + posn, group_size);
 
     for (int64_t i = 0; i < out_size; i++) {
       uint64_t tmp = out[i];
@@ -315,11 +537,65 @@ static void ShiftAndAdd(struct ArrowStringView value, uint32_t* out, int64_t out
   }
 }
 
+// Sets the value of decimal from an absolute value that fits in a single word
+static void ArrowDecimalSetUInt64(struct ArrowDecimal* decimal, uint64_t value,
+                                  int is_negative) {
+  if (decimal->n_words == 0) {
+    uint32_t value32 = (uint32_t)value;
+    memcpy(decimal->words, &value32, sizeof(uint32_t));
+  } else {
+    memset(decimal->words, 0, decimal->n_words * sizeof(uint64_t));
+    decimal->words[decimal->low_word_index] = value;
+  }
+
+  if (is_negative) {
+    ArrowDecimalNegate(decimal);
+  }
+}
+
+// Sets the value of decimal from digits that have already been validated and
+// have had leading zeroes removed
+static void ArrowDecimalSetValidDigits(struct ArrowDecimal* decimal,
+                                       struct ArrowStringView value, int is_negative) {
+  // Values with up to 19 digits fit in a single 64-bit word
+  if (value.size_bytes <= kUInt64DecimalDigits) {
+    ArrowDecimalSetUInt64(decimal,
+                          ArrowDecimalParseDigitChunk(value.data, value.size_bytes),
+                          is_negative);
+    return;
+  }
+
+  // Use 32-bit words for portability
+  uint32_t words32[8];
+  memset(words32, 0, sizeof(words32));
+  int n_words32 = decimal->n_words > 0 ? decimal->n_words * 2 : 1;
+  NANOARROW_DCHECK(n_words32 <= 8);
+
+  ShiftAndAdd(value, words32, n_words32);
+
+  if (_ArrowIsLittleEndian() || n_words32 == 1) {
+    memcpy(decimal->words, words32, sizeof(uint32_t) * n_words32);
+  } else {
+    uint64_t lo;
+    uint64_t hi;
+
+    for (int i = 0; i < decimal->n_words; i++) {
+      lo = (uint64_t)words32[i * 2];
+      hi = (uint64_t)words32[i * 2 + 1] << 32;
+      decimal->words[decimal->n_words - i - 1] = lo | hi;
+    }
+  }
+
+  if (is_negative) {
+    ArrowDecimalNegate(decimal);
+  }
+}
+
 ArrowErrorCode ArrowDecimalSetDigits(struct ArrowDecimal* decimal,
                                      struct ArrowStringView value) {
   // Check for sign
-  int is_negative = value.data[0] == '-';
-  int has_sign = is_negative || value.data[0] == '+';
+  int is_negative = value.size_bytes > 0 && value.data[0] == '-';
+  int has_sign = is_negative || (value.size_bytes > 0 && value.data[0] == '+');
   value.data += has_sign;
   value.size_bytes -= has_sign;
 
@@ -344,64 +620,84 @@ ArrowErrorCode ArrowDecimalSetDigits(struct ArrowDecimal* decimal,
   value.data += n_leading_zeroes;
   value.size_bytes -= n_leading_zeroes;
 
-  // Use 32-bit words for portability
-  uint32_t words32[8];
-  memset(words32, 0, sizeof(words32));
-  int n_words32 = decimal->n_words > 0 ? decimal->n_words * 2 : 1;
-  NANOARROW_DCHECK(n_words32 <= 8);
-  memset(words32, 0, sizeof(words32));
+  ArrowDecimalSetValidDigits(decimal, value, is_negative);
+  return NANOARROW_OK;
+}
 
-  ShiftAndAdd(value, words32, n_words32);
+static const char kDecimalDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Writes the digits of value such that they end just before out and returns a pointer
+// to the first digit written. Two digits are written at a time using a lookup table.
+static inline char* ArrowDecimalWriteUInt64Backward(uint64_t value, char* out) {
+  while (value >= 100) {
+    uint64_t pair = value % 100;
+    value /= 100;
+    out -= 2;
+    memcpy(out, kDecimalDigitPairs + pair * 2, 2);
+  }
 
-  if (_ArrowIsLittleEndian() || n_words32 == 1) {
-    memcpy(decimal->words, words32, sizeof(uint32_t) * n_words32);
+  if (value >= 10) {
+    out -= 2;
+    memcpy(out, kDecimalDigitPairs + value * 2, 2);
   } else {
-    uint64_t lo;
-    uint64_t hi;
-
-    for (int i = 0; i < decimal->n_words; i++) {
-      lo = (uint64_t)words32[i * 2];
-      hi = (uint64_t)words32[i * 2 + 1] << 32;
-      decimal->words[decimal->n_words - i - 1] = lo | hi;
-    }
+    *--out = (char)('0' + value);
   }
 
-  if (is_negative) {
-    ArrowDecimalNegate(decimal);
+  return out;
+}
+
+// Writes exactly nine digits of value (which must be less than 1e9) such that they
+// end just before out and returns a pointer to the first digit written
+static inline char* ArrowDecimalWriteNineDigitsBackward(uint32_t value, char* out) {
+  for (int i = 0; i < 4; i++) {
+    uint32_t pair = value % 100;
+    value /= 100;
+    out -= 2;
+    memcpy(out, kDecimalDigitPairs + pair * 2, 2);
   }
 
-  return NANOARROW_OK;
+  *--out = (char)('0' + value);
+  return out;
 }
 
+// Writes the digits of decimal (preceded by a '-' if negative) such that they end just
+// before out_end, which must be preceded by at least NANOARROW_DECIMAL_MAX_DIGITS_CHARS
+// bytes, and returns a pointer to the first character written.
+//
 // Adapted from Arrow C++ for C
 // https://github.com/apache/arrow/blob/cd3321b28b0c9703e5d7105d6146c1270bbadd7f/cpp/src/arrow/util/decimal.cc#L365
-ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(const struct ArrowDecimal* decimal,
-                                                struct ArrowBuffer* buffer) {
+static char* ArrowDecimalWriteDigitsBackward(const struct ArrowDecimal* decimal,
+                                             char* out_end) {
   NANOARROW_DCHECK(decimal->n_words == 0 || decimal->n_words == 1 ||
                    decimal->n_words == 2 || decimal->n_words == 4);
 
-  // For the 32-bit case, just use snprintf()
+  // For the 32-bit case, the absolute value always fits in a uint64_t
   if (decimal->n_words == 0) {
     int32_t value;
     memcpy(&value, decimal->words, sizeof(int32_t));
-    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, 16));
-    int n_chars = snprintf((char*)buffer->data + buffer->size_bytes,
-                           (buffer->capacity_bytes - buffer->size_bytes), "%d", value);
-    if (n_chars <= 0) {
-      return EINVAL;
+    uint64_t abs_value = value < 0 ? (uint64_t)(-(int64_t)value) : (uint64_t)value;
+    char* out = ArrowDecimalWriteUInt64Backward(abs_value, out_end);
+    if (value < 0) {
+      *--out = '-';
     }
 
-    buffer->size_bytes += n_chars;
-    return NANOARROW_OK;
+    return out;
   }
 
   int is_negative = ArrowDecimalSign(decimal) < 0;
 
   uint64_t words_little_endian[4];
-  if (decimal->n_words == 0) {
-    words_little_endian[0] = 0;
-    memcpy(words_little_endian, decimal->words, sizeof(uint32_t));
-  } else if (decimal->low_word_index == 0) {
+  if (decimal->low_word_index == 0) {
     memcpy(words_little_endian, decimal->words, decimal->n_words * sizeof(uint64_t));
   } else {
     for (int i = 0; i < decimal->n_words; i++) {
@@ -411,63 +707,38 @@ ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(const struct ArrowDecimal* decim
 
   // We've already made a copy, so negate that if needed
   if (is_negative) {
-    if (decimal->n_words == 0) {
-      uint32_t elem = (uint32_t)words_little_endian[0];
-      elem = ~elem + 1;
-      words_little_endian[0] = (int32_t)elem;
-    } else {
-      uint64_t carry = 1;
-      for (int i = 0; i < decimal->n_words; i++) {
-        uint64_t elem = words_little_endian[i];
-        elem = ~elem + carry;
-        carry &= (elem == 0);
-        words_little_endian[i] = elem;
-      }
+    uint64_t carry = 1;
+    for (int i = 0; i < decimal->n_words; i++) {
+      uint64_t elem = words_little_endian[i];
+      elem = ~elem + carry;
+      carry &= (elem == 0);
+      words_little_endian[i] = elem;
     }
   }
 
   // Find the most significant word that is non-zero
-  int most_significant_elem_idx = -1;
-  if (decimal->n_words == 0) {
-    if (words_little_endian[0] != 0) {
-      most_significant_elem_idx = 0;
-    }
-  } else {
-    for (int i = decimal->n_words - 1; i >= 0; i--) {
-      if (words_little_endian[i] != 0) {
-        most_significant_elem_idx = i;
-        break;
-      }
+  int most_significant_elem_idx = 0;
+  for (int i = decimal->n_words - 1; i > 0; i--) {
+    if (words_little_endian[i] != 0) {
+      most_significant_elem_idx = i;
+      break;
     }
   }
 
-  // If they are all zero, the output is just '0'
-  if (most_significant_elem_idx == -1) {
-    NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt8(buffer, '0'));
-    return NANOARROW_OK;
-  }
-
-  // Define segments such that each segment represents 9 digits with the
-  // least significant group of 9 digits first. For example, if the input represents
-  // 9876543210123456789, then segments will be [123456789, 876543210, 9].
-  // We handle at most a signed 256 bit integer, whose maximum value occupies 77
-  // characters. Thus, we need at most 9 segments.
+  // While the value doesn't fit in a single 64-bit word, divide it by 1e9 and
+  // write the remainder as a segment of exactly 9 digits (least significant first).
+  // Because the divisor is a constant, each division compiles to a multiplication.
   const uint32_t k1e9 = 1000000000U;
-  int num_segments = 0;
-  uint32_t segments[9];
-  memset(segments, 0, sizeof(segments));
-  uint64_t* most_significant_elem = words_little_endian + most_significant_elem_idx;
-
-  do {
+  char* out = out_end;
+  while (most_significant_elem_idx > 0) {
     // Compute remainder = words_little_endian % 1e9 and words_little_endian =
     // words_little_endian / 1e9.
     uint32_t remainder = 0;
-    uint64_t* elem = most_significant_elem;
-
-    do {
+    for (int i = most_significant_elem_idx; i >= 0; i--) {
       // Compute dividend = (remainder << 32) | *elem  (a virtual 96-bit integer);
       // *elem = dividend / 1e9;
       // remainder = dividend % 1e9.
+      uint64_t* elem = words_little_endian + i;
       uint32_t hi = (uint32_t)(*elem >> 32);
       uint32_t lo = (uint32_t)(*elem & 0xFFFFFFFFULL);
       uint64_t dividend_hi = ((uint64_t)(remainder) << 32) | hi;
@@ -478,39 +749,71 @@ ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(const struct ArrowDecimal* decim
       remainder = (uint32_t)(dividend_lo % k1e9);
 
       *elem = (quotient_hi << 32) | quotient_lo;
-    } while (elem-- != words_little_endian);
+    }
 
-    segments[num_segments++] = remainder;
-  } while (*most_significant_elem != 0 || most_significant_elem-- != words_little_endian);
+    out = ArrowDecimalWriteNineDigitsBackward(remainder, out);
+
+    if (words_little_endian[most_significant_elem_idx] == 0) {
+      most_significant_elem_idx--;
+    }
+  }
 
-  // We know our output has no more than 9 digits per segment, plus a negative sign,
-  // plus any further digits between our output of 9 digits plus enough
-  // extra characters to ensure that snprintf() with n = 21 (maximum length of %lu
-  // including a the null terminator) is bounded properly.
-  NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, num_segments * 9 + 1 + 21 - 9));
+  // The most significant digits have no leading zeroes
+  out = ArrowDecimalWriteUInt64Backward(words_little_endian[0], out);
   if (is_negative) {
-    buffer->data[buffer->size_bytes++] = '-';
+    *--out = '-';
   }
 
-  // The most significant segment should have no leading zeroes
-  int n_chars = snprintf((char*)buffer->data + buffer->size_bytes, 21, "%lu",
-                         (unsigned long)segments[num_segments - 1]);
+  NANOARROW_DCHECK((out_end - out) <= NANOARROW_DECIMAL_MAX_DIGITS_CHARS);
+  return out;
+}
 
-  // Ensure that an encoding error from snprintf() does not result
-  // in an out-of-bounds access.
-  if (n_chars < 0) {
-    return ERANGE;
-  }
+ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(const struct ArrowDecimal* decimal,
+                                                struct ArrowBuffer* buffer) {
+  char digits[NANOARROW_DECIMAL_MAX_DIGITS_CHARS];
+  char* digits_end = digits + sizeof(digits);
+  char* digits_start = ArrowDecimalWriteDigitsBackward(decimal, digits_end);
+  return ArrowBufferAppend(buffer, digits_start, digits_end - digits_start);
+}
 
-  buffer->size_bytes += n_chars;
+// Appends the digits of an integer (with an optional leading '-') to buffer,
+// inserting a decimal point or trailing zeroes according to scale
+static ArrowErrorCode ArrowDecimalAppendScaledDigits(const char* digits,
+                                                     int64_t n_chars, int32_t scale,
+                                                     struct ArrowBuffer* buffer) {
+  if (scale <= 0) {
+    // e.g., digits are -12345 and scale is -2 -> -1234500
+    // Just add zeros to the end
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, n_chars - scale));
+    ArrowBufferAppendUnsafe(buffer, digits, n_chars);
+    memset(buffer->data + buffer->size_bytes, '0', (size_t)(-(int64_t)scale));
+    buffer->size_bytes -= scale;
+    return NANOARROW_OK;
+  }
 
-  // Subsequent output needs to be left-padded with zeroes such that each segment
-  // takes up exactly 9 digits.
-  for (int i = num_segments - 2; i >= 0; i--) {
-    int n_chars = snprintf((char*)buffer->data + buffer->size_bytes, 21, "%09lu",
-                           (unsigned long)segments[i]);
-    buffer->size_bytes += n_chars;
-    NANOARROW_DCHECK(buffer->size_bytes <= buffer->capacity_bytes);
+  int is_negative = digits[0] == '-';
+  int64_t num_digits = n_chars - is_negative;
+  if (num_digits <= scale) {
+    // e.g., digits are -12345 and scale is 6 -> -0.012345
+    // Insert "0.<some zeros>" between the (maybe) negative sign and the digits
+    int64_t num_zeros_after_decimal = scale - num_digits;
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(
+        buffer, is_negative + 2 + num_zeros_after_decimal + num_digits));
+    if (is_negative) {
+      ArrowBufferAppendUnsafe(buffer, "-", 1);
+    }
+    ArrowBufferAppendUnsafe(buffer, "0.", 2);
+    memset(buffer->data + buffer->size_bytes, '0', (size_t)num_zeros_after_decimal);
+    buffer->size_bytes += num_zeros_after_decimal;
+    ArrowBufferAppendUnsafe(buffer, digits + is_negative, num_digits);
+  } else {
+    // e.g., digits are -12345 and scale is 4 -> -1.2345
+    // Insert a decimal point before scale digits of output
+    int64_t n_chars_before_point = n_chars - scale;
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer, n_chars + 1));
+    ArrowBufferAppendUnsafe(buffer, digits, n_chars_before_point);
+    ArrowBufferAppendUnsafe(buffer, ".", 1);
+    ArrowBufferAppendUnsafe(buffer, digits + n_chars_before_point, scale);
   }
 
   return NANOARROW_OK;
@@ -518,43 +821,383 @@ ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(const struct ArrowDecimal* decim
 
 ArrowErrorCode ArrowDecimalAppendStringToBuffer(const struct ArrowDecimal* decimal,
                                                 struct ArrowBuffer* buffer) {
-  int64_t buffer_size = buffer->size_bytes;
-  NANOARROW_RETURN_NOT_OK(ArrowDecimalAppendDigitsToBuffer(decimal, buffer));
-  int64_t digits_size = buffer->size_bytes - buffer_size;
+  char digits[NANOARROW_DECIMAL_MAX_DIGITS_CHARS];
+  char* digits_end = digits + sizeof(digits);
+  char* digits_start = ArrowDecimalWriteDigitsBackward(decimal, digits_end);
+  return ArrowDecimalAppendScaledDigits(digits_start, digits_end - digits_start,
+                                        decimal->scale, buffer);
+}
 
-  if (decimal->scale <= 0) {
-    // e.g., digits are -12345 and scale is -2 -> -1234500
-    // Just add zeros to the end
-    for (int i = decimal->scale; i < 0; i++) {
-      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendInt8(buffer, '0'));
+// Returns the maximum precision of a decimal with a given number of words
+static int32_t ArrowDecimalMaxPrecision(const struct ArrowDecimal* decimal) {
+  switch (decimal->n_words) {
+    case 0:
+      return 9;
+    case 1:
+      return 18;
+    case 2:
+      return 38;
+    default:
+      return 76;
+  }
+}
+
+// Appends count digits from src to the digits in out (of which there are *n_digits),
+// skipping leading zeroes. Returns EINVAL if the result would have more than
+// max_digits digits.
+static inline ArrowErrorCode ArrowDecimalAppendDigitsUnscaled(char* out,
+                                                             int64_t* n_digits,
+                                                             int64_t max_digits,
+                                                             const char* src,
+                                                             int64_t count) {
+  if (*n_digits == 0) {
+    while (count > 0 && *src == '0') {
+      src++;
+      count--;
     }
+  }
+
+  if ((*n_digits + count) > max_digits) {
+    return EINVAL;
+  }
+
+  memcpy(out + *n_digits, src, (size_t)count);
+  *n_digits += count;
+  return NANOARROW_OK;
+}
+
+// Sets the value of decimal from a string such as "-123.45" whose number of digits
+// after the decimal point is interpreted according to decimal->scale. The value may
+// have at most decimal->precision significant digits.
+static ArrowErrorCode ArrowDecimalSetString(struct ArrowDecimal* decimal,
+                                            struct ArrowStringView value) {
+  int is_negative = value.size_bytes > 0 && value.data[0] == '-';
+  int has_sign = is_negative || (value.size_bytes > 0 && value.data[0] == '+');
+  value.data += has_sign;
+  value.size_bytes -= has_sign;
+
+  // Split into integer and fractional digits
+  struct ArrowStringView integer_digits = value;
+  struct ArrowStringView fractional_digits = {"", 0};
+  int has_point = 0;
+  for (int64_t i = 0; i < value.size_bytes; i++) {
+    char c = value.data[i];
+    if (c == '.' && !has_point) {
+      has_point = 1;
+      integer_digits.size_bytes = i;
+      fractional_digits.data = value.data + i + 1;
+      fractional_digits.size_bytes = value.size_bytes - i - 1;
+    } else if (c < '0' || c > '9') {
+      return EINVAL;
+    }
+  }
+
+  if (integer_digits.size_bytes == 0 && fractional_digits.size_bytes == 0) {
+    return EINVAL;
+  }
+
+  // Digits beyond the scale can only be dropped if they are zero (for a negative
+  // scale, these are the last -scale integer digits)
+  int32_t scale = decimal->scale;
+  int64_t n_padding_zeroes = 0;
+  if (fractional_digits.size_bytes > scale) {
+    int64_t n_drop = fractional_digits.size_bytes - (scale > 0 ? scale : 0);
+    for (int64_t i = 0; i < n_drop; i++) {
+      if (fractional_digits.data[fractional_digits.size_bytes - 1 - i] != '0') {
+        return EINVAL;
+      }
+    }
+
+    fractional_digits.size_bytes -= n_drop;
+  } else {
+    n_padding_zeroes = scale - fractional_digits.size_bytes;
+  }
+
+  if (scale < 0) {
+    int64_t n_drop = -(int64_t)scale;
+    for (int64_t i = 0; i < n_drop && i < integer_digits.size_bytes; i++) {
+      if (integer_digits.data[integer_digits.size_bytes - 1 - i] != '0') {
+        return EINVAL;
+      }
+    }
+
+    integer_digits.size_bytes -= integer_digits.size_bytes < n_drop
+                                     ? integer_digits.size_bytes
+                                     : n_drop;
+  }
+
+  // Values with up to 19 significant digits can be accumulated directly
+  int64_t n_significant = integer_digits.size_bytes + fractional_digits.size_bytes;
+  if ((n_significant + n_padding_zeroes) <= kUInt64DecimalDigits) {
+    uint64_t value64 = ArrowDecimalParseDigitChunk(integer_digits.data,
+                                                   integer_digits.size_bytes);
+    for (int64_t i = 0; i < fractional_digits.size_bytes; i++) {
+      value64 = value64 * 10 + (uint64_t)(fractional_digits.data[i] - '0');
+    }
+    for (int64_t i = 0; i < n_padding_zeroes; i++) {
+      value64 *= 10;
+    }
+
+    // Check against the precision (e.g., 99999 for a precision of 5). With 19 or
+    // more digits of precision, any value accumulated here fits.
+    int32_t precision = decimal->precision;
+    if (precision < kUInt64DecimalDigits) {
+      uint64_t limit = precision <= kInt32DecimalDigits
+                           ? kUInt32PowersOfTen[precision]
+                           : kUInt32PowersOfTen[kInt32DecimalDigits] *
+                                 kUInt32PowersOfTen[precision - kInt32DecimalDigits];
+      if (value64 >= limit) {
+        return EINVAL;
+      }
+    }
+
+    ArrowDecimalSetUInt64(decimal, value64, is_negative);
     return NANOARROW_OK;
   }
 
-  int is_negative = buffer->data[0] == '-';
-  int64_t num_digits = digits_size - is_negative;
-  if (num_digits <= decimal->scale) {
-    // e.g., digits are -12345 and scale is 6 -> -0.012345
-    // Insert "0.<some zeros>" between the (maybe) negative sign and the digits
-    int64_t num_zeros_after_decimal = decimal->scale - num_digits;
-    NANOARROW_RETURN_NOT_OK(
-        ArrowBufferResize(buffer, buffer->size_bytes + num_zeros_after_decimal + 2, 0));
-
-    uint8_t* digits_start = buffer->data + is_negative;
-    memmove(digits_start + num_zeros_after_decimal + 2, digits_start, num_digits);
-    *digits_start++ = '0';
-    *digits_start++ = '.';
-    for (int i = 0; i < num_zeros_after_decimal; i++) {
-      *digits_start++ = '0';
+  // Concatenate the unscaled digits without leading zeroes
+  char digits[NANOARROW_DECIMAL_MAX_DIGITS_CHARS];
+  int64_t n_digits = 0;
+  int64_t max_digits = decimal->precision;
+  NANOARROW_RETURN_NOT_OK(ArrowDecimalAppendDigitsUnscaled(
+      digits, &n_digits, max_digits, integer_digits.data, integer_digits.size_bytes));
+  NANOARROW_RETURN_NOT_OK(ArrowDecimalAppendDigitsUnscaled(digits, &n_digits, max_digits,
+                                                           fractional_digits.data,
+                                                           fractional_digits.size_bytes));
+  if (n_digits > 0) {
+    if ((n_digits + n_padding_zeroes) > max_digits) {
+      return EINVAL;
     }
 
+    memset(digits + n_digits, '0', (size_t)n_padding_zeroes);
+    n_digits += n_padding_zeroes;
+  }
+
+  struct ArrowStringView unscaled = {digits, n_digits};
+  ArrowDecimalSetValidDigits(decimal, unscaled, is_negative);
+  return NANOARROW_OK;
+}
+
+static ArrowErrorCode ArrowDecimalBitWidthFromType(enum ArrowType type,
+                                                   int32_t* bitwidth) {
+  switch (type) {
+    case NANOARROW_TYPE_DECIMAL32:
+      *bitwidth = 32;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DECIMAL64:
+      *bitwidth = 64;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DECIMAL128:
+      *bitwidth = 128;
+      return NANOARROW_OK;
+    case NANOARROW_TYPE_DECIMAL256:
+      *bitwidth = 256;
+      return NANOARROW_OK;
+    default:
+      return EINVAL;
+  }
+}
+
+// Returns the number of characters ArrowDecimalAppendScaledDigits() will append
+static int64_t ArrowDecimalScaledDigitsSize(const char* digits, int64_t n_chars,
+                                            int32_t scale) {
+  if (scale <= 0) {
+    return n_chars - scale;
+  }
+
+  int is_negative = digits[0] == '-';
+  int64_t num_digits = n_chars - is_negative;
+  if (num_digits <= scale) {
+    return is_negative + 2 + scale;
   } else {
-    // e.g., digits are -12345 and scale is 4 -> -1.2345
-    // Insert a decimal point before scale digits of output
-    NANOARROW_RETURN_NOT_OK(ArrowBufferResize(buffer, buffer->size_bytes + 1, 0));
-    uint8_t* decimal_point_to_be = buffer->data + buffer->size_bytes - 1 - decimal->scale;
-    memmove(decimal_point_to_be + 1, decimal_point_to_be, decimal->scale);
-    *decimal_point_to_be = '.';
+    return n_chars + 1;
+  }
+}
+
+// Checks that size_bytes more bytes can be appended to the data buffer of a string
+// array (i.e., that its offsets can't overflow)
+static ArrowErrorCode ArrowDecimalCheckAppendString(struct ArrowArray* array,
+                                                    enum ArrowType storage_type,
+                                                    int64_t size_bytes) {
+  if (storage_type == NANOARROW_TYPE_STRING) {
+    int32_t offset = ((int32_t*)ArrowArrayBuffer(array, 1)->data)[array->length];
+    if ((((int64_t)offset) + size_bytes) > INT32_MAX) {
+      return EOVERFLOW;
+    }
+  }
+
+  return NANOARROW_OK;
+}
+
+// Completes appending an element to a string or large string array whose
+// size_bytes bytes were already appended to the data buffer (after checking them
+// with ArrowDecimalCheckAppendString())
+static ArrowErrorCode ArrowDecimalFinishAppendString(struct ArrowArray* array,
+                                                     enum ArrowType storage_type,
+                                                     int64_t size_bytes) {
+  struct ArrowBuffer* offset_buffer = ArrowArrayBuffer(array, 1);
+
+  if (storage_type == NANOARROW_TYPE_STRING) {
+    int32_t offset = ((int32_t*)offset_buffer->data)[array->length];
+    offset += (int32_t)size_bytes;
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppend(offset_buffer, &offset, sizeof(int32_t)));
+  } else {
+    int64_t large_offset = ((int64_t*)offset_buffer->data)[array->length];
+    large_offset += size_bytes;
+    NANOARROW_RETURN_NOT_OK(
+        ArrowBufferAppend(offset_buffer, &large_offset, sizeof(int64_t)));
+  }
+
+  if (ArrowArrayValidityBitmap(array)->buffer.data != NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowBitmapAppend(ArrowArrayValidityBitmap(array), 1, 1));
+  }
+
+  array->length++;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowArrayViewDecimalToStrings(const struct ArrowArrayView* array_view,
+                                              int32_t scale, struct ArrowArray* out,
+                                              struct ArrowError* error) {
+  int32_t bitwidth;
+  if (ArrowDecimalBitWidthFromType(array_view->storage_type, &bitwidth) !=
+      NANOARROW_OK) {
+    ArrowErrorSet(error, "Expected decimal array view but got storage type %s",
+                  ArrowTypeString(array_view->storage_type));
+    return EINVAL;
+  }
+
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)out->private_data;
+  enum ArrowType out_type = private_data->storage_type;
+  switch (out_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_STRING_VIEW:
+      break;
+    default:
+      ArrowErrorSet(error, "Expected string array but got storage type %s",
+                    ArrowTypeString(out_type));
+      return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayReserve(out, array_view->length), error);
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, bitwidth, 0, scale);
+
+  // For string and large string output, each value is formatted directly into the
+  // data buffer. For string view output, a scratch buffer is reused for every element.
+  char digits[NANOARROW_DECIMAL_MAX_DIGITS_CHARS];
+  char* digits_end = digits + sizeof(digits);
+  struct ArrowBuffer scratch;
+  ArrowBufferInit(&scratch);
+
+  struct ArrowBuffer* target = &scratch;
+  if (out_type != NANOARROW_TYPE_STRING_VIEW) {
+    target = ArrowArrayBuffer(out, 2);
+  }
+
+  struct ArrowStringView item;
+  int result = NANOARROW_OK;
+  for (int64_t i = 0; i < array_view->length; i++) {
+    if (ArrowArrayViewIsNull(array_view, i)) {
+      result = ArrowArrayAppendNull(out, 1);
+    } else {
+      ArrowArrayViewGetDecimalUnsafe(array_view, i, &decimal);
+      char* digits_start = ArrowDecimalWriteDigitsBackward(&decimal, digits_end);
+      int64_t n_chars = digits_end - digits_start;
+      scratch.size_bytes = 0;
+      int64_t size_before = target->size_bytes;
+      if (out_type == NANOARROW_TYPE_STRING_VIEW) {
+        result = ArrowDecimalAppendScaledDigits(digits_start, n_chars, scale, target);
+        if (result == NANOARROW_OK) {
+          item.data = (const char*)scratch.data;
+          item.size_bytes = scratch.size_bytes;
+          result = ArrowArrayAppendString(out, item);
+        }
+      } else {
+        // Check the offset before writing to the data buffer such that a failed
+        // append leaves out unchanged
+        int64_t size_bytes = ArrowDecimalScaledDigitsSize(digits_start, n_chars, scale);
+        result = ArrowDecimalCheckAppendString(out, out_type, size_bytes);
+        if (result == NANOARROW_OK) {
+          result = ArrowDecimalAppendScaledDigits(digits_start, n_chars, scale, target);
+        }
+        if (result == NANOARROW_OK) {
+          result = ArrowDecimalFinishAppendString(out, out_type, size_bytes);
+        }
+        if (result != NANOARROW_OK) {
+          target->size_bytes = size_before;
+        }
+      }
+    }
+
+    if (result != NANOARROW_OK) {
+      ArrowErrorSet(error, "Failed to append decimal string at index %" PRId64, i);
+      break;
+    }
+  }
+
+  ArrowBufferReset(&scratch);
+  return result;
+}
+
+ArrowErrorCode ArrowArrayAppendDecimalFromStrings(struct ArrowArray* array,
+                                                  const struct ArrowArrayView* strings,
+                                                  int32_t precision, int32_t scale,
+                                                  struct ArrowError* error) {
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  int32_t bitwidth;
+  if (ArrowDecimalBitWidthFromType(private_data->storage_type, &bitwidth) !=
+      NANOARROW_OK) {
+    ArrowErrorSet(error, "Expected decimal array but got storage type %s",
+                  ArrowTypeString(private_data->storage_type));
+    return EINVAL;
+  }
+
+  switch (strings->storage_type) {
+    case NANOARROW_TYPE_STRING:
+    case NANOARROW_TYPE_LARGE_STRING:
+    case NANOARROW_TYPE_STRING_VIEW:
+      break;
+    default:
+      ArrowErrorSet(error, "Expected string array view but got storage type %s",
+                    ArrowTypeString(strings->storage_type));
+      return EINVAL;
+  }
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, bitwidth, precision, scale);
+  if (precision < 1 || precision > ArrowDecimalMaxPrecision(&decimal)) {
+    ArrowErrorSet(error, "Expected precision between 1 and %d for decimal%d but got %d",
+                  (int)ArrowDecimalMaxPrecision(&decimal), (int)bitwidth,
+                  (int)precision);
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayReserve(array, strings->length), error);
+
+  struct ArrowStringView item;
+  for (int64_t i = 0; i < strings->length; i++) {
+    if (ArrowArrayViewIsNull(strings, i)) {
+      NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayAppendNull(array, 1), error);
+      continue;
+    }
+
+    item = ArrowArrayViewGetStringUnsafe(strings, i);
+    if (ArrowDecimalSetString(&decimal, item) != NANOARROW_OK) {
+      ArrowErrorSet(error,
+                    "Can't parse '%.*s' as a decimal%d with precision %d and scale %d "
+                    "at index %" PRId64,
+                    (int)item.size_bytes, item.data, (int)bitwidth, (int)precision,
+                    (int)scale, i);
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowArrayAppendDecimal(array, &decimal), error);
   }
 
   return NANOARROW_OK;
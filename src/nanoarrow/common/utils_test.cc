@@ -86,6 +86,89 @@ TEST(ErrorTest, ErrorTestSetStringOverrun) {
   EXPECT_EQ(std::string(ArrowErrorMessage(&error)), std::string(big_error, 1023));
 }
 
+TEST(TraceTest, TraceTestEventName) {
+  EXPECT_STREQ(ArrowTraceEventName(NANOARROW_TRACE_ARRAY_FINISH_BUILDING),
+               "array_finish_building");
+  EXPECT_STREQ(ArrowTraceEventName(NANOARROW_TRACE_IPC_ENCODE_RECORD_BATCH),
+               "ipc_encode_record_batch");
+  for (int i = 0; i < NANOARROW_TRACE_NUM_EVENTS; i++) {
+    EXPECT_NE(ArrowTraceEventName(static_cast<enum ArrowTraceEvent>(i)), nullptr);
+  }
+
+  EXPECT_EQ(ArrowTraceEventName(NANOARROW_TRACE_NUM_EVENTS), nullptr);
+}
+
+#if defined(NANOARROW_ENABLE_TRACING)
+struct TraceTestCallbackState {
+  int64_t count[NANOARROW_TRACE_NUM_EVENTS];
+};
+
+static void TraceTestCallback(enum ArrowTraceEvent event, int64_t elapsed_ns,
+                              int64_t bytes, void* private_data) {
+  NANOARROW_UNUSED(elapsed_ns);
+  NANOARROW_UNUSED(bytes);
+  auto state = reinterpret_cast<TraceTestCallbackState*>(private_data);
+  state->count[event]++;
+}
+
+TEST(TraceTest, TraceTestRecord) {
+  struct ArrowTraceStats stats;
+  ArrowTraceResetStats();
+  ASSERT_EQ(ArrowTraceGetStats(&stats), NANOARROW_OK);
+  for (int i = 0; i < NANOARROW_TRACE_NUM_EVENTS; i++) {
+    EXPECT_EQ(stats.count[i], 0);
+    EXPECT_EQ(stats.elapsed_ns[i], 0);
+    EXPECT_EQ(stats.bytes[i], 0);
+  }
+
+  int64_t start = ArrowTraceNowNs();
+  EXPECT_GT(start, 0);
+  EXPECT_GE(ArrowTraceNowNs(), start);
+
+  ArrowTraceRecord(NANOARROW_TRACE_IPC_DECOMPRESS, 10, 100);
+  ArrowTraceRecord(NANOARROW_TRACE_IPC_DECOMPRESS, 20, 200);
+  ArrowTraceRecord(NANOARROW_TRACE_NUM_EVENTS, 1, 1);
+  ASSERT_EQ(ArrowTraceGetStats(&stats), NANOARROW_OK);
+  EXPECT_EQ(stats.count[NANOARROW_TRACE_IPC_DECOMPRESS], 2);
+  EXPECT_EQ(stats.elapsed_ns[NANOARROW_TRACE_IPC_DECOMPRESS], 30);
+  EXPECT_EQ(stats.bytes[NANOARROW_TRACE_IPC_DECOMPRESS], 300);
+
+  ArrowTraceResetStats();
+  ASSERT_EQ(ArrowTraceGetStats(&stats), NANOARROW_OK);
+  EXPECT_EQ(stats.count[NANOARROW_TRACE_IPC_DECOMPRESS], 0);
+}
+
+TEST(TraceTest, TraceTestArrayBuilding) {
+  TraceTestCallbackState state{};
+  ASSERT_EQ(ArrowTraceSetCallback(&TraceTestCallback, &state), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromType(array.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(array.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuilding(array.get(), NANOARROW_VALIDATION_LEVEL_NONE,
+                                     nullptr),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowTraceSetCallback(nullptr, nullptr), NANOARROW_OK);
+  EXPECT_EQ(state.count[NANOARROW_TRACE_ARRAY_FINISH_BUILDING], 2);
+  EXPECT_EQ(state.count[NANOARROW_TRACE_ARRAY_VIEW_VALIDATE], 1);
+  EXPECT_EQ(state.count[NANOARROW_TRACE_IPC_DECOMPRESS], 0);
+}
+#else
+TEST(TraceTest, TraceTestDisabled) {
+  struct ArrowTraceStats stats;
+  EXPECT_EQ(ArrowTraceGetStats(&stats), ENOTSUP);
+  EXPECT_EQ(ArrowTraceSetCallback(nullptr, nullptr), ENOTSUP);
+  EXPECT_EQ(ArrowTraceNowNs(), 0);
+
+  // Recording and resetting are no-ops
+  ArrowTraceRecord(NANOARROW_TRACE_IPC_DECOMPRESS, 10, 100);
+  ArrowTraceResetStats();
+}
+#endif
+
 #if defined(NANOARROW_DEBUG)
 #undef NANOARROW_PRINT_AND_DIE
 #define NANOARROW_PRINT_AND_DIE(VALUE, EXPR_STR)             \
@@ -740,6 +823,400 @@ TEST(DecimalTest, DecimalTestStringNegativeScale) {
   }
 }
 
+TEST(DecimalTest, DecimalTestStringAppendToNonEmptyBuffer) {
+  using namespace nanoarrow::literals;
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 9, 3);
+
+  nanoarrow::UniqueBuffer buffer;
+  ASSERT_EQ(ArrowBufferAppend(buffer.get(), "abc", 3), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, "-1234"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowDecimalAppendStringToBuffer(&decimal, buffer.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowDecimalSetDigits(&decimal, "-12"_asv), NANOARROW_OK);
+  ASSERT_EQ(ArrowDecimalAppendStringToBuffer(&decimal, buffer.get()), NANOARROW_OK);
+  EXPECT_EQ(std::string(reinterpret_cast<char*>(buffer->data), buffer->size_bytes),
+            "abc-1.234-0.012");
+}
+
+// Builds a string array from values where a nullptr represents a null
+static void DecimalTestMakeStrings(struct ArrowArray* array, enum ArrowType type,
+                                   const std::vector<const char*>& values) {
+  NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(array, type));
+  NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array));
+  for (const char* value : values) {
+    if (value == nullptr) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendNull(array, 1));
+    } else {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendString(array, ArrowCharView(value)));
+    }
+  }
+  NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array, nullptr));
+}
+
+// Reads a string array into values where a nullptr represents a null
+static std::vector<std::string> DecimalTestReadStrings(struct ArrowArray* array,
+                                                       enum ArrowType type) {
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), type);
+  NANOARROW_THROW_NOT_OK(ArrowArrayViewSetArray(array_view.get(), array, nullptr));
+
+  std::vector<std::string> out;
+  for (int64_t i = 0; i < array->length; i++) {
+    if (ArrowArrayViewIsNull(array_view.get(), i)) {
+      out.push_back("<null>");
+    } else {
+      struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(array_view.get(), i);
+      out.push_back(std::string(item.data, item.size_bytes));
+    }
+  }
+
+  return out;
+}
+
+TEST(DecimalTest, DecimalArrayToStrings) {
+  std::vector<std::pair<enum ArrowType, std::string>> types_and_max_digits = {
+      {NANOARROW_TYPE_DECIMAL32, "999999999"},
+      {NANOARROW_TYPE_DECIMAL64, "999999999999999999"},
+      {NANOARROW_TYPE_DECIMAL128, std::string(38, '9')},
+      {NANOARROW_TYPE_DECIMAL256, std::string(76, '9')}};
+
+  for (const auto& item : types_and_max_digits) {
+    SCOPED_TRACE(ArrowTypeString(item.first));
+    int32_t precision = static_cast<int32_t>(item.second.size());
+    std::string max_int = item.second.substr(0, item.second.size() - 3);
+
+    nanoarrow::UniqueSchema schema;
+    ArrowSchemaInit(schema.get());
+    ASSERT_EQ(ArrowSchemaSetTypeDecimal(schema.get(), item.first, precision, 3),
+              NANOARROW_OK);
+
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+
+    struct ArrowSchemaView schema_view;
+    ASSERT_EQ(ArrowSchemaViewInit(&schema_view, schema.get(), nullptr), NANOARROW_OK);
+
+    struct ArrowDecimal decimal;
+    ArrowDecimalInit(&decimal, schema_view.decimal_bitwidth, precision, 3);
+
+    for (const auto& digits :
+         {std::string("0"), std::string("12"), std::string("-12"), std::string("1234"),
+          std::string("-1234"), item.second, "-" + item.second}) {
+      ASSERT_EQ(ArrowDecimalSetDigits(&decimal, ArrowCharView(digits.c_str())),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayAppendDecimal(array.get(), &decimal), NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+    nanoarrow::UniqueArrayView array_view;
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+              NANOARROW_OK);
+
+    std::vector<std::string> expected = {
+        "0.000",  "0.012", "-0.012", "1.234", "-1.234", max_int + ".999",
+        "-" + max_int + ".999", "<null>"};
+
+    for (const auto type : {NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING,
+                            NANOARROW_TYPE_STRING_VIEW}) {
+      SCOPED_TRACE(ArrowTypeString(type));
+      nanoarrow::UniqueArray strings;
+      ASSERT_EQ(ArrowArrayInitFromType(strings.get(), type), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayStartAppending(strings.get()), NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayViewDecimalToStrings(array_view.get(), 3, strings.get(),
+                                               nullptr),
+                NANOARROW_OK);
+      ASSERT_EQ(ArrowArrayFinishBuildingDefault(strings.get(), nullptr), NANOARROW_OK);
+      EXPECT_EQ(DecimalTestReadStrings(strings.get(), type), expected);
+    }
+
+    // Check a scale that differs from the type and a negative scale
+    nanoarrow::UniqueArray strings;
+    ASSERT_EQ(ArrowArrayInitFromType(strings.get(), NANOARROW_TYPE_STRING),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(strings.get()), NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowArrayViewDecimalToStrings(array_view.get(), 0, strings.get(), nullptr),
+        NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowArrayViewDecimalToStrings(array_view.get(), -2, strings.get(), nullptr),
+        NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(strings.get(), nullptr), NANOARROW_OK);
+    std::vector<std::string> actual =
+        DecimalTestReadStrings(strings.get(), NANOARROW_TYPE_STRING);
+    ASSERT_EQ(actual.size(), 16);
+    EXPECT_EQ(actual[4], "-1234");
+    EXPECT_EQ(actual[5], item.second);
+    EXPECT_EQ(actual[8], "000");
+    EXPECT_EQ(actual[12], "-123400");
+  }
+}
+
+TEST(DecimalTest, DecimalArrayToStringsInvalid) {
+  nanoarrow::UniqueArrayView array_view;
+  ArrowArrayViewInitFromType(array_view.get(), NANOARROW_TYPE_INT32);
+
+  nanoarrow::UniqueArray strings;
+  ASSERT_EQ(ArrowArrayInitFromType(strings.get(), NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(strings.get()), NANOARROW_OK);
+
+  struct ArrowError error;
+  EXPECT_EQ(ArrowArrayViewDecimalToStrings(array_view.get(), 0, strings.get(), &error),
+            EINVAL);
+  EXPECT_STREQ(error.message, "Expected decimal array view but got storage type int32");
+}
+
+TEST(DecimalTest, DecimalArrayToStringsOverflow) {
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeDecimal(schema.get(), NANOARROW_TYPE_DECIMAL128, 10, 2),
+            NANOARROW_OK);
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 10, 2);
+  ArrowDecimalSetInt(&decimal, 12345);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendDecimal(array.get(), &decimal), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  // Pretend that the output already contains almost 2 GB of string data
+  nanoarrow::UniqueArray strings;
+  ASSERT_EQ(ArrowArrayInitFromType(strings.get(), NANOARROW_TYPE_STRING), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(strings.get()), NANOARROW_OK);
+  reinterpret_cast<int32_t*>(ArrowArrayBuffer(strings.get(), 1)->data)[0] =
+      INT32_MAX - 3;
+
+  // "123.45" doesn't fit and nothing is appended
+  EXPECT_EQ(ArrowArrayViewDecimalToStrings(array_view.get(), 2, strings.get(), nullptr),
+            EOVERFLOW);
+  EXPECT_EQ(strings->length, 0);
+  EXPECT_EQ(ArrowArrayBuffer(strings.get(), 1)->size_bytes, sizeof(int32_t));
+  EXPECT_EQ(ArrowArrayBuffer(strings.get(), 2)->size_bytes, 0);
+}
+
+TEST(DecimalTest, DecimalArrayFromStrings) {
+  std::vector<std::pair<int32_t, int32_t>> bitwidth_and_max_precision = {
+      {32, 9}, {64, 18}, {128, 38}, {256, 76}};
+
+  for (const auto& item : bitwidth_and_max_precision) {
+    SCOPED_TRACE(item.first);
+    enum ArrowType type = item.first == 32    ? NANOARROW_TYPE_DECIMAL32
+                          : item.first == 64  ? NANOARROW_TYPE_DECIMAL64
+                          : item.first == 128 ? NANOARROW_TYPE_DECIMAL128
+                                              : NANOARROW_TYPE_DECIMAL256;
+    std::string max_digits(item.second, '9');
+    std::string max_int = max_digits.substr(0, max_digits.size() - 2);
+
+    nanoarrow::UniqueArray strings;
+    DecimalTestMakeStrings(
+        strings.get(), NANOARROW_TYPE_STRING,
+        {"0", "-0", "+1", "1.5", ".25", "-12.3400", "0001.20", nullptr, "-0.01",
+         (max_int + ".99").c_str(), ("-" + max_int + ".99").c_str()});
+
+    nanoarrow::UniqueArrayView strings_view;
+    ArrowArrayViewInitFromType(strings_view.get(), NANOARROW_TYPE_STRING);
+    ASSERT_EQ(ArrowArrayViewSetArray(strings_view.get(), strings.get(), nullptr),
+              NANOARROW_OK);
+
+    nanoarrow::UniqueSchema schema;
+    ArrowSchemaInit(schema.get());
+    ASSERT_EQ(ArrowSchemaSetTypeDecimal(schema.get(), type, item.second, 2),
+              NANOARROW_OK);
+
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowArrayAppendDecimalFromStrings(array.get(), strings_view.get(), item.second,
+                                           2, nullptr),
+        NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+    ASSERT_EQ(array->length, 11);
+    EXPECT_EQ(array->null_count, 1);
+
+    // Check the values by converting them back to strings
+    nanoarrow::UniqueArrayView array_view;
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+              NANOARROW_OK);
+
+    nanoarrow::UniqueArray roundtrip;
+    ASSERT_EQ(ArrowArrayInitFromType(roundtrip.get(), NANOARROW_TYPE_STRING),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(roundtrip.get()), NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowArrayViewDecimalToStrings(array_view.get(), 2, roundtrip.get(), nullptr),
+        NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(roundtrip.get(), nullptr), NANOARROW_OK);
+
+    std::vector<std::string> expected = {
+        "0.00",   "0.00",  "1.00",   "1.50",          "0.25",
+        "-12.34", "1.20",  "<null>", "-0.01",         max_int + ".99",
+        "-" + max_int + ".99"};
+    EXPECT_EQ(DecimalTestReadStrings(roundtrip.get(), NANOARROW_TYPE_STRING),
+              expected);
+
+    // Values with too many digits for the type can't be parsed
+    nanoarrow::UniqueArray too_big;
+    DecimalTestMakeStrings(too_big.get(), NANOARROW_TYPE_STRING,
+                           {"1", ("1" + max_digits).c_str()});
+    ASSERT_EQ(ArrowArrayViewSetArray(strings_view.get(), too_big.get(), nullptr),
+              NANOARROW_OK);
+
+    struct ArrowError error;
+    EXPECT_EQ(ArrowArrayAppendDecimalFromStrings(array.get(), strings_view.get(),
+                                                 item.second, 2, &error),
+              EINVAL);
+    EXPECT_EQ(std::string(error.message),
+              "Can't parse '1" + max_digits + "' as a decimal" +
+                  std::to_string(item.first) + " with precision " +
+                  std::to_string(item.second) + " and scale 2 at index 1");
+
+    // The precision can't exceed the maximum for the type
+    EXPECT_EQ(ArrowArrayAppendDecimalFromStrings(array.get(), strings_view.get(),
+                                                 item.second + 1, 2, &error),
+              EINVAL);
+    EXPECT_EQ(std::string(error.message),
+              "Expected precision between 1 and " + std::to_string(item.second) +
+                  " for decimal" + std::to_string(item.first) + " but got " +
+                  std::to_string(item.second + 1));
+  }
+}
+
+TEST(DecimalTest, DecimalArrayFromStringsScale) {
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeDecimal(schema.get(), NANOARROW_TYPE_DECIMAL128, 38, -3),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray strings;
+  DecimalTestMakeStrings(strings.get(), NANOARROW_TYPE_LARGE_STRING,
+                         {"0", "12000", "-12000.000", "000"});
+  nanoarrow::UniqueArrayView strings_view;
+  ArrowArrayViewInitFromType(strings_view.get(), NANOARROW_TYPE_LARGE_STRING);
+  ASSERT_EQ(ArrowArrayViewSetArray(strings_view.get(), strings.get(), nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowArrayAppendDecimalFromStrings(array.get(), strings_view.get(), 38, -3,
+                                         nullptr),
+      NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+            NANOARROW_OK);
+
+  struct ArrowDecimal decimal;
+  ArrowDecimalInit(&decimal, 128, 38, -3);
+  std::vector<int64_t> expected = {0, 12, -12, 0};
+  for (int64_t i = 0; i < array->length; i++) {
+    ArrowArrayViewGetDecimalUnsafe(array_view.get(), i, &decimal);
+    EXPECT_EQ(ArrowDecimalGetIntUnsafe(&decimal), expected[i]);
+  }
+
+  // Check invalid input
+  struct ArrowError error;
+  for (const auto& item :
+       std::vector<std::pair<int32_t, const char*>>{{-3, "12345"},
+                                                    {2, "1.234"},
+                                                    {2, ""},
+                                                    {2, "-"},
+                                                    {2, "."},
+                                                    {2, "1.2.3"},
+                                                    {2, "1e5"},
+                                                    {2, "abc"},
+                                                    {2, " 1"}}) {
+    SCOPED_TRACE(item.second);
+    nanoarrow::UniqueArray invalid;
+    DecimalTestMakeStrings(invalid.get(), NANOARROW_TYPE_LARGE_STRING, {item.second});
+    ASSERT_EQ(ArrowArrayViewSetArray(strings_view.get(), invalid.get(), nullptr),
+              NANOARROW_OK);
+    EXPECT_EQ(ArrowArrayAppendDecimalFromStrings(array.get(), strings_view.get(), 38,
+                                                 item.first, &error),
+              EINVAL);
+  }
+
+  // Check non-decimal output and non-string input
+  nanoarrow::UniqueArray int_array;
+  ASSERT_EQ(ArrowArrayInitFromType(int_array.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  EXPECT_EQ(
+      ArrowArrayAppendDecimalFromStrings(int_array.get(), strings_view.get(), 38, 0,
+                                         &error),
+      EINVAL);
+  EXPECT_STREQ(error.message, "Expected decimal array but got storage type int32");
+
+  nanoarrow::UniqueArrayView int_view;
+  ArrowArrayViewInitFromType(int_view.get(), NANOARROW_TYPE_INT32);
+  EXPECT_EQ(
+      ArrowArrayAppendDecimalFromStrings(array.get(), int_view.get(), 38, 0, &error),
+      EINVAL);
+  EXPECT_STREQ(error.message, "Expected string array view but got storage type int32");
+}
+
+TEST(DecimalTest, DecimalArrayFromStringsPrecision) {
+  // The declared precision is checked for both the 64-bit fast path and wider values
+  for (const auto& item : std::vector<std::pair<int32_t, std::string>>{
+           {5, "999.99"},
+           {18, std::string(16, '9') + ".99"},
+           {25, std::string(23, '9')}}) {
+    SCOPED_TRACE(item.first);
+    nanoarrow::UniqueSchema schema;
+    ArrowSchemaInit(schema.get());
+    ASSERT_EQ(
+        ArrowSchemaSetTypeDecimal(schema.get(), NANOARROW_TYPE_DECIMAL128, item.first, 2),
+        NANOARROW_OK);
+
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+
+    nanoarrow::UniqueArray strings;
+    DecimalTestMakeStrings(strings.get(), NANOARROW_TYPE_STRING,
+                           {item.second.c_str(), ("-" + item.second).c_str()});
+    nanoarrow::UniqueArrayView strings_view;
+    ArrowArrayViewInitFromType(strings_view.get(), NANOARROW_TYPE_STRING);
+    ASSERT_EQ(ArrowArrayViewSetArray(strings_view.get(), strings.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendDecimalFromStrings(array.get(), strings_view.get(),
+                                                 item.first, 2, nullptr),
+              NANOARROW_OK);
+
+    // One more integer digit exceeds the precision
+    nanoarrow::UniqueArray too_big;
+    DecimalTestMakeStrings(too_big.get(), NANOARROW_TYPE_STRING,
+                           {("1" + item.second).c_str()});
+    ASSERT_EQ(ArrowArrayViewSetArray(strings_view.get(), too_big.get(), nullptr),
+              NANOARROW_OK);
+    EXPECT_EQ(ArrowArrayAppendDecimalFromStrings(array.get(), strings_view.get(),
+                                                 item.first, 2, nullptr),
+              EINVAL);
+  }
+}
+
 // test case adapted from
 // https://github.com/apache/arrow/blob/main/go/arrow/float16/float16_test.go
 TEST(HalfFloatTest, FloatAndHalfFloatRoundTrip) {
@@ -759,6 +1236,99 @@ TEST(HalfFloatTest, FloatAndHalfFloatRoundTrip) {
   }
 }
 
+TEST(HalfFloatTest, HalfFloatToFloatN) {
+  // Check every possible half float value
+  std::vector<uint16_t> halves(1 << 16);
+  for (size_t i = 0; i < halves.size(); i++) {
+    halves[i] = static_cast<uint16_t>(i);
+  }
+
+  std::vector<float> floats(halves.size());
+  ArrowHalfFloatToFloatN(halves.data(), floats.data(),
+                         static_cast<int64_t>(halves.size()));
+
+  std::vector<uint16_t> roundtrip(halves.size());
+  ArrowFloatToHalfFloatN(floats.data(), roundtrip.data(),
+                         static_cast<int64_t>(floats.size()));
+
+  for (size_t i = 0; i < halves.size(); i++) {
+    SCOPED_TRACE(i);
+    uint16_t exp = (halves[i] >> 10) & 0x1f;
+    uint16_t mantissa = halves[i] & 0x3ff;
+    float sign = (halves[i] & 0x8000) ? -1.0f : 1.0f;
+
+    if (exp == 0x1f && mantissa != 0) {
+      EXPECT_TRUE(std::isnan(floats[i]));
+      EXPECT_EQ(roundtrip[i] & 0x7e00, 0x7e00);
+      continue;
+    } else if (exp == 0) {
+      // Subnormal values are exact multiples of 2^-24
+      EXPECT_EQ(floats[i], sign * std::ldexp(static_cast<float>(mantissa), -24));
+    } else {
+      EXPECT_EQ(floats[i], ArrowHalfFloatToFloat(halves[i]));
+    }
+
+    EXPECT_EQ(roundtrip[i], halves[i]);
+  }
+}
+
+TEST(HalfFloatTest, FloatToHalfFloatNRounding) {
+  std::vector<std::pair<float, uint16_t>> cases = {
+      // Exact values
+      {0.0f, 0x0000},
+      {-0.0f, 0x8000},
+      {1.0f, 0x3c00},
+      {-2.0f, 0xc000},
+      {65504.0f, 0x7bff},
+      {INFINITY, 0x7c00},
+      {-INFINITY, 0xfc00},
+      // Round to nearest
+      {3.14159f, 0x4248},
+      {65519.0f, 0x7bff},
+      {1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20), 0x3c01},
+      // Ties round to even
+      {1.0f + std::ldexp(1.0f, -11), 0x3c00},
+      {1.0f + 3 * std::ldexp(1.0f, -11), 0x3c02},
+      // Overflow to infinity
+      {65520.0f, 0x7c00},
+      {-1e6f, 0xfc00},
+      {std::numeric_limits<float>::max(), 0x7c00},
+      // Subnormal and underflow
+      {std::ldexp(1.0f, -24), 0x0001},
+      {-std::ldexp(3.0f, -24), 0x8003},
+      {std::ldexp(1.0f, -25), 0x0000},
+      {std::ldexp(1.0f, -25) * 1.0001f, 0x0001},
+      {std::ldexp(3.0f, -25), 0x0002},
+      {std::ldexp(1023.5f, -24), 0x0400},
+      {std::ldexp(1.0f, -14), 0x0400},
+      {1e-10f, 0x0000},
+      {std::numeric_limits<float>::denorm_min(), 0x0000}};
+
+  // Repeat the cases such that the vectorized loop and the remainder are both used
+  std::vector<float> values;
+  std::vector<uint16_t> expected;
+  for (int i = 0; i < 3; i++) {
+    for (const auto& item : cases) {
+      values.push_back(item.first);
+      expected.push_back(item.second);
+    }
+  }
+
+  std::vector<uint16_t> actual(values.size());
+  ArrowFloatToHalfFloatN(values.data(), actual.data(),
+                         static_cast<int64_t>(values.size()));
+  for (size_t i = 0; i < values.size(); i++) {
+    SCOPED_TRACE(std::to_string(i) + ": " + std::to_string(values[i]));
+    EXPECT_EQ(actual[i], expected[i]);
+    EXPECT_EQ(ArrowFloatToHalfFloat(values[i]), expected[i]);
+  }
+
+  uint16_t nan_half;
+  float nan_float = NAN;
+  ArrowFloatToHalfFloatN(&nan_float, &nan_half, 1);
+  EXPECT_TRUE(std::isnan(ArrowHalfFloatToFloat(nan_half)));
+}
+
 TEST(UtilsTest, ArrowResolveChunk64Test) {
   int64_t offsets[] = {0, 2, 3, 6};
   int64_t n_offsets = 4;
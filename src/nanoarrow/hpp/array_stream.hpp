@@ -92,6 +92,17 @@ class ArrayStreamFactory {
     out->private_data = instance;
   }
 
+  /// \brief Get the instance that owns stream
+  ///
+  /// Returns nullptr if stream was not populated by InitArrayStream() for this type.
+  static T* GetInstance(struct ArrowArrayStream* stream) {
+    if (stream->release != &release_wrapper) {
+      return nullptr;
+    }
+
+    return reinterpret_cast<T*>(stream->private_data);
+  }
+
  private:
   static int get_schema_wrapper(struct ArrowArrayStream* stream,
                                 struct ArrowSchema* schema) {
@@ -0,0 +1,659 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef NANOARROW_HPP_BUILDER_HPP_INCLUDED
+#define NANOARROW_HPP_BUILDER_HPP_INCLUDED
+
+#include <stdint.h>
+#include <string.h>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include "nanoarrow/hpp/unique.hpp"
+#include "nanoarrow/nanoarrow.h"
+
+NANOARROW_CXX_NAMESPACE_BEGIN
+
+namespace internal {
+
+template <typename T>
+struct BuilderType;
+
+template <>
+struct BuilderType<bool> : std::integral_constant<ArrowType, NANOARROW_TYPE_BOOL> {};
+template <>
+struct BuilderType<int8_t> : std::integral_constant<ArrowType, NANOARROW_TYPE_INT8> {};
+template <>
+struct BuilderType<uint8_t> : std::integral_constant<ArrowType, NANOARROW_TYPE_UINT8> {
+};
+template <>
+struct BuilderType<int16_t> : std::integral_constant<ArrowType, NANOARROW_TYPE_INT16> {
+};
+template <>
+struct BuilderType<uint16_t>
+    : std::integral_constant<ArrowType, NANOARROW_TYPE_UINT16> {};
+template <>
+struct BuilderType<int32_t> : std::integral_constant<ArrowType, NANOARROW_TYPE_INT32> {
+};
+template <>
+struct BuilderType<uint32_t>
+    : std::integral_constant<ArrowType, NANOARROW_TYPE_UINT32> {};
+template <>
+struct BuilderType<int64_t> : std::integral_constant<ArrowType, NANOARROW_TYPE_INT64> {
+};
+template <>
+struct BuilderType<uint64_t>
+    : std::integral_constant<ArrowType, NANOARROW_TYPE_UINT64> {};
+template <>
+struct BuilderType<float> : std::integral_constant<ArrowType, NANOARROW_TYPE_FLOAT> {};
+template <>
+struct BuilderType<double> : std::integral_constant<ArrowType, NANOARROW_TYPE_DOUBLE> {
+};
+
+// Storage for the values of a fixed-width builder. Values are written directly
+// into the reserved region of an ArrowBuffer.
+template <typename T>
+class BuilderValues {
+ public:
+  ArrowErrorCode Reserve(int64_t additional_size) {
+    return ArrowBufferReserve(buffer_.get(),
+                              additional_size * static_cast<int64_t>(sizeof(T)));
+  }
+
+  ArrowErrorCode Append(T value) {
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(buffer_.get(), sizeof(T)));
+    AppendUnsafe(value);
+    return NANOARROW_OK;
+  }
+
+  void AppendUnsafe(T value) {
+    ArrowBufferAppendUnsafe(buffer_.get(), &value, sizeof(T));
+  }
+
+  template <typename InputIt>
+  void AppendUnsafe(InputIt first, int64_t n) {
+    T* out = reinterpret_cast<T*>(buffer_->data + buffer_->size_bytes);
+    for (int64_t i = 0; i < n; i++, ++first) {
+      out[i] = static_cast<T>(*first);
+    }
+    buffer_->size_bytes += n * static_cast<int64_t>(sizeof(T));
+  }
+
+  ArrowErrorCode AppendZeros(int64_t n) {
+    return ArrowBufferAppendFill(buffer_.get(), 0, n * static_cast<int64_t>(sizeof(T)));
+  }
+
+  T Get(int64_t i) const {
+    T value;
+    memcpy(&value, buffer_->data + i * static_cast<int64_t>(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  void Truncate(int64_t size) {
+    buffer_->size_bytes = size * static_cast<int64_t>(sizeof(T));
+  }
+
+  void MoveTo(struct ArrowBuffer* out) { ArrowBufferMove(buffer_.get(), out); }
+
+ private:
+  UniqueBuffer buffer_;
+};
+
+// Bits past size are left as they are: appending always writes every bit it covers
+inline void TruncateBitmap(struct ArrowBitmap* bitmap, int64_t size) {
+  bitmap->size_bits = size;
+  bitmap->buffer.size_bytes = _ArrowBytesForBits(size);
+}
+
+// Boolean values are bit-packed and are written into an ArrowBitmap
+template <>
+class BuilderValues<bool> {
+ public:
+  ArrowErrorCode Reserve(int64_t additional_size) {
+    return ArrowBitmapReserve(bitmap_.get(), additional_size);
+  }
+
+  ArrowErrorCode Append(bool value) { return ArrowBitmapAppend(bitmap_.get(), value, 1); }
+
+  void AppendUnsafe(bool value) { ArrowBitmapAppendUnsafe(bitmap_.get(), value, 1); }
+
+  template <typename InputIt>
+  void AppendUnsafe(InputIt first, int64_t n) {
+    for (int64_t i = 0; i < n; i++, ++first) {
+      ArrowBitmapAppendUnsafe(bitmap_.get(), static_cast<bool>(*first), 1);
+    }
+  }
+
+  ArrowErrorCode AppendZeros(int64_t n) { return ArrowBitmapAppend(bitmap_.get(), 0, n); }
+
+  void Truncate(int64_t size) { TruncateBitmap(bitmap_.get(), size); }
+
+  void MoveTo(struct ArrowBuffer* out) {
+    ArrowBufferMove(&bitmap_->buffer, out);
+    bitmap_->size_bits = 0;
+  }
+
+ private:
+  UniqueBitmap bitmap_;
+};
+
+// A validity bitmap that is only allocated once the first null is appended
+class BuilderValidity {
+ public:
+  ArrowErrorCode Reserve(int64_t additional_size) {
+    if (materialized_) {
+      return ArrowBitmapReserve(bitmap_.get(), additional_size);
+    }
+
+    return NANOARROW_OK;
+  }
+
+  ArrowErrorCode AppendValid(int64_t n) {
+    if (materialized_) {
+      return ArrowBitmapAppend(bitmap_.get(), 1, n);
+    }
+
+    return NANOARROW_OK;
+  }
+
+  void AppendValidUnsafe(int64_t n) {
+    if (materialized_) {
+      ArrowBitmapAppendUnsafe(bitmap_.get(), 1, n);
+    }
+  }
+
+  ArrowErrorCode AppendNull(int64_t length, int64_t n) {
+    if (!materialized_) {
+      NANOARROW_RETURN_NOT_OK(ArrowBitmapReserve(bitmap_.get(), length + n));
+      ArrowBitmapAppendUnsafe(bitmap_.get(), 1, length);
+      materialized_ = true;
+    }
+
+    return ArrowBitmapAppend(bitmap_.get(), 0, n);
+  }
+
+  void Truncate(int64_t size) {
+    if (materialized_) {
+      TruncateBitmap(bitmap_.get(), size);
+    }
+  }
+
+  void MoveTo(struct ArrowBitmap* out) {
+    ArrowBitmapMove(bitmap_.get(), out);
+    materialized_ = false;
+  }
+
+ private:
+  UniqueBitmap bitmap_;
+  bool materialized_{false};
+};
+
+inline ArrowStringView AsStringView(ArrowStringView value) { return value; }
+
+inline ArrowStringView AsStringView(const std::string& value) {
+  return {value.data(), static_cast<int64_t>(value.size())};
+}
+
+inline ArrowStringView AsStringView(const char* value) {
+  return {value, static_cast<int64_t>(strlen(value))};
+}
+
+}  // namespace internal
+
+/// \defgroup nanoarrow_hpp-builder Array builders
+///
+/// Typed helpers to build ArrowArray objects whose append paths are resolved
+/// at compile time. Unlike the ArrowArrayAppend*() family of functions, values
+/// are written directly into reserved ArrowBuffer memory without dispatching
+/// on the storage type for each element. Like the rest of the nanoarrow C++
+/// helpers, builders do not throw and instead return an ArrowErrorCode. If an
+/// append fails, the builder is left as it was before the call. After finish() is
+/// called, a builder is empty and may be reused.
+///
+/// @{
+
+template <typename... Children>
+class StructBuilder;
+
+/// \brief A builder for arrays of a fixed-width type
+///
+/// T may be bool, any fixed-width signed or unsigned integer, float or double.
+template <typename T>
+class ArrayBuilder {
+ public:
+  using value_type = T;
+
+  /// \brief The Arrow type of arrays produced by this builder
+  static ArrowType type() { return internal::BuilderType<T>::value; }
+
+  /// \brief Reserve space for at least additional_size more elements
+  ArrowErrorCode reserve(int64_t additional_size) {
+    NANOARROW_RETURN_NOT_OK(values_.Reserve(additional_size));
+    return validity_.Reserve(additional_size);
+  }
+
+  /// \brief Append a non-null value
+  ArrowErrorCode push_back(T value) {
+    NANOARROW_RETURN_NOT_OK(reserve(1));
+    values_.AppendUnsafe(value);
+    validity_.AppendValidUnsafe(1);
+    ++length_;
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append n null values
+  ArrowErrorCode append_nulls(int64_t n) {
+    NANOARROW_RETURN_NOT_OK(values_.Reserve(n));
+    NANOARROW_RETURN_NOT_OK(validity_.AppendNull(length_, n));
+    NANOARROW_ASSERT_OK(values_.AppendZeros(n));
+    length_ += n;
+    null_count_ += n;
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append a null value
+  ArrowErrorCode append_null() { return append_nulls(1); }
+
+  /// \brief Append non-null values from a pair of forward iterators
+  template <typename InputIt>
+  ArrowErrorCode append_range(InputIt first, InputIt last) {
+    int64_t n = static_cast<int64_t>(std::distance(first, last));
+    NANOARROW_RETURN_NOT_OK(reserve(n));
+    values_.AppendUnsafe(first, n);
+    validity_.AppendValidUnsafe(n);
+    length_ += n;
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append non-null values from a range (e.g., a std::vector<T>)
+  template <typename Range>
+  ArrowErrorCode append_range(const Range& values) {
+    return append_range(std::begin(values), std::end(values));
+  }
+
+  /// \brief The number of elements appended so far
+  int64_t size() const { return length_; }
+
+  /// \brief The number of null elements appended so far
+  int64_t null_count() const { return null_count_; }
+
+  /// \brief Move the appended values into out and reset this builder
+  ArrowErrorCode finish(struct ArrowArray* out, struct ArrowError* error = nullptr) {
+    UniqueArray array;
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array.get(), type()));
+    values_.MoveTo(ArrowArrayBuffer(array.get(), 1));
+    validity_.MoveTo(ArrowArrayValidityBitmap(array.get()));
+    array->length = length_;
+    array->null_count = null_count_;
+    length_ = 0;
+    null_count_ = 0;
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), error));
+    ArrowArrayMove(array.get(), out);
+    return NANOARROW_OK;
+  }
+
+ private:
+  template <typename... Children>
+  friend class StructBuilder;
+
+  internal::BuilderValues<T> values_;
+  internal::BuilderValidity validity_;
+  int64_t length_{0};
+  int64_t null_count_{0};
+
+  // Remove the last n elements, n_null of which are null
+  void RollbackUnsafe(int64_t n, int64_t n_null) {
+    length_ -= n;
+    null_count_ -= n_null;
+    values_.Truncate(length_);
+    validity_.Truncate(length_);
+  }
+};
+
+/// \brief A builder for string or binary arrays
+///
+/// The type may be one of NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING,
+/// NANOARROW_TYPE_BINARY, or NANOARROW_TYPE_LARGE_BINARY. Values may be
+/// appended as ArrowStringView, std::string, or null-terminated strings.
+template <ArrowType Type = NANOARROW_TYPE_STRING>
+class StringBuilder {
+ private:
+  static_assert(Type == NANOARROW_TYPE_STRING || Type == NANOARROW_TYPE_LARGE_STRING ||
+                    Type == NANOARROW_TYPE_BINARY || Type == NANOARROW_TYPE_LARGE_BINARY,
+                "StringBuilder requires a string or binary type");
+  using OffsetType =
+      typename std::conditional<Type == NANOARROW_TYPE_STRING ||
+                                    Type == NANOARROW_TYPE_BINARY,
+                                int32_t, int64_t>::type;
+
+ public:
+  using value_type = ArrowStringView;
+
+  /// \brief The Arrow type of arrays produced by this builder
+  static ArrowType type() { return Type; }
+
+  /// \brief Reserve space for at least additional_size more elements
+  ///
+  /// Optionally also reserve additional_data_size bytes of string data.
+  ArrowErrorCode reserve(int64_t additional_size, int64_t additional_data_size = 0) {
+    NANOARROW_RETURN_NOT_OK(offsets_.Reserve(additional_size + 1));
+    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(data_.get(), additional_data_size));
+    return validity_.Reserve(additional_size);
+  }
+
+  /// \brief Append a non-null value
+  template <typename StringLike>
+  ArrowErrorCode push_back(const StringLike& value) {
+    ArrowStringView view = internal::AsStringView(value);
+    NANOARROW_RETURN_NOT_OK(CheckDataSize(view.size_bytes));
+    NANOARROW_RETURN_NOT_OK(reserve(1, view.size_bytes));
+    AppendUnsafe(view);
+    validity_.AppendValidUnsafe(1);
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append n null values
+  ArrowErrorCode append_nulls(int64_t n) {
+    NANOARROW_RETURN_NOT_OK(offsets_.Reserve(n + 1));
+    InitOffsetsUnsafe();
+    NANOARROW_RETURN_NOT_OK(validity_.AppendNull(length_, n));
+    for (int64_t i = 0; i < n; i++) {
+      offsets_.AppendUnsafe(static_cast<OffsetType>(data_->size_bytes));
+    }
+
+    length_ += n;
+    null_count_ += n;
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append a null value
+  ArrowErrorCode append_null() { return append_nulls(1); }
+
+  /// \brief Append non-null values from a pair of forward iterators
+  template <typename InputIt>
+  ArrowErrorCode append_range(InputIt first, InputIt last) {
+    int64_t n = static_cast<int64_t>(std::distance(first, last));
+    int64_t data_size = 0;
+    for (InputIt it = first; it != last; ++it) {
+      data_size += internal::AsStringView(*it).size_bytes;
+    }
+
+    // Check everything that can fail before appending anything
+    NANOARROW_RETURN_NOT_OK(CheckDataSize(data_size));
+    NANOARROW_RETURN_NOT_OK(reserve(n, data_size));
+    for (; first != last; ++first) {
+      AppendUnsafe(internal::AsStringView(*first));
+    }
+
+    validity_.AppendValidUnsafe(n);
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append non-null values from a range (e.g., a std::vector<std::string>)
+  template <typename Range>
+  ArrowErrorCode append_range(const Range& values) {
+    return append_range(std::begin(values), std::end(values));
+  }
+
+  /// \brief The number of elements appended so far
+  int64_t size() const { return length_; }
+
+  /// \brief The number of null elements appended so far
+  int64_t null_count() const { return null_count_; }
+
+  /// \brief Move the appended values into out and reset this builder
+  ArrowErrorCode finish(struct ArrowArray* out, struct ArrowError* error = nullptr) {
+    NANOARROW_RETURN_NOT_OK(offsets_.Reserve(1));
+    InitOffsetsUnsafe();
+
+    UniqueArray array;
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array.get(), type()));
+    offsets_.MoveTo(ArrowArrayBuffer(array.get(), 1));
+    ArrowBufferMove(data_.get(), ArrowArrayBuffer(array.get(), 2));
+    validity_.MoveTo(ArrowArrayValidityBitmap(array.get()));
+    array->length = length_;
+    array->null_count = null_count_;
+    length_ = 0;
+    null_count_ = 0;
+    offsets_initialized_ = false;
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), error));
+    ArrowArrayMove(array.get(), out);
+    return NANOARROW_OK;
+  }
+
+ private:
+  template <typename... Children>
+  friend class StructBuilder;
+
+  internal::BuilderValues<OffsetType> offsets_;
+  UniqueBuffer data_;
+  internal::BuilderValidity validity_;
+  int64_t length_{0};
+  int64_t null_count_{0};
+
+  bool offsets_initialized_{false};
+
+  // The first offset is written lazily because constructors can't fail. Callers
+  // must have reserved space for it.
+  void InitOffsetsUnsafe() {
+    if (!offsets_initialized_) {
+      offsets_.AppendUnsafe(0);
+      offsets_initialized_ = true;
+    }
+  }
+
+  ArrowErrorCode CheckDataSize(int64_t additional_data_size) const {
+    if (sizeof(OffsetType) == sizeof(int32_t) &&
+        (data_->size_bytes + additional_data_size) > INT32_MAX) {
+      return EOVERFLOW;
+    }
+
+    return NANOARROW_OK;
+  }
+
+  // Callers must have checked the data size with CheckDataSize() and reserved space
+  void AppendUnsafe(ArrowStringView value) {
+    InitOffsetsUnsafe();
+    ArrowBufferAppendUnsafe(data_.get(), value.data, value.size_bytes);
+    offsets_.AppendUnsafe(static_cast<OffsetType>(data_->size_bytes));
+    ++length_;
+  }
+
+  // Remove the last n elements, n_null of which are null
+  void RollbackUnsafe(int64_t n, int64_t n_null) {
+    length_ -= n;
+    null_count_ -= n_null;
+    if (offsets_initialized_) {
+      offsets_.Truncate(length_ + 1);
+      data_->size_bytes = static_cast<int64_t>(offsets_.Get(length_));
+    }
+    validity_.Truncate(length_);
+  }
+};
+
+/// \brief A builder for struct arrays whose children are other builders
+///
+/// Rows can be appended with push_back() by passing one value per child, or by
+/// appending to each child() individually followed by finish_element().
+template <typename... Children>
+class StructBuilder {
+ public:
+  /// \brief The Arrow type of arrays produced by this builder
+  static ArrowType type() { return NANOARROW_TYPE_STRUCT; }
+
+  /// \brief The number of child builders
+  static int64_t num_children() { return sizeof...(Children); }
+
+  /// \brief Access the builder for child I
+  template <size_t I>
+  typename std::tuple_element<I, std::tuple<Children...>>::type& child() {
+    return std::get<I>(children_);
+  }
+
+  /// \brief Append a non-null row with one value per child
+  template <typename... Args>
+  ArrowErrorCode push_back(const Args&... values) {
+    static_assert(sizeof...(Args) == sizeof...(Children),
+                  "StructBuilder::push_back() requires one value per child");
+    // If any child fails, the children that were already appended to are rolled
+    // back so that all children keep the same length
+    NANOARROW_RETURN_NOT_OK(validity_.Reserve(1));
+    NANOARROW_RETURN_NOT_OK(PushBackChildren<0>(values...));
+    validity_.AppendValidUnsafe(1);
+    ++length_;
+    return NANOARROW_OK;
+  }
+
+  /// \brief Mark a non-null row whose child values were appended individually
+  ArrowErrorCode finish_element() {
+    NANOARROW_RETURN_NOT_OK(validity_.AppendValid(1));
+    ++length_;
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append n null rows (also appending n nulls to each child)
+  ArrowErrorCode append_nulls(int64_t n) {
+    NANOARROW_RETURN_NOT_OK(validity_.AppendNull(length_, n));
+    ArrowErrorCode result = AppendNullsChildren<0>(n);
+    if (result != NANOARROW_OK) {
+      validity_.Truncate(length_);
+      return result;
+    }
+
+    length_ += n;
+    null_count_ += n;
+    return NANOARROW_OK;
+  }
+
+  /// \brief Append a null row
+  ArrowErrorCode append_null() { return append_nulls(1); }
+
+  /// \brief The number of rows appended so far
+  int64_t size() const { return length_; }
+
+  /// \brief The number of null rows appended so far
+  int64_t null_count() const { return null_count_; }
+
+  /// \brief Move the appended rows into out and reset this builder
+  ArrowErrorCode finish(struct ArrowArray* out, struct ArrowError* error = nullptr) {
+    UniqueArray array;
+    NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(array.get(), type()));
+    NANOARROW_RETURN_NOT_OK(ArrowArrayAllocateChildren(array.get(), num_children()));
+    NANOARROW_RETURN_NOT_OK(FinishChildren<0>(array.get(), error));
+    validity_.MoveTo(ArrowArrayValidityBitmap(array.get()));
+    array->length = length_;
+    array->null_count = null_count_;
+    length_ = 0;
+    null_count_ = 0;
+
+    NANOARROW_RETURN_NOT_OK(ArrowArrayFinishBuildingDefault(array.get(), error));
+    ArrowArrayMove(array.get(), out);
+    return NANOARROW_OK;
+  }
+
+ private:
+  template <typename... Other>
+  friend class StructBuilder;
+
+  std::tuple<Children...> children_;
+  internal::BuilderValidity validity_;
+  int64_t length_{0};
+  int64_t null_count_{0};
+
+  template <size_t I>
+  ArrowErrorCode PushBackChildren() {
+    return NANOARROW_OK;
+  }
+
+  template <size_t I, typename Arg, typename... Rest>
+  ArrowErrorCode PushBackChildren(const Arg& value, const Rest&... rest) {
+    NANOARROW_RETURN_NOT_OK(std::get<I>(children_).push_back(value));
+    ArrowErrorCode result = PushBackChildren<I + 1>(rest...);
+    if (result != NANOARROW_OK) {
+      std::get<I>(children_).RollbackUnsafe(1, 0);
+    }
+
+    return result;
+  }
+
+  template <size_t I>
+  typename std::enable_if<I == sizeof...(Children), ArrowErrorCode>::type
+  AppendNullsChildren(int64_t n) {
+    NANOARROW_UNUSED(n);
+    return NANOARROW_OK;
+  }
+
+  template <size_t I>
+  typename std::enable_if<(I < sizeof...(Children)), ArrowErrorCode>::type
+  AppendNullsChildren(int64_t n) {
+    NANOARROW_RETURN_NOT_OK(std::get<I>(children_).append_nulls(n));
+    ArrowErrorCode result = AppendNullsChildren<I + 1>(n);
+    if (result != NANOARROW_OK) {
+      std::get<I>(children_).RollbackUnsafe(n, n);
+    }
+
+    return result;
+  }
+
+  // Remove the last n rows, n_null of which are null. Rows appended with push_back()
+  // or append_nulls() add exactly one non-null or null element to each child.
+  void RollbackUnsafe(int64_t n, int64_t n_null) {
+    length_ -= n;
+    null_count_ -= n_null;
+    validity_.Truncate(length_);
+    RollbackChildren<0>(n, n_null);
+  }
+
+  template <size_t I>
+  typename std::enable_if<I == sizeof...(Children)>::type RollbackChildren(
+      int64_t n, int64_t n_null) {
+    NANOARROW_UNUSED(n);
+    NANOARROW_UNUSED(n_null);
+  }
+
+  template <size_t I>
+  typename std::enable_if<(I < sizeof...(Children))>::type RollbackChildren(
+      int64_t n, int64_t n_null) {
+    std::get<I>(children_).RollbackUnsafe(n, n_null);
+    RollbackChildren<I + 1>(n, n_null);
+  }
+
+  template <size_t I>
+  typename std::enable_if<I == sizeof...(Children), ArrowErrorCode>::type
+  FinishChildren(struct ArrowArray* array, struct ArrowError* error) {
+    NANOARROW_UNUSED(array);
+    NANOARROW_UNUSED(error);
+    return NANOARROW_OK;
+  }
+
+  template <size_t I>
+  typename std::enable_if<(I < sizeof...(Children)), ArrowErrorCode>::type
+  FinishChildren(struct ArrowArray* array, struct ArrowError* error) {
+    NANOARROW_RETURN_NOT_OK(std::get<I>(children_).finish(array->children[I], error));
+    return FinishChildren<I + 1>(array, error);
+  }
+};
+
+/// @}
+
+NANOARROW_CXX_NAMESPACE_END
+
+#endif
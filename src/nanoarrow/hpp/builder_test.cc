@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include "nanoarrow/nanoarrow.hpp"
+#include "nanoarrow/nanoarrow_gtest_util.hpp"
+
+using testing::ElementsAre;
+
+TEST(NanoarrowHppTest, NanoarrowHppArrayBuilderTest) {
+  nanoarrow::ArrayBuilder<int32_t> builder;
+  EXPECT_EQ(builder.type(), NANOARROW_TYPE_INT32);
+  ASSERT_EQ(builder.push_back(1), NANOARROW_OK);
+  ASSERT_EQ(builder.append_range(std::vector<int32_t>{2, 3}), NANOARROW_OK);
+  EXPECT_EQ(builder.size(), 3);
+  EXPECT_EQ(builder.null_count(), 0);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->length, 3);
+  EXPECT_EQ(array->null_count, 0);
+  EXPECT_EQ(array->buffers[0], nullptr);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(array.get()), ElementsAre(1, 2, 3));
+
+  // Check that the builder can be reused after finish()
+  EXPECT_EQ(builder.size(), 0);
+  ASSERT_EQ(builder.push_back(4), NANOARROW_OK);
+  array.reset();
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int32_t>(array.get()), ElementsAre(4));
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppArrayBuilderNullsTest) {
+  nanoarrow::ArrayBuilder<double> builder;
+  ASSERT_EQ(builder.push_back(1.5), NANOARROW_OK);
+  ASSERT_EQ(builder.append_nulls(2), NANOARROW_OK);
+  ASSERT_EQ(builder.reserve(10), NANOARROW_OK);
+  ASSERT_EQ(builder.push_back(2.5), NANOARROW_OK);
+  std::vector<float> more{3.5, 4.5};
+  ASSERT_EQ(builder.append_range(more.begin(), more.end()), NANOARROW_OK);
+  ASSERT_EQ(builder.append_null(), NANOARROW_OK);
+  EXPECT_EQ(builder.null_count(), 3);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->length, 7);
+  EXPECT_EQ(array->null_count, 3);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<double>(array.get()),
+              ElementsAre(1.5, nanoarrow::NA, nanoarrow::NA, 2.5, 3.5, 4.5,
+                          nanoarrow::NA));
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppArrayBuilderBoolTest) {
+  nanoarrow::ArrayBuilder<bool> builder;
+  EXPECT_EQ(builder.type(), NANOARROW_TYPE_BOOL);
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(builder.push_back(i % 3 == 0), NANOARROW_OK);
+  }
+  ASSERT_EQ(builder.append_null(), NANOARROW_OK);
+  ASSERT_EQ(builder.append_range(std::vector<bool>{true, false}), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->length, 13);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<bool>(array.get()),
+              ElementsAre(true, false, false, true, false, false, true, false, false,
+                          true, nanoarrow::NA, true, false));
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppStringBuilderTest) {
+  using namespace nanoarrow::literals;
+
+  nanoarrow::StringBuilder<> builder;
+  EXPECT_EQ(builder.type(), NANOARROW_TYPE_STRING);
+  ASSERT_EQ(builder.push_back("abc"), NANOARROW_OK);
+  ASSERT_EQ(builder.push_back(std::string("defg")), NANOARROW_OK);
+  ASSERT_EQ(builder.append_null(), NANOARROW_OK);
+  ASSERT_EQ(builder.push_back(""_asv), NANOARROW_OK);
+  ASSERT_EQ(builder.append_range(std::vector<std::string>{"hi", "jk"}), NANOARROW_OK);
+  EXPECT_EQ(builder.size(), 6);
+  EXPECT_EQ(builder.null_count(), 1);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(array.get()),
+              ElementsAre("abc"_asv, "defg"_asv, nanoarrow::NA, ""_asv, "hi"_asv,
+                          "jk"_asv));
+
+  // An empty builder should still produce a valid offsets buffer
+  array.reset();
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->length, 0);
+  EXPECT_NE(array->buffers[1], nullptr);
+
+  nanoarrow::StringBuilder<NANOARROW_TYPE_LARGE_BINARY> large_builder;
+  ASSERT_EQ(large_builder.append_nulls(2), NANOARROW_OK);
+  ASSERT_EQ(large_builder.push_back("abc"), NANOARROW_OK);
+  array.reset();
+  ASSERT_EQ(large_builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<64>(array.get()),
+              ElementsAre(nanoarrow::NA, nanoarrow::NA, "abc"_asv));
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppStructBuilderTest) {
+  using namespace nanoarrow::literals;
+
+  nanoarrow::StructBuilder<nanoarrow::ArrayBuilder<int64_t>, nanoarrow::StringBuilder<>>
+      builder;
+  EXPECT_EQ(builder.num_children(), 2);
+  ASSERT_EQ(builder.push_back(1, "one"), NANOARROW_OK);
+  ASSERT_EQ(builder.append_null(), NANOARROW_OK);
+  ASSERT_EQ(builder.child<0>().push_back(3), NANOARROW_OK);
+  ASSERT_EQ(builder.child<1>().append_null(), NANOARROW_OK);
+  ASSERT_EQ(builder.finish_element(), NANOARROW_OK);
+  EXPECT_EQ(builder.size(), 3);
+  EXPECT_EQ(builder.null_count(), 1);
+
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->length, 3);
+  EXPECT_EQ(array->null_count, 1);
+  ASSERT_EQ(array->n_children, 2);
+
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT64), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_STRING), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewValidate(array_view.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+                                   nullptr),
+            NANOARROW_OK);
+
+  EXPECT_FALSE(ArrowArrayViewIsNull(array_view.get(), 0));
+  EXPECT_TRUE(ArrowArrayViewIsNull(array_view.get(), 1));
+  EXPECT_FALSE(ArrowArrayViewIsNull(array_view.get(), 2));
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int64_t>(array->children[0]),
+              ElementsAre(1, nanoarrow::NA, 3));
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(array->children[1]),
+              ElementsAre("one"_asv, nanoarrow::NA, nanoarrow::NA));
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppBuilderOverflowTest) {
+  using namespace nanoarrow::literals;
+
+  // The size is checked before any bytes are read, so this doesn't need to point to
+  // INT32_MAX + 1 bytes of memory
+  ArrowStringView too_big = {"x", static_cast<int64_t>(INT32_MAX) + 1};
+
+  nanoarrow::StringBuilder<> builder;
+  ASSERT_EQ(builder.push_back("abc"), NANOARROW_OK);
+  EXPECT_EQ(builder.push_back(too_big), EOVERFLOW);
+  EXPECT_EQ(builder.append_range(std::vector<ArrowStringView>{"de"_asv, too_big}),
+            EOVERFLOW);
+  EXPECT_EQ(builder.size(), 1);
+  ASSERT_EQ(builder.push_back("fg"), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(array.get()),
+              ElementsAre("abc"_asv, "fg"_asv));
+
+  // A row whose second child fails must not leave a value in the first child
+  nanoarrow::StructBuilder<nanoarrow::ArrayBuilder<int64_t>, nanoarrow::StringBuilder<>>
+      struct_builder;
+  ASSERT_EQ(struct_builder.push_back(1, "one"), NANOARROW_OK);
+  EXPECT_EQ(struct_builder.push_back(2, too_big), EOVERFLOW);
+  EXPECT_EQ(struct_builder.size(), 1);
+  EXPECT_EQ(struct_builder.child<0>().size(), 1);
+  EXPECT_EQ(struct_builder.child<1>().size(), 1);
+  ASSERT_EQ(struct_builder.append_null(), NANOARROW_OK);
+  ASSERT_EQ(struct_builder.push_back(3, "three"), NANOARROW_OK);
+
+  array.reset();
+  ASSERT_EQ(struct_builder.finish(array.get()), NANOARROW_OK);
+  EXPECT_EQ(array->length, 3);
+  EXPECT_EQ(array->null_count, 1);
+  EXPECT_THAT(nanoarrow::ViewArrayAs<int64_t>(array->children[0]),
+              ElementsAre(1, nanoarrow::NA, 3));
+  EXPECT_THAT(nanoarrow::ViewArrayAsBytes<32>(array->children[1]),
+              ElementsAre("one"_asv, nanoarrow::NA, "three"_asv));
+}
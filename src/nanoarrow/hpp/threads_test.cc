@@ -0,0 +1,493 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include "nanoarrow/nanoarrow.hpp"
+#include "nanoarrow/nanoarrow_threads.hpp"
+
+using testing::ElementsAre;
+
+// Blocks Wait() until CountDown() has been called count times (like C++20's
+// std::latch) so that tests can order events across threads without sleeping
+class Latch {
+ public:
+  explicit Latch(int64_t count) : count_(count) {}
+
+  void CountDown() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--count_ == 0) {
+      cv_.notify_all();
+    }
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return count_ <= 0; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  int64_t count_;
+};
+
+static void MakeInt32Array(struct ArrowArray* array, int32_t value) {
+  NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(array, NANOARROW_TYPE_INT32));
+  NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(array));
+  NANOARROW_THROW_NOT_OK(ArrowArrayAppendInt(array, value));
+  NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(array, nullptr));
+}
+
+TEST(HppThreads, QueueArrayStream) {
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::QueueArrayStream queue(schema_in.get(), 2);
+  nanoarrow::UniqueArrayStream array_stream;
+  queue.ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowArrayStreamGetSchema(array_stream.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema->format, "i");
+
+  std::thread producer([&queue] {
+    for (int32_t i = 0; i < 100; i++) {
+      nanoarrow::UniqueArray array;
+      MakeInt32Array(array.get(), i);
+      ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+      EXPECT_LE(queue.size(), 2);
+    }
+    queue.close();
+  });
+
+  std::vector<int32_t> values;
+  nanoarrow::ViewArrayStream array_stream_view(array_stream.get());
+  for (ArrowArray& array : array_stream_view) {
+    for (auto value : nanoarrow::ViewArrayAs<int32_t>(&array)) {
+      values.push_back(*value);
+    }
+  }
+
+  producer.join();
+  EXPECT_EQ(array_stream_view.code(), NANOARROW_OK);
+  ASSERT_EQ(values.size(), 100U);
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(values[i], i);
+  }
+
+  // Pushing after close is an error
+  nanoarrow::UniqueArray array;
+  MakeInt32Array(array.get(), 0);
+  EXPECT_EQ(queue.push(array.get()), EINVAL);
+  EXPECT_NE(array->release, nullptr);
+}
+
+TEST(HppThreads, QueueArrayStreamBackpressure) {
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::QueueArrayStream queue(schema_in.get(), 1);
+  nanoarrow::UniqueArrayStream array_stream;
+  queue.ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueArray array;
+  MakeInt32Array(array.get(), 0);
+  ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+
+  // The queue is full, so the second push can't complete until the first array has
+  // been consumed: whenever it returns, the queue holds only the second array
+  int64_t size_after_push = -1;
+  std::thread producer([&queue, &size_after_push] {
+    nanoarrow::UniqueArray array;
+    MakeInt32Array(array.get(), 1);
+    ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+    size_after_push = queue.size();
+  });
+
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(*nanoarrow::ViewArrayAs<int32_t>(array.get())[0], 0);
+  producer.join();
+  EXPECT_EQ(size_after_push, 1);
+  EXPECT_EQ(queue.size(), 1);
+}
+
+TEST(HppThreads, QueueArrayStreamError) {
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::QueueArrayStream queue(schema_in.get());
+  nanoarrow::UniqueArrayStream array_stream;
+  queue.ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueArray array;
+  MakeInt32Array(array.get(), 0);
+  ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+  queue.close(EIO, "producer failed");
+
+  // Queued arrays are still delivered before the error
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_NE(array->release, nullptr);
+  array.reset();
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr), EIO);
+  EXPECT_STREQ(ArrowArrayStreamGetLastError(array_stream.get()), "producer failed");
+}
+
+TEST(HppThreads, QueueArrayStreamConsumerReleased) {
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::QueueArrayStream queue(schema_in.get(), 1);
+  nanoarrow::UniqueArrayStream array_stream;
+  queue.ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueArray array;
+  MakeInt32Array(array.get(), 0);
+  ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+
+  // A producer pushing to a full queue is woken up (or turned away, if it gets there
+  // after the release) when the consumer goes away
+  Latch producer_started(1);
+  std::thread producer([&queue, &producer_started] {
+    nanoarrow::UniqueArray array;
+    MakeInt32Array(array.get(), 1);
+    producer_started.CountDown();
+    EXPECT_EQ(queue.push(array.get()), ECANCELED);
+    EXPECT_NE(array->release, nullptr);
+  });
+
+  producer_started.Wait();
+  array_stream.reset();
+  producer.join();
+}
+
+TEST(HppThreads, QueueArrayStreamMoveAssign) {
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  nanoarrow::QueueArrayStream queue(schema_in.get(), 1);
+  nanoarrow::UniqueArrayStream array_stream;
+  queue.ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueArray array;
+  MakeInt32Array(array.get(), 0);
+  ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+
+  // Replacing the queue closes it, so its consumer sees the end of the stream after
+  // the arrays that were already queued
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+  nanoarrow::QueueArrayStream other(schema_in.get(), 1);
+  nanoarrow::UniqueArrayStream other_stream;
+  other.ToArrayStream(other_stream.get());
+  queue = std::move(other);
+
+  array.reset();
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(*nanoarrow::ViewArrayAs<int32_t>(array.get())[0], 0);
+  array.reset();
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(array->release, nullptr);
+
+  // The assigned-to queue now feeds the other stream
+  MakeInt32Array(array.get(), 2);
+  ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+  queue.close();
+  ASSERT_EQ(ArrowArrayStreamGetNext(other_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(*nanoarrow::ViewArrayAs<int32_t>(array.get())[0], 2);
+}
+
+// Doubles the values of an int32 array
+static ArrowErrorCode DoubleInt32Array(struct ArrowArray* in, struct ArrowArray* out,
+                                       struct ArrowError* error) {
+  int32_t value = *nanoarrow::ViewArrayAs<int32_t>(in)[0];
+  if (value == 13) {
+    ArrowErrorSet(error, "unlucky value %d", value);
+    return EINVAL;
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(out, NANOARROW_TYPE_INT32));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(out));
+  NANOARROW_RETURN_NOT_OK(ArrowArrayAppendInt(out, value * 2));
+  return ArrowArrayFinishBuildingDefault(out, error);
+}
+
+static void MakeInt32Stream(struct ArrowArrayStream* out, int32_t n) {
+  nanoarrow::UniqueSchema schema;
+  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_INT32));
+  std::vector<nanoarrow::UniqueArray> arrays(n);
+  for (int32_t i = 0; i < n; i++) {
+    MakeInt32Array(arrays[i].get(), i);
+  }
+
+  nanoarrow::VectorArrayStream(schema.get(), std::move(arrays)).ToArrayStream(out);
+}
+
+TEST(HppThreads, ParallelMapArrayStream) {
+  nanoarrow::UniqueArrayStream source;
+  MakeInt32Stream(source.get(), 13);
+
+  // The first array can't finish until the third one has, so results are always
+  // produced out of order (three arrays may be in flight at once)
+  Latch third_done(1);
+  std::mutex done_mutex;
+  std::vector<int32_t> done;
+  auto map = [&](ArrowArray* in, ArrowArray* out, ArrowError* error) {
+    int32_t value = *nanoarrow::ViewArrayAs<int32_t>(in)[0];
+    if (value == 0) {
+      third_done.Wait();
+    }
+
+    NANOARROW_RETURN_NOT_OK(DoubleInt32Array(in, out, error));
+    std::lock_guard<std::mutex> lock(done_mutex);
+    done.push_back(value);
+    if (value == 2) {
+      third_done.CountDown();
+    }
+
+    return NANOARROW_OK;
+  };
+
+  nanoarrow::UniqueArrayStream array_stream;
+  nanoarrow::ParallelMapArrayStream(source.get(), map, 4, 3)
+      .ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowArrayStreamGetSchema(array_stream.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema->format, "i");
+
+  std::vector<int32_t> values;
+  nanoarrow::ViewArrayStream array_stream_view(array_stream.get());
+  for (ArrowArray& array : array_stream_view) {
+    for (auto value : nanoarrow::ViewArrayAs<int32_t>(&array)) {
+      values.push_back(*value);
+    }
+  }
+
+  EXPECT_EQ(array_stream_view.code(), NANOARROW_OK);
+  ASSERT_EQ(values.size(), 13U);
+  for (int32_t i = 0; i < 13; i++) {
+    EXPECT_EQ(values[i], i * 2);
+  }
+
+  std::lock_guard<std::mutex> lock(done_mutex);
+  ASSERT_EQ(done.size(), 13U);
+  EXPECT_LT(std::find(done.begin(), done.end(), 2),
+            std::find(done.begin(), done.end(), 0));
+
+  // Calling get_next() after the end of the stream is still the end of the stream
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(array->release, nullptr);
+}
+
+TEST(HppThreads, ParallelMapArrayStreamSetSchema) {
+  nanoarrow::UniqueArrayStream source;
+  MakeInt32Stream(source.get(), 3);
+
+  nanoarrow::UniqueSchema schema_out;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_out.get(), NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArrayStream array_stream;
+  nanoarrow::ParallelMapArrayStream(
+      source.get(),
+      [](ArrowArray* in, ArrowArray* out, ArrowError* error) {
+        int32_t value = *nanoarrow::ViewArrayAs<int32_t>(in)[0];
+        std::string value_str = std::to_string(value);
+        NANOARROW_RETURN_NOT_OK(ArrowArrayInitFromType(out, NANOARROW_TYPE_STRING));
+        NANOARROW_RETURN_NOT_OK(ArrowArrayStartAppending(out));
+        NANOARROW_RETURN_NOT_OK(ArrowArrayAppendString(
+            out, {value_str.data(), static_cast<int64_t>(value_str.size())}));
+        return ArrowArrayFinishBuildingDefault(out, error);
+      },
+      2)
+      .SetSchema(schema_out.get())
+      .ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowArrayStreamGetSchema(array_stream.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_STREQ(schema->format, "u");
+
+  std::vector<std::string> values;
+  nanoarrow::ViewArrayStream array_stream_view(array_stream.get());
+  for (ArrowArray& array : array_stream_view) {
+    for (auto value : nanoarrow::ViewArrayAsBytes<32>(&array)) {
+      values.emplace_back((*value).data, (*value).size_bytes);
+    }
+  }
+
+  EXPECT_EQ(array_stream_view.code(), NANOARROW_OK);
+  EXPECT_THAT(values, ElementsAre("0", "1", "2"));
+}
+
+TEST(HppThreads, ParallelMapArrayStreamMapError) {
+  nanoarrow::UniqueArrayStream source;
+  MakeInt32Stream(source.get(), 100);
+
+  nanoarrow::UniqueArrayStream array_stream;
+  nanoarrow::ParallelMapArrayStream(source.get(), &DoubleInt32Array, 4)
+      .ToArrayStream(array_stream.get());
+
+  // All results preceding the failed one should be emitted first
+  nanoarrow::UniqueArray array;
+  for (int32_t i = 0; i < 13; i++) {
+    array.reset();
+    ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_NE(array->release, nullptr);
+    EXPECT_EQ(*nanoarrow::ViewArrayAs<int32_t>(array.get())[0], i * 2);
+  }
+
+  array.reset();
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr), EINVAL);
+  EXPECT_STREQ(ArrowArrayStreamGetLastError(array_stream.get()), "unlucky value 13");
+
+  // The error is sticky
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr), EINVAL);
+}
+
+TEST(HppThreads, ParallelMapArrayStreamSourceError) {
+  nanoarrow::UniqueSchema schema_in;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema_in.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayStream source;
+  {
+    nanoarrow::QueueArrayStream queue(schema_in.get());
+    queue.ToArrayStream(source.get());
+    nanoarrow::UniqueArray array;
+    MakeInt32Array(array.get(), 1);
+    ASSERT_EQ(queue.push(array.get()), NANOARROW_OK);
+    queue.close(EIO, "source failed");
+  }
+
+  nanoarrow::UniqueArrayStream array_stream;
+  nanoarrow::ParallelMapArrayStream(source.get(), &DoubleInt32Array, 2)
+      .ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  EXPECT_EQ(*nanoarrow::ViewArrayAs<int32_t>(array.get())[0], 2);
+
+  array.reset();
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr), EIO);
+  EXPECT_STREQ(ArrowArrayStreamGetLastError(array_stream.get()), "source failed");
+}
+
+TEST(HppThreads, ParallelMapArrayStreamEarlyRelease) {
+  nanoarrow::UniqueArrayStream source;
+  MakeInt32Stream(source.get(), 100);
+
+  // Releasing the stream before it is exhausted should stop and join the workers
+  nanoarrow::UniqueArrayStream array_stream;
+  nanoarrow::ParallelMapArrayStream(source.get(), &DoubleInt32Array, 4, 2)
+      .ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+            NANOARROW_OK);
+  array_stream.reset();
+}
+
+TEST(HppThreads, ParallelMapArrayStreamMapThrows) {
+  nanoarrow::UniqueArrayStream source;
+  MakeInt32Stream(source.get(), 100);
+
+  nanoarrow::UniqueArrayStream array_stream;
+  nanoarrow::ParallelMapArrayStream(
+      source.get(),
+      [](ArrowArray* in, ArrowArray* out, ArrowError* error) {
+        if (*nanoarrow::ViewArrayAs<int32_t>(in)[0] == 5) {
+          throw std::runtime_error("five is right out");
+        }
+
+        return DoubleInt32Array(in, out, error);
+      },
+      4)
+      .ToArrayStream(array_stream.get());
+
+  // The exception is reported as an error after the preceding results
+  nanoarrow::UniqueArray array;
+  for (int32_t i = 0; i < 5; i++) {
+    array.reset();
+    ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr),
+              NANOARROW_OK);
+    EXPECT_EQ(*nanoarrow::ViewArrayAs<int32_t>(array.get())[0], i * 2);
+    EXPECT_EQ(nanoarrow::ParallelMapArrayStream::GetException(array_stream.get()),
+              nullptr);
+  }
+
+  array.reset();
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr), EINVAL);
+  EXPECT_STREQ(ArrowArrayStreamGetLastError(array_stream.get()),
+               "ArrayMapFunction threw an exception: five is right out");
+
+  // ...and C++ callers can rethrow it
+  std::exception_ptr exception =
+      nanoarrow::ParallelMapArrayStream::GetException(array_stream.get());
+  ASSERT_NE(exception, nullptr);
+  try {
+    std::rethrow_exception(exception);
+  } catch (std::runtime_error& e) {
+    EXPECT_STREQ(e.what(), "five is right out");
+  }
+
+  // Later calls report the same error
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr), EINVAL);
+  EXPECT_STREQ(ArrowArrayStreamGetLastError(array_stream.get()),
+               "ArrayMapFunction threw an exception: five is right out");
+
+  // Streams that weren't exported by ParallelMapArrayStream have no exception
+  nanoarrow::UniqueArrayStream other;
+  MakeInt32Stream(other.get(), 1);
+  EXPECT_EQ(nanoarrow::ParallelMapArrayStream::GetException(other.get()), nullptr);
+}
+
+TEST(HppThreads, ParallelMapArrayStreamMapThrowsNonStdException) {
+  nanoarrow::UniqueArrayStream source;
+  MakeInt32Stream(source.get(), 1);
+
+  nanoarrow::UniqueArrayStream array_stream;
+  nanoarrow::ParallelMapArrayStream(
+      source.get(),
+      [](ArrowArray*, ArrowArray*, ArrowError*) -> ArrowErrorCode { throw 5; }, 1)
+      .ToArrayStream(array_stream.get());
+
+  nanoarrow::UniqueArray array;
+  EXPECT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), nullptr), EINVAL);
+  EXPECT_STREQ(ArrowArrayStreamGetLastError(array_stream.get()),
+               "ArrayMapFunction threw an exception");
+  EXPECT_NE(nanoarrow::ParallelMapArrayStream::GetException(array_stream.get()),
+            nullptr);
+}
@@ -113,6 +113,34 @@ struct InputRange {
   iterator begin() { return {this, next()}; }
   iterator end() { return {this, ValueOrFalsy()}; }
 };
+
+// A word with the lowest n_bits bits set (n_bits may be 0 to 64 inclusive)
+inline uint64_t LowBitsMask(int64_t n_bits) {
+  return n_bits >= 64 ? ~static_cast<uint64_t>(0)
+                      : (static_cast<uint64_t>(1) << n_bits) - 1;
+}
+
+// Load n_bits (at most 64) bits of bitmap starting at an arbitrary bit position
+// such that bit j of the result is bit start + j of bitmap. Never reads past the
+// byte containing the last requested bit.
+inline uint64_t LoadBitWord(const uint8_t* bitmap, int64_t start, int64_t n_bits) {
+  const uint8_t* bytes = bitmap + (start >> 3);
+  const int shift = static_cast<int>(start & 7);
+  const int64_t n_bytes = (shift + n_bits + 7) >> 3;
+
+  uint64_t word = 0;
+  const int64_t n_low_bytes = n_bytes < 8 ? n_bytes : 8;
+  for (int64_t j = 0; j < n_low_bytes; j++) {
+    word |= static_cast<uint64_t>(bytes[j]) << (8 * j);
+  }
+
+  word >>= shift;
+  if (n_bytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+
+  return word & LowBitsMask(n_bits);
+}
 }  // namespace internal
 
 /// \defgroup nanoarrow_hpp-range_for Range-for helpers
@@ -341,6 +369,121 @@ class ViewArrayAsFixedSizeBytes {
   value_type operator[](int64_t i) const { return range_.get(i); }
 };
 
+/// \brief A block of up to 64 consecutive slots of a fixed size array
+///
+/// Bit i of validity is set if values[i] is valid. Bits at or beyond size
+/// are always zero. Blocks drawn from arrays without a validity buffer
+/// have all of their validity bits set.
+template <typename T>
+struct ArrayBlock {
+  const T* values;
+  int64_t size;
+  uint64_t validity;
+
+  /// \brief True if every slot in this block is valid
+  bool all_valid() const { return validity == internal::LowBitsMask(size); }
+
+  /// \brief True if every slot in this block is null
+  bool all_null() const { return validity == 0; }
+
+  /// \brief True if slot i of this block is valid
+  bool is_valid(int64_t i) const { return ((validity >> i) & 1) != 0; }
+
+  const T* begin() const { return values; }
+  const T* end() const { return values + size; }
+};
+
+/// \brief A range-for compatible wrapper for ArrowArray of fixed size type
+///        yielding blocks of slots
+///
+/// Provides a sequence of ArrayBlock<T> that each reference up to 64
+/// consecutive values of the wrapped array alongside a word of their validity
+/// bits. Unlike ViewArrayAs<T>, the per-element validity check is left to the
+/// caller such that inner loops over a block can be written in a form that is
+/// amenable to auto-vectorization, e.g.:
+///
+/// \code
+/// for (const auto& block : nanoarrow::ViewArrayAsBlocks<int64_t>(array)) {
+///   if (block.all_valid()) {
+///     for (int64_t i = 0; i < block.size; i++) sum += block.values[i];
+///   } else if (!block.all_null()) {
+///     for (int64_t i = 0; i < block.size; i++) {
+///       sum += block.is_valid(i) ? block.values[i] : 0;
+///     }
+///   }
+/// }
+/// \endcode
+///
+/// Boolean arrays are not supported because their values are bit-packed.
+template <typename T>
+class ViewArrayAsBlocks {
+ private:
+  static_assert(!std::is_same<T, bool>::value,
+                "ViewArrayAsBlocks does not support bit-packed values");
+
+  struct Get {
+    const uint8_t* validity;
+    const T* values;
+    int64_t offset;
+    int64_t length;
+
+    ArrayBlock<T> operator()(int64_t block_i) const {
+      int64_t start = block_i * 64;
+      int64_t size = length - start;
+      if (size > 64) {
+        size = 64;
+      }
+
+      ArrayBlock<T> block;
+      block.values = values + offset + start;
+      block.size = size;
+      if (validity == nullptr) {
+        block.validity = internal::LowBitsMask(size);
+      } else {
+        block.validity = internal::LoadBitWord(validity, offset + start, size);
+      }
+
+      return block;
+    }
+  };
+
+  internal::RandomAccessRange<Get> range_;
+
+ public:
+  ViewArrayAsBlocks(const ArrowArrayView* array_view)
+      : range_{
+            Get{
+                array_view->buffer_views[0].data.as_uint8,
+                static_cast<const T*>(array_view->buffer_views[1].data.data),
+                array_view->offset,
+                array_view->length,
+            },
+            0,
+            (array_view->length + 63) / 64,
+        } {}
+
+  ViewArrayAsBlocks(const ArrowArray* array)
+      : range_{
+            Get{
+                static_cast<const uint8_t*>(array->buffers[0]),
+                static_cast<const T*>(array->buffers[1]),
+                array->offset,
+                array->length,
+            },
+            0,
+            (array->length + 63) / 64,
+        } {}
+
+  using value_type = typename internal::RandomAccessRange<Get>::value_type;
+  using const_iterator = typename internal::RandomAccessRange<Get>::const_iterator;
+  const_iterator begin() const { return range_.begin(); }
+  const_iterator end() const { return range_.end(); }
+  value_type operator[](int64_t i) const { return range_.get(i); }
+
+  /// The number of blocks in this view
+  int64_t size() const { return range_.size; }
+};
+
 /// \brief A range-for compatible wrapper for ArrowArrayStream
 ///
 /// Provides a sequence of ArrowArray& referencing the most recent array drawn
@@ -283,3 +283,105 @@ TEST(NanoarrowHppTest, NanoarrowHppViewArrayAsFixedSizeBytesOffsetTest) {
   EXPECT_THAT(nanoarrow::ViewArrayAsFixedSizeBytes(array_view.get(), FixedSize),
               testing::ElementsAre("baz"_asv, "qux"_asv));
 }
+
+TEST(NanoarrowHppTest, NanoarrowHppViewArrayAsBlocksTest) {
+  nanoarrow::UniqueSchema schema{};
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetType(schema.get(), NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  nanoarrow::UniqueArray array{};
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  for (int32_t i = 0; i < 200; i++) {
+    if (i % 7 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(array.get(), 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array.get(), i), NANOARROW_OK);
+    }
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayView array_view{};
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+
+  // Check a few offsets so that blocks are both byte-aligned and not
+  for (int64_t offset : {0, 3, 8, 61}) {
+    array->offset = offset;
+    array->length = 200 - offset;
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+              NANOARROW_OK);
+
+    std::vector<nanoarrow::internal::Maybe<int32_t>> expected;
+    for (auto slot : nanoarrow::ViewArrayAs<int32_t>(array.get())) {
+      expected.push_back(slot);
+    }
+
+    std::vector<nanoarrow::internal::Maybe<int32_t>> actual;
+    nanoarrow::ViewArrayAsBlocks<int32_t> blocks(array_view.get());
+    EXPECT_EQ(blocks.size(), (array->length + 63) / 64);
+    for (const auto& block : blocks) {
+      EXPECT_FALSE(block.all_valid());
+      EXPECT_EQ(block.validity & ~nanoarrow::internal::LowBitsMask(block.size), 0U);
+      for (int64_t i = 0; i < block.size; i++) {
+        if (block.is_valid(i)) {
+          actual.push_back(block.values[i]);
+        } else {
+          actual.push_back(nanoarrow::NA);
+        }
+      }
+    }
+
+    EXPECT_EQ(actual, expected) << "offset " << offset;
+  }
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppViewArrayAsBlocksNoValidityTest) {
+  std::vector<double> values(130);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = static_cast<double>(i);
+  }
+
+  const void* buffers[] = {nullptr, values.data()};
+  struct ArrowArray array {};
+  array.length = 129;
+  array.offset = 1;
+  array.n_buffers = 2;
+  array.buffers = buffers;
+
+  nanoarrow::ViewArrayAsBlocks<double> blocks(&array);
+  ASSERT_EQ(blocks.size(), 3);
+  EXPECT_EQ(blocks[0].size, 64);
+  EXPECT_EQ(blocks[2].size, 1);
+  EXPECT_EQ(blocks[2].validity, 1U);
+
+  double sum = 0;
+  for (const auto& block : blocks) {
+    EXPECT_TRUE(block.all_valid());
+    for (double value : block) {
+      sum += value;
+    }
+  }
+  EXPECT_EQ(sum, 129 * 130 / 2);
+
+  array.length = 0;
+  EXPECT_EQ(nanoarrow::ViewArrayAsBlocks<double>(&array).size(), 0);
+}
+
+TEST(NanoarrowHppTest, NanoarrowHppViewArrayAsBlocksAllNullTest) {
+  nanoarrow::UniqueBuffer is_valid, ints;
+  nanoarrow::BufferInitSequence(is_valid.get(), std::vector<uint8_t>(9, 0x00));
+  nanoarrow::BufferInitSequence(ints.get(), std::vector<int64_t>(72, 0));
+
+  const void* buffers[] = {is_valid->data, ints->data};
+  struct ArrowArray array {};
+  array.length = 72;
+  array.null_count = 72;
+  array.n_buffers = 2;
+  array.buffers = buffers;
+
+  for (const auto& block : nanoarrow::ViewArrayAsBlocks<int64_t>(&array)) {
+    EXPECT_TRUE(block.all_null());
+    EXPECT_FALSE(block.all_valid());
+  }
+}
@@ -20,29 +20,16 @@
 #include <stdio.h>
 #include <string.h>
 
-// For thread safe shared buffers we need C11 + stdatomic.h
-// Can compile with -DNANOARROW_IPC_USE_STDATOMIC=0 or 1 to override
-// automatic detection
-#if !defined(NANOARROW_IPC_USE_STDATOMIC)
-#define NANOARROW_IPC_USE_STDATOMIC 0
-
-// Check for C11
-#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
-
-// Check for GCC 4.8, which doesn't include stdatomic.h but does
-// not define __STDC_NO_ATOMICS__
-#if defined(__clang__) || !defined(__GNUC__) || __GNUC__ >= 5
-
-#if !defined(__STDC_NO_ATOMICS__)
-#include <stdatomic.h>
-#undef NANOARROW_IPC_USE_STDATOMIC
-#define NANOARROW_IPC_USE_STDATOMIC 1
-#endif
-#endif
-#endif
-
+// Byte shuffles are used to swap endianness if the target instruction set provides them
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
+#include "nanoarrow/common/atomic_internal.h"
 #include "nanoarrow/ipc/flatcc_generated.h"
 #include "nanoarrow/nanoarrow.h"
 #include "nanoarrow/nanoarrow_ipc.h"
@@ -64,8 +51,11 @@ struct ArrowIpcField {
   // array is scratch space for any intermediary allocations (i.e., it is never moved
   // to the user).
   struct ArrowArray* array;
-  // The cumulative number of buffers preceding this node.
+  // The cumulative number of buffers preceding this node, not counting variadic buffers.
   int64_t buffer_offset;
+  // The number of binary view fields preceding this node (i.e., the index of this
+  // node's entry in RecordBatch.variadicBufferCounts if it is a binary view).
+  int64_t variadic_offset;
 };
 
 // Internal data specific to the read/decode process
@@ -93,6 +83,17 @@ struct ArrowIpcDecoderPrivate {
   int64_t n_buffers;
   // The number of union fields in the Schema.
   int64_t n_union_fields;
+  // The number of binary view fields in the Schema (i.e., the number of entries
+  // future RecordBatch messages must have in variadicBufferCounts)
+  int64_t n_variadic_fields;
+  // Storage for the variadic buffer pointers and sizes of the binary view fields
+  // in the last decoded ArrowArrayView
+  struct ArrowBuffer variadic_buffers;
+  struct ArrowBuffer variadic_buffer_sizes;
+  // A compact copy of the schema that was last set and its type-only ArrowSchemaHash()
+  // such that setting an equal schema again can reuse the state derived from it
+  struct ArrowSchema schema;
+  uint64_t schema_hash;
   // A pointer to the last flatbuffers message.
   const void* last_message;
   // Storage for a Footer
@@ -117,7 +118,7 @@ ArrowErrorCode ArrowIpcCheckRuntime(struct ArrowError* error) {
   return NANOARROW_OK;
 }
 
-#if NANOARROW_IPC_USE_STDATOMIC
+#if NANOARROW_USE_STDATOMIC
 struct ArrowIpcSharedBufferPrivate {
   struct ArrowBuffer src;
   atomic_long reference_count;
@@ -238,6 +239,8 @@ ArrowErrorCode ArrowIpcDecoderInit(struct ArrowIpcDecoder* decoder) {
 
   memset(private_data, 0, sizeof(struct ArrowIpcDecoderPrivate));
   private_data->system_endianness = ArrowIpcSystemEndianness();
+  ArrowBufferInit(&private_data->variadic_buffers);
+  ArrowBufferInit(&private_data->variadic_buffer_sizes);
   ArrowIpcFooterInit(&private_data->footer);
   decoder->private_data = private_data;
   return NANOARROW_OK;
@@ -283,6 +286,13 @@ void ArrowIpcDecoderReset(struct ArrowIpcDecoder* decoder) {
     }
 
     private_data->n_union_fields = 0;
+    private_data->n_variadic_fields = 0;
+    ArrowBufferReset(&private_data->variadic_buffers);
+
+    if (private_data->schema.release != NULL) {
+      ArrowSchemaRelease(&private_data->schema);
+    }
+    ArrowBufferReset(&private_data->variadic_buffer_sizes);
 
     ArrowIpcFooterReset(&private_data->footer);
 
@@ -663,6 +673,19 @@ static int ArrowIpcDecoderSetTypeMap(struct ArrowSchema* schema,
   return NANOARROW_OK;
 }
 
+static int ArrowIpcDecoderSetTypeRunEndEncoded(struct ArrowSchema* schema,
+                                               int64_t n_children,
+                                               struct ArrowError* error) {
+  if (n_children != 2) {
+    ArrowErrorSet(error,
+                  "Expected 2 children for RunEndEncoded type but found %" PRId64,
+                  n_children);
+    return EINVAL;
+  }
+
+  return ArrowIpcDecoderSetTypeSimpleNested(schema, "+r", error);
+}
+
 static int ArrowIpcDecoderSetTypeUnion(struct ArrowSchema* schema,
                                        flatbuffers_generic_t type_generic,
                                        int64_t n_children, struct ArrowError* error) {
@@ -793,6 +816,10 @@ static int ArrowIpcDecoderSetType(struct ArrowSchema* schema, ns(Field_table_t)
       return ArrowIpcDecoderSetTypeSimple(schema, NANOARROW_TYPE_STRING, error);
     case ns(Type_LargeUtf8):
       return ArrowIpcDecoderSetTypeSimple(schema, NANOARROW_TYPE_LARGE_STRING, error);
+    case ns(Type_BinaryView):
+      return ArrowIpcDecoderSetTypeSimple(schema, NANOARROW_TYPE_BINARY_VIEW, error);
+    case ns(Type_Utf8View):
+      return ArrowIpcDecoderSetTypeSimple(schema, NANOARROW_TYPE_STRING_VIEW, error);
     case ns(Type_Date):
       return ArrowIpcDecoderSetTypeDate(schema, ns(Field_type_get(field)), error);
     case ns(Type_Time):
@@ -809,6 +836,10 @@ static int ArrowIpcDecoderSetType(struct ArrowSchema* schema, ns(Field_table_t)
       return ArrowIpcDecoderSetTypeSimpleNested(schema, "+l", error);
     case ns(Type_LargeList):
       return ArrowIpcDecoderSetTypeSimpleNested(schema, "+L", error);
+    case ns(Type_ListView):
+      return ArrowIpcDecoderSetTypeSimpleNested(schema, "+vl", error);
+    case ns(Type_LargeListView):
+      return ArrowIpcDecoderSetTypeSimpleNested(schema, "+vL", error);
     case ns(Type_FixedSizeList):
       return ArrowIpcDecoderSetTypeFixedSizeList(schema, ns(Field_type_get(field)),
                                                  error);
@@ -817,6 +848,8 @@ static int ArrowIpcDecoderSetType(struct ArrowSchema* schema, ns(Field_table_t)
     case ns(Type_Union):
       return ArrowIpcDecoderSetTypeUnion(schema, ns(Field_type_get(field)), n_children,
                                          error);
+    case ns(Type_RunEndEncoded):
+      return ArrowIpcDecoderSetTypeRunEndEncoded(schema, n_children, error);
     default:
       ArrowErrorSet(error, "Unrecognized Field type with value %d", type_type);
       return EINVAL;
@@ -958,6 +991,29 @@ static int ArrowIpcDecoderDecodeRecordBatchHeader(struct ArrowIpcDecoder* decode
     n_expected_buffers += private_data->n_union_fields;
   }
 
+  // Binary view fields have a variable number of buffers that is declared separately
+  flatbuffers_int64_vec_t variadic_buffer_counts =
+      ns(RecordBatch_variadicBufferCounts(batch));
+  int64_t n_variadic_buffer_counts = flatbuffers_int64_vec_len(variadic_buffer_counts);
+  if (n_variadic_buffer_counts != private_data->n_variadic_fields) {
+    ArrowErrorSet(
+        error, "Expected %" PRId64 " variadicBufferCounts in message but found %" PRId64,
+        private_data->n_variadic_fields, n_variadic_buffer_counts);
+    return EINVAL;
+  }
+
+  for (int64_t i = 0; i < n_variadic_buffer_counts; i++) {
+    int64_t count = flatbuffers_int64_vec_at(variadic_buffer_counts, i);
+    if (count < 0 || count > INT32_MAX) {
+      ArrowErrorSet(error, "Expected variadicBufferCounts[%" PRId64
+                           "] between 0 and INT32_MAX but found %" PRId64,
+                    i, count);
+      return EINVAL;
+    }
+
+    n_expected_buffers += count;
+  }
+
   if ((n_buffers + 1) != n_expected_buffers) {
     ArrowErrorSet(error, "Expected %" PRId64 " buffers in message but found %" PRId64,
                   n_expected_buffers - 1, n_buffers);
@@ -1089,10 +1145,12 @@ ArrowErrorCode ArrowIpcDecoderVerifyHeader(struct ArrowIpcDecoder* decoder,
   }
 
   // Run flatbuffers verification
-  enum flatcc_verify_error_no verify_error =
-      ns(Message_verify_as_root(data.data.as_uint8,
-                                decoder->header_size_bytes - prefix_size_bytes);
-         if (verify_error != flatcc_verify_ok)) {
+  NANOARROW_TRACE_BEGIN(trace_start);
+  enum flatcc_verify_error_no verify_error = ns(Message_verify_as_root(
+      data.data.as_uint8, decoder->header_size_bytes - prefix_size_bytes));
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_VERIFY_HEADER, trace_start,
+                      decoder->header_size_bytes);
+  if (verify_error != flatcc_verify_ok) {
     ArrowErrorSet(error, "Message flatbuffer verification failed (%d) %s",
                   (int)verify_error, flatcc_verify_error_string(verify_error));
     return EINVAL;
@@ -1189,9 +1247,9 @@ ArrowErrorCode ArrowIpcDecoderVerifyFooter(struct ArrowIpcDecoder* decoder,
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
-                                           struct ArrowBufferView data,
-                                           struct ArrowError* error) {
+static ArrowErrorCode ArrowIpcDecoderDecodeHeaderInternal(
+    struct ArrowIpcDecoder* decoder, struct ArrowBufferView data,
+    struct ArrowError* error) {
   struct ArrowIpcDecoderPrivate* private_data =
       (struct ArrowIpcDecoderPrivate*)decoder->private_data;
 
@@ -1261,6 +1319,16 @@ ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
   return NANOARROW_OK;
 }
 
+ArrowErrorCode ArrowIpcDecoderDecodeHeader(struct ArrowIpcDecoder* decoder,
+                                           struct ArrowBufferView data,
+                                           struct ArrowError* error) {
+  NANOARROW_TRACE_BEGIN(trace_start);
+  int result = ArrowIpcDecoderDecodeHeaderInternal(decoder, data, error);
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_DECODE_HEADER, trace_start,
+                      decoder->header_size_bytes);
+  return result;
+}
+
 static ArrowErrorCode ArrowIpcDecoderDecodeSchemaImpl(ns(Schema_table_t) schema,
                                                       struct ArrowSchema* out,
                                                       struct ArrowError* error) {
@@ -1350,26 +1418,34 @@ static void ArrowIpcDecoderCountFields(struct ArrowSchema* schema, int64_t* n_fi
   }
 }
 
+static int ArrowIpcDecoderIsBinaryView(enum ArrowType storage_type) {
+  return storage_type == NANOARROW_TYPE_BINARY_VIEW ||
+         storage_type == NANOARROW_TYPE_STRING_VIEW;
+}
+
 static void ArrowIpcDecoderInitFields(struct ArrowIpcField* fields,
                                       struct ArrowArrayView* array_view,
                                       struct ArrowArray* array, int64_t* n_fields,
-                                      int64_t* n_buffers, int64_t* n_union_fields) {
+                                      int64_t* n_buffers, int64_t* n_union_fields,
+                                      int64_t* n_variadic_fields) {
   struct ArrowIpcField* field = fields + (*n_fields);
   field->array_view = array_view;
   field->array = array;
   field->buffer_offset = *n_buffers;
+  field->variadic_offset = *n_variadic_fields;
 
   for (int i = 0; i < NANOARROW_MAX_FIXED_BUFFERS; i++) {
     *n_buffers += array_view->layout.buffer_type[i] != NANOARROW_BUFFER_TYPE_NONE;
   }
   *n_union_fields += array_view->storage_type == NANOARROW_TYPE_SPARSE_UNION ||
                      array_view->storage_type == NANOARROW_TYPE_DENSE_UNION;
+  *n_variadic_fields += ArrowIpcDecoderIsBinaryView(array_view->storage_type);
 
   *n_fields += 1;
 
   for (int64_t i = 0; i < array_view->n_children; i++) {
     ArrowIpcDecoderInitFields(fields, array_view->children[i], array->children[i],
-                              n_fields, n_buffers, n_union_fields);
+                              n_fields, n_buffers, n_union_fields, n_variadic_fields);
   }
 }
 
@@ -1379,10 +1455,23 @@ ArrowErrorCode ArrowIpcDecoderSetSchema(struct ArrowIpcDecoder* decoder,
   struct ArrowIpcDecoderPrivate* private_data =
       (struct ArrowIpcDecoderPrivate*)decoder->private_data;
 
+  // Everything derived from the schema depends only on its type information,
+  // so nothing needs to be rebuilt if the same schema is set again (e.g., when
+  // one decoder is used for many streams or files that share a schema)
+  uint64_t schema_hash = ArrowSchemaHash(schema, 0);
+  if (private_data->schema.release != NULL && private_data->schema_hash == schema_hash &&
+      ArrowSchemaEquals(schema, &private_data->schema, 0)) {
+    return NANOARROW_OK;
+  }
+
   // Reset previously allocated schema-specific resources
+  if (private_data->schema.release != NULL) {
+    ArrowSchemaRelease(&private_data->schema);
+  }
   private_data->n_buffers = 0;
   private_data->n_fields = 0;
   private_data->n_union_fields = 0;
+  private_data->n_variadic_fields = 0;
   ArrowArrayViewReset(&private_data->array_view);
   if (private_data->array.release != NULL) {
     ArrowArrayRelease(&private_data->array);
@@ -1418,8 +1507,15 @@ ArrowErrorCode ArrowIpcDecoderSetSchema(struct ArrowIpcDecoder* decoder,
   int64_t field_i = 0;
   ArrowIpcDecoderInitFields(private_data->fields, &private_data->array_view,
                             &private_data->array, &field_i, &private_data->n_buffers,
-                            &private_data->n_union_fields);
+                            &private_data->n_union_fields,
+                            &private_data->n_variadic_fields);
 
+  if (ArrowSchemaCompact(schema, &private_data->schema) != NANOARROW_OK) {
+    ArrowErrorSet(error, "ArrowSchemaCompact() failed");
+    return ENOMEM;
+  }
+
+  private_data->schema_hash = schema_hash;
   return NANOARROW_OK;
 }
 
@@ -1452,6 +1548,8 @@ struct ArrowIpcBufferSource {
   enum ArrowType data_type;
   int64_t element_size_bits;
   int swap_endian;
+  // Nonzero if the memory backing the body may be modified when swapping endianness
+  int swap_endian_in_place;
 };
 
 /// \brief Materializing ArrowBuffer objects
@@ -1486,6 +1584,10 @@ struct ArrowIpcBufferFactory {
   /// Usually this would be a description of where the body has been read into memory or
   /// information required to do so.
   void* private_data;
+
+  /// \brief Nonzero if the body is exclusively owned by the decoder such that buffers
+  /// may be modified in place (e.g., to swap endianness) instead of copied.
+  int mutable_body;
 };
 
 static ArrowErrorCode ArrowIpcDecompressBufferFromView(
@@ -1523,12 +1625,18 @@ static ArrowErrorCode ArrowIpcDecompressBufferFromView(
   // Prepare the source and destination
   src.data.as_uint8 += sizeof(int64_t);
   src.size_bytes -= sizeof(int64_t);
+  NANOARROW_TRACE_BEGIN(allocate_start);
   NANOARROW_RETURN_NOT_OK(ArrowBufferResize(dst, uncompressed_size, 0));
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_ALLOCATE_BUFFER, allocate_start,
+                      uncompressed_size);
 
   // Add the task to the decompressor (this may execute synchronously for some
   // decompressors)
+  NANOARROW_TRACE_BEGIN(decompress_start);
   NANOARROW_RETURN_NOT_OK(decompressor->decompress_add(
       decompressor, compression_type, src, dst->data, uncompressed_size, error));
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_DECOMPRESS, decompress_start,
+                      uncompressed_size);
 
   // Pass on that we handled the decompression
   *needs_decompression = 1;
@@ -1572,6 +1680,7 @@ static struct ArrowIpcBufferFactory ArrowIpcBufferFactoryFromView(
   out.make_buffer = &ArrowIpcMakeBufferFromView;
   out.decompressor = NULL;
   out.private_data = buffer_view;
+  out.mutable_body = 0;
   return out;
 }
 
@@ -1612,6 +1721,7 @@ static struct ArrowIpcBufferFactory ArrowIpcBufferFactoryFromShared(
   out.make_buffer = &ArrowIpcMakeBufferFromShared;
   out.decompressor = NULL;
   out.private_data = shared;
+  out.mutable_body = 0;
   return out;
 }
 
@@ -1622,6 +1732,108 @@ struct ArrowIpcIntervalMonthDayNano {
   uint64_t ns;
 };
 
+// Reverse the bytes of each width-byte element of src into dst for elements that
+// can't be handled using byte shuffles. src and dst may point to the same memory.
+static void ArrowIpcByteSwapScalar(const uint8_t* src, uint8_t* dst, int64_t n_elements,
+                                   int width) {
+  switch (width) {
+    case 2:
+      for (int64_t i = 0; i < n_elements; i++) {
+        uint16_t value;
+        memcpy(&value, src + i * 2, sizeof(value));
+        value = (uint16_t)bswap16(value);
+        memcpy(dst + i * 2, &value, sizeof(value));
+      }
+      break;
+    case 4:
+      for (int64_t i = 0; i < n_elements; i++) {
+        uint32_t value;
+        memcpy(&value, src + i * 4, sizeof(value));
+        value = bswap32(value);
+        memcpy(dst + i * 4, &value, sizeof(value));
+      }
+      break;
+    default: {
+      // Swap each 64-bit word and reverse the order of the words
+      uint64_t words[4];
+      int n_words = width / 8;
+      NANOARROW_DCHECK(n_words == 1 || n_words == 2 || n_words == 4);
+
+      for (int64_t i = 0; i < n_elements; i++) {
+        memcpy(words, src + i * width, width);
+        for (int j = 0; j < n_words; j++) {
+          uint64_t word = bswap64(words[n_words - j - 1]);
+          memcpy(dst + i * width + j * 8, &word, sizeof(word));
+        }
+      }
+      break;
+    }
+  }
+}
+
+#if defined(__SSSE3__) || defined(__AVX2__) || \
+    (defined(__ARM_NEON) && defined(__aarch64__))
+// The byte shuffle that reverses each width-byte element of a 16 byte block
+static void ArrowIpcByteSwapShuffle(int width, uint8_t* shuffle) {
+  int block_width = width > 16 ? 16 : width;
+  for (int i = 0; i < 16; i++) {
+    shuffle[i] = (uint8_t)((i / block_width) * block_width +
+                           (block_width - 1 - (i % block_width)));
+  }
+}
+#endif
+
+// Reverse the bytes of each width-byte element (where width is 2, 4, 8, 16, or 32)
+// of src into dst. src and dst may point to the same memory.
+static void ArrowIpcByteSwap(const uint8_t* src, uint8_t* dst, int64_t n_elements,
+                             int width) {
+  int64_t i = 0;
+  int64_t n_bytes = n_elements * width;
+
+#if defined(__SSSE3__) || defined(__AVX2__) || \
+    (defined(__ARM_NEON) && defined(__aarch64__))
+  uint8_t shuffle_bytes[16];
+  ArrowIpcByteSwapShuffle(width, shuffle_bytes);
+
+  // A 32 byte element is reversed by reversing each 16 byte half and swapping
+  // the two halves
+  int swap_halves = width == 32;
+
+#if defined(__AVX2__)
+  __m128i shuffle_half = _mm_loadu_si128((const __m128i*)shuffle_bytes);
+  __m256i shuffle = _mm256_broadcastsi128_si256(shuffle_half);
+  for (; (i + 32) <= n_bytes; i += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(src + i));
+    block = _mm256_shuffle_epi8(block, shuffle);
+    if (swap_halves) {
+      block = _mm256_permute2x128_si256(block, block, 0x01);
+    }
+    _mm256_storeu_si256((__m256i*)(dst + i), block);
+  }
+#elif defined(__SSSE3__)
+  __m128i shuffle = _mm_loadu_si128((const __m128i*)shuffle_bytes);
+  for (; (i + 32) <= n_bytes; i += 32) {
+    __m128i lo = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i)), shuffle);
+    __m128i hi =
+        _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i + 16)), shuffle);
+    _mm_storeu_si128((__m128i*)(dst + i), swap_halves ? hi : lo);
+    _mm_storeu_si128((__m128i*)(dst + i + 16), swap_halves ? lo : hi);
+  }
+#else
+  uint8x16_t shuffle = vld1q_u8(shuffle_bytes);
+  for (; (i + 32) <= n_bytes; i += 32) {
+    uint8x16_t lo = vqtbl1q_u8(vld1q_u8(src + i), shuffle);
+    uint8x16_t hi = vqtbl1q_u8(vld1q_u8(src + i + 16), shuffle);
+    vst1q_u8(dst + i, swap_halves ? hi : lo);
+    vst1q_u8(dst + i + 16, swap_halves ? lo : hi);
+  }
+#endif
+#endif
+
+  // Any remaining elements (or all of them if no byte shuffle is available)
+  ArrowIpcByteSwapScalar(src + i, dst + i, (n_bytes - i) / width, width);
+}
+
 static int ArrowIpcDecoderSwapEndian(struct ArrowIpcBufferSource* src,
                                      struct ArrowBufferView* out_view,
                                      struct ArrowBuffer* dst, struct ArrowError* error) {
@@ -1640,61 +1852,69 @@ static int ArrowIpcDecoderSwapEndian(struct ArrowIpcBufferSource* src,
       break;
   }
 
-  // Make sure dst is not a shared buffer that we can't modify
   struct ArrowBuffer tmp;
   ArrowBufferInit(&tmp);
 
-  if (dst->allocator.private_data != NULL) {
-    ArrowBufferMove(dst, &tmp);
-    ArrowBufferInit(dst);
-  }
+  uint8_t* ptr_dst;
+  if (src->swap_endian_in_place && dst->allocator.private_data != NULL) {
+    // dst is a slice of a body that nothing else references, so we can modify it
+    NANOARROW_DCHECK(dst->data == out_view->data.as_uint8);
+    ptr_dst = dst->data;
+  } else {
+    // Make sure dst is not a shared buffer that we can't modify
+    if (dst->allocator.private_data != NULL) {
+      ArrowBufferMove(dst, &tmp);
+      ArrowBufferInit(dst);
+    }
+
+    if (dst->size_bytes == 0) {
+      NANOARROW_TRACE_BEGIN(allocate_start);
+      NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(dst, out_view->size_bytes));
+      dst->size_bytes = out_view->size_bytes;
+      NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_ALLOCATE_BUFFER, allocate_start,
+                          out_view->size_bytes);
+    }
 
-  if (dst->size_bytes == 0) {
-    NANOARROW_RETURN_NOT_OK(ArrowBufferReserve(dst, out_view->size_bytes));
-    dst->size_bytes = out_view->size_bytes;
+    ptr_dst = dst->data;
   }
 
+  const uint8_t* ptr_src = out_view->data.as_uint8;
+  int64_t size_bytes = out_view->size_bytes;
+
+  NANOARROW_TRACE_BEGIN(swap_start);
   switch (src->data_type) {
-    case NANOARROW_TYPE_DECIMAL32: {
-      uint32_t* ptr = (uint32_t*)dst->data;
-      for (int64_t i = 0; i < (dst->size_bytes / 4); i++) {
-        ptr[i] = bswap32(out_view->data.as_uint32[i]);
-      }
+    case NANOARROW_TYPE_DECIMAL32:
+    case NANOARROW_TYPE_INTERVAL_DAY_TIME:
+      ArrowIpcByteSwap(ptr_src, ptr_dst, size_bytes / 4, 4);
       break;
-    }
     case NANOARROW_TYPE_DECIMAL64:
     case NANOARROW_TYPE_DECIMAL128:
     case NANOARROW_TYPE_DECIMAL256: {
-      const uint64_t* ptr_src = out_view->data.as_uint64;
-      uint64_t* ptr_dst = (uint64_t*)dst->data;
-      uint64_t words[4];
-      int n_words = (int)(src->element_size_bits / 64);
-      NANOARROW_DCHECK(n_words == 1 || n_words == 2 || n_words == 4);
-
-      for (int64_t i = 0; i < (dst->size_bytes / n_words / 8); i++) {
-        for (int j = 0; j < n_words; j++) {
-          words[j] = bswap64(ptr_src[i * n_words + j]);
-        }
-
-        for (int j = 0; j < n_words; j++) {
-          ptr_dst[i * n_words + j] = words[n_words - j - 1];
-        }
-      }
+      int width = (int)(src->element_size_bits / 8);
+      NANOARROW_DCHECK(width == 8 || width == 16 || width == 32);
+      ArrowIpcByteSwap(ptr_src, ptr_dst, size_bytes / width, width);
       break;
     }
-    case NANOARROW_TYPE_INTERVAL_DAY_TIME: {
-      uint32_t* ptr = (uint32_t*)dst->data;
-      for (int64_t i = 0; i < (dst->size_bytes / 4); i++) {
-        ptr[i] = bswap32(out_view->data.as_uint32[i]);
+    case NANOARROW_TYPE_BINARY_VIEW:
+    case NANOARROW_TYPE_STRING_VIEW: {
+      // Only the integer fields of a view are swapped: the size, and for
+      // non-inlined values, the buffer index and offset (not the prefix)
+      union ArrowBinaryView item;
+      for (int64_t i = 0; i < (size_bytes / (int64_t)sizeof(item)); i++) {
+        memcpy(&item, ptr_src + i * sizeof(item), sizeof(item));
+        item.inlined.size = (int32_t)bswap32((uint32_t)item.inlined.size);
+        if (item.inlined.size > NANOARROW_BINARY_VIEW_INLINE_SIZE) {
+          item.ref.buffer_index = (int32_t)bswap32((uint32_t)item.ref.buffer_index);
+          item.ref.offset = (int32_t)bswap32((uint32_t)item.ref.offset);
+        }
+        memcpy(ptr_dst + i * sizeof(item), &item, sizeof(item));
       }
       break;
     }
     case NANOARROW_TYPE_INTERVAL_MONTH_DAY_NANO: {
-      const uint8_t* ptr_src = out_view->data.as_uint8;
-      uint8_t* ptr_dst = dst->data;
       int item_size_bytes = 16;
       struct ArrowIpcIntervalMonthDayNano item;
-      for (int64_t i = 0; i < (dst->size_bytes / item_size_bytes); i++) {
+      for (int64_t i = 0; i < (size_bytes / item_size_bytes); i++) {
         memcpy(&item, ptr_src + i * item_size_bytes, item_size_bytes);
         item.months = bswap32(item.months);
         item.days = bswap32(item.days);
@@ -1705,28 +1925,15 @@ static int ArrowIpcDecoderSwapEndian(struct ArrowIpcBufferSource* src,
     }
     default:
       switch (src->element_size_bits) {
-        case 16: {
-          uint16_t* ptr = (uint16_t*)dst->data;
-          for (int64_t i = 0; i < (dst->size_bytes / 2); i++) {
-            ptr[i] = bswap16(out_view->data.as_uint16[i]);
-          }
-          break;
-        }
-        case 32: {
-          uint32_t* ptr = (uint32_t*)dst->data;
-          for (int64_t i = 0; i < (dst->size_bytes / 4); i++) {
-            ptr[i] = bswap32(out_view->data.as_uint32[i]);
-          }
-          break;
-        }
+        case 16:
+        case 32:
         case 64: {
-          uint64_t* ptr = (uint64_t*)dst->data;
-          for (int64_t i = 0; i < (dst->size_bytes / 8); i++) {
-            ptr[i] = bswap64(out_view->data.as_uint64[i]);
-          }
+          int width = (int)(src->element_size_bits / 8);
+          ArrowIpcByteSwap(ptr_src, ptr_dst, size_bytes / width, width);
           break;
         }
         default:
+          ArrowBufferReset(&tmp);
           ArrowErrorSet(
               error, "Endian swapping for element bitwidth %" PRId64 " is not supported",
               src->element_size_bits);
@@ -1734,6 +1941,7 @@ static int ArrowIpcDecoderSwapEndian(struct ArrowIpcBufferSource* src,
       }
       break;
   }
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_SWAP_ENDIAN, swap_start, size_bytes);
 
   ArrowBufferReset(&tmp);
   out_view->data.data = dst->data;
@@ -1749,8 +1957,39 @@ struct ArrowIpcArraySetter {
   struct ArrowIpcBufferSource src;
   struct ArrowIpcBufferFactory factory;
   enum ArrowIpcMetadataVersion version;
+  flatbuffers_int64_vec_t variadic_buffer_counts;
+  int64_t variadic_i;
+  const void** variadic_buffers;
+  int64_t* variadic_buffer_sizes;
 };
 
+// Buffers are swapped in place only if no two of them share any bytes of the body:
+// otherwise a range would be swapped once for each buffer that refers to it. Writers
+// lay buffers out in increasing order, so a single pass that checks that each buffer
+// starts after the previous ones end is enough; anything else is treated as
+// possibly overlapping.
+static int ArrowIpcDecoderBuffersMayOverlap(ns(Buffer_vec_t) buffers) {
+  int64_t max_end = 0;
+  int64_t n_buffers = ns(Buffer_vec_len(buffers));
+  for (int64_t i = 0; i < n_buffers; i++) {
+    ns(Buffer_struct_t) buffer = ns(Buffer_vec_at(buffers, (size_t)i));
+    int64_t offset = ns(Buffer_offset(buffer));
+    int64_t length = ns(Buffer_length(buffer));
+    if (length == 0) {
+      continue;
+    }
+
+    // Invalid offsets are reported when the buffer itself is made
+    if (offset < max_end || length < 0 || length > (INT64_MAX - offset)) {
+      return 1;
+    }
+
+    max_end = offset + length;
+  }
+
+  return 0;
+}
+
 static int ArrowIpcDecoderMakeBuffer(struct ArrowIpcArraySetter* setter, int64_t offset,
                                      int64_t length, struct ArrowBufferView* out_view,
                                      struct ArrowBuffer* out, struct ArrowError* error) {
@@ -1785,28 +2024,65 @@ static int ArrowIpcDecoderMakeBuffer(struct ArrowIpcArraySetter* setter, int64_t
   return NANOARROW_OK;
 }
 
+// If the scratch buffer was used, move it to the final array. Otherwise,
+// copy the view.
+static int ArrowIpcDecoderMoveOrCopyBuffer(struct ArrowBufferView view,
+                                           struct ArrowBuffer* scratch_buffer,
+                                           struct ArrowBuffer* buffer_out,
+                                           struct ArrowError* error) {
+  if (scratch_buffer->size_bytes == 0) {
+    NANOARROW_TRACE_BEGIN(allocate_start);
+    NANOARROW_RETURN_NOT_OK(ArrowBufferAppendBufferView(buffer_out, view));
+    NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_ALLOCATE_BUFFER, allocate_start,
+                        view.size_bytes);
+  } else if (scratch_buffer->data == view.data.as_uint8) {
+    ArrowBufferMove(scratch_buffer, buffer_out);
+  } else {
+    ArrowErrorSet(
+        error,
+        "Internal: scratch buffer was used but doesn't point to the same data as view");
+    return EINVAL;
+  }
+
+  return NANOARROW_OK;
+}
+
 static int ArrowIpcDecoderWalkGetArray(struct ArrowArrayView* array_view,
                                        struct ArrowArray* array, struct ArrowArray* out,
                                        struct ArrowError* error) {
   out->length = array_view->length;
   out->null_count = array_view->null_count;
 
-  for (int64_t i = 0; i < array->n_buffers; i++) {
-    struct ArrowBufferView view = array_view->buffer_views[i];
-    struct ArrowBuffer* scratch_buffer = ArrowArrayBuffer(array, i);
-    struct ArrowBuffer* buffer_out = ArrowArrayBuffer(out, i);
-
-    // If the scratch buffer was used, move it to the final array. Otherwise,
-    // copy the view.
-    if (scratch_buffer->size_bytes == 0) {
-      NANOARROW_RETURN_NOT_OK(ArrowBufferAppendBufferView(buffer_out, view));
-    } else if (scratch_buffer->data == view.data.as_uint8) {
-      ArrowBufferMove(scratch_buffer, buffer_out);
-    } else {
-      ArrowErrorSet(
-          error,
-          "Internal: scratch buffer was used but doesn't point to the same data as view");
-      return EINVAL;
+  if (ArrowIpcDecoderIsBinaryView(array_view->storage_type)) {
+    for (int64_t i = 0; i < NANOARROW_BINARY_VIEW_FIXED_BUFFERS; i++) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderMoveOrCopyBuffer(
+          array_view->buffer_views[i], ArrowArrayBuffer(array, i),
+          ArrowArrayBuffer(out, i), error));
+    }
+
+    struct ArrowArrayPrivateData* scratch_private =
+        (struct ArrowArrayPrivateData*)array->private_data;
+    struct ArrowArrayPrivateData* out_private =
+        (struct ArrowArrayPrivateData*)out->private_data;
+    if (array_view->n_variadic_buffers > 0) {
+      NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+          ArrowArrayAddVariadicBuffers(out, array_view->n_variadic_buffers), error);
+    }
+
+    for (int32_t i = 0; i < array_view->n_variadic_buffers; i++) {
+      struct ArrowBufferView view;
+      view.data.data = array_view->variadic_buffers[i];
+      view.size_bytes = array_view->variadic_buffer_sizes[i];
+      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderMoveOrCopyBuffer(
+          view, scratch_private->variadic_buffers + i, out_private->variadic_buffers + i,
+          error));
+      out_private->variadic_buffer_sizes[i] = view.size_bytes;
+    }
+  } else {
+    for (int64_t i = 0; i < array->n_buffers; i++) {
+      NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderMoveOrCopyBuffer(
+          array_view->buffer_views[i], ArrowArrayBuffer(array, i),
+          ArrowArrayBuffer(out, i), error));
     }
   }
 
@@ -1818,6 +2094,66 @@ static int ArrowIpcDecoderWalkGetArray(struct ArrowArrayView* array_view,
   return NANOARROW_OK;
 }
 
+// Attempt to re-use any previous allocation unless this buffer is
+// wrapping a custom allocator.
+static void ArrowIpcDecoderResetScratchBuffer(struct ArrowBuffer* buffer) {
+  if (buffer->allocator.private_data != NULL) {
+    ArrowBufferReset(buffer);
+  } else {
+    buffer->size_bytes = 0;
+  }
+}
+
+static int ArrowIpcDecoderWalkSetVariadicBuffers(struct ArrowIpcArraySetter* setter,
+                                                 struct ArrowArrayView* array_view,
+                                                 struct ArrowArray* array,
+                                                 struct ArrowError* error) {
+  int32_t n_variadic_buffers = (int32_t)flatbuffers_int64_vec_at(
+      setter->variadic_buffer_counts, (size_t)setter->variadic_i);
+  setter->variadic_i += 1;
+
+  // The scratch array keeps one ArrowBuffer per variadic buffer in case an
+  // allocation is required (e.g., for decompression)
+  int32_t n_scratch_buffers = ArrowArrayVariadicBufferCount(array);
+  if (n_scratch_buffers < n_variadic_buffers) {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowArrayAddVariadicBuffers(array, n_variadic_buffers - n_scratch_buffers),
+        error);
+  }
+
+  struct ArrowArrayPrivateData* scratch_private =
+      (struct ArrowArrayPrivateData*)array->private_data;
+
+  array_view->n_variadic_buffers = n_variadic_buffers;
+  array_view->variadic_buffers = setter->variadic_buffers;
+  array_view->variadic_buffer_sizes = setter->variadic_buffer_sizes;
+  setter->variadic_buffers += n_variadic_buffers;
+  setter->variadic_buffer_sizes += n_variadic_buffers;
+
+  // Variadic buffers contain bytes and never need endian swapping
+  setter->src.data_type = NANOARROW_TYPE_BINARY;
+  setter->src.element_size_bits = 8;
+
+  for (int32_t i = 0; i < n_variadic_buffers; i++) {
+    ns(Buffer_struct_t) buffer =
+        ns(Buffer_vec_at(setter->buffers, (size_t)setter->buffer_i));
+    int64_t buffer_offset = ns(Buffer_offset(buffer));
+    int64_t buffer_length = ns(Buffer_length(buffer));
+    setter->buffer_i += 1;
+
+    struct ArrowBuffer* buffer_dst = scratch_private->variadic_buffers + i;
+    ArrowIpcDecoderResetScratchBuffer(buffer_dst);
+
+    struct ArrowBufferView buffer_view;
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderMakeBuffer(
+        setter, buffer_offset, buffer_length, &buffer_view, buffer_dst, error));
+    array_view->variadic_buffers[i] = buffer_view.data.data;
+    array_view->variadic_buffer_sizes[i] = buffer_view.size_bytes;
+  }
+
+  return NANOARROW_OK;
+}
+
 static int ArrowIpcDecoderWalkSetArrayView(struct ArrowIpcArraySetter* setter,
                                            struct ArrowArrayView* array_view,
                                            struct ArrowArray* array,
@@ -1856,14 +2192,7 @@ static int ArrowIpcDecoderWalkSetArrayView(struct ArrowIpcArraySetter* setter,
 
     // Provide a buffer that will be used if any allocation has to occur
     struct ArrowBuffer* buffer_dst = ArrowArrayBuffer(array, i);
-
-    // Attempt to re-use any previous allocation unless this buffer is
-    // wrapping a custom allocator.
-    if (buffer_dst->allocator.private_data != NULL) {
-      ArrowBufferReset(buffer_dst);
-    } else {
-      buffer_dst->size_bytes = 0;
-    }
+    ArrowIpcDecoderResetScratchBuffer(buffer_dst);
 
     setter->src.data_type = array_view->layout.buffer_data_type[i];
     setter->src.element_size_bits = array_view->layout.element_size_bits[i];
@@ -1873,6 +2202,11 @@ static int ArrowIpcDecoderWalkSetArrayView(struct ArrowIpcArraySetter* setter,
                                   &array_view->buffer_views[i], buffer_dst, error));
   }
 
+  if (ArrowIpcDecoderIsBinaryView(array_view->storage_type)) {
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcDecoderWalkSetVariadicBuffers(setter, array_view, array, error));
+  }
+
   for (int64_t i = 0; i < array_view->n_children; i++) {
     NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderWalkSetArrayView(
         setter, array_view->children[i], array->children[i], error));
@@ -1955,7 +2289,35 @@ static ArrowErrorCode ArrowIpcDecoderDecodeArrayViewInternal(
   setter.factory = factory;
   setter.src.codec = decoder->codec;
   setter.src.swap_endian = ArrowIpcDecoderNeedsSwapEndian(decoder);
+  setter.src.swap_endian_in_place =
+      factory.mutable_body && setter.src.swap_endian &&
+      !ArrowIpcDecoderBuffersMayOverlap(setter.buffers);
   setter.version = decoder->metadata_version;
+  setter.variadic_buffer_counts = ns(RecordBatch_variadicBufferCounts(batch));
+  setter.variadic_i = root->variadic_offset;
+
+  // Variadic buffers of any binary view fields that precede this one shift where
+  // its buffers start. Pointers and sizes for the variadic buffers of all binary view
+  // fields are stored in decoder-owned memory that the ArrowArrayView(s) point to.
+  int64_t n_variadic_buffers = 0;
+  for (int64_t i = 0; i < private_data->n_variadic_fields; i++) {
+    int64_t count = flatbuffers_int64_vec_at(setter.variadic_buffer_counts, i);
+    if (i < root->variadic_offset) {
+      setter.buffer_i += count;
+    }
+    n_variadic_buffers += count;
+  }
+
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferResize(&private_data->variadic_buffers,
+                        n_variadic_buffers * (int64_t)sizeof(void*), 0),
+      error);
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferResize(&private_data->variadic_buffer_sizes,
+                        n_variadic_buffers * (int64_t)sizeof(int64_t), 0),
+      error);
+  setter.variadic_buffers = (const void**)private_data->variadic_buffers.data;
+  setter.variadic_buffer_sizes = (int64_t*)private_data->variadic_buffer_sizes.data;
 
   // If we are going to need a decompressor here, ensure the default one is
   // initialized.
@@ -1984,8 +2346,10 @@ static ArrowErrorCode ArrowIpcDecoderDecodeArrayViewInternal(
   // If we decoded a compressed message, wait for any pending decompression tasks to
   // complete. The default compressor already performed the decompression
   if (setter.factory.decompressor != NULL) {
+    NANOARROW_TRACE_BEGIN(decompress_start);
     NANOARROW_RETURN_NOT_OK(setter.factory.decompressor->decompress_wait(
         setter.factory.decompressor, -1, error));
+    NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_DECOMPRESS, decompress_start, 0);
   }
 
   *out_view = root->array_view;
@@ -2025,13 +2389,13 @@ ArrowErrorCode ArrowIpcDecoderDecodeArray(struct ArrowIpcDecoder* decoder,
   return NANOARROW_OK;
 }
 
-ArrowErrorCode ArrowIpcDecoderDecodeArrayFromShared(
-    struct ArrowIpcDecoder* decoder, struct ArrowIpcSharedBuffer* body, int64_t i,
+static ArrowErrorCode ArrowIpcDecoderDecodeArrayFromSharedInternal(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcBufferFactory factory, int64_t i,
     struct ArrowArray* out, enum ArrowValidationLevel validation_level,
     struct ArrowError* error) {
   struct ArrowArrayView* array_view;
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayViewInternal(
-      decoder, ArrowIpcBufferFactoryFromShared(body), i, &array_view, error));
+  NANOARROW_RETURN_NOT_OK(
+      ArrowIpcDecoderDecodeArrayViewInternal(decoder, factory, i, &array_view, error));
 
   NANOARROW_RETURN_NOT_OK(ArrowArrayViewValidate(array_view, validation_level, error));
 
@@ -2048,3 +2412,34 @@ ArrowErrorCode ArrowIpcDecoderDecodeArrayFromShared(
   ArrowArrayMove(&temp, out);
   return NANOARROW_OK;
 }
+
+ArrowErrorCode ArrowIpcDecoderDecodeArrayFromShared(
+    struct ArrowIpcDecoder* decoder, struct ArrowIpcSharedBuffer* body, int64_t i,
+    struct ArrowArray* out, enum ArrowValidationLevel validation_level,
+    struct ArrowError* error) {
+  return ArrowIpcDecoderDecodeArrayFromSharedInternal(
+      decoder, ArrowIpcBufferFactoryFromShared(body), i, out, validation_level, error);
+}
+
+ArrowErrorCode ArrowIpcDecoderDecodeArrayFromOwned(
+    struct ArrowIpcDecoder* decoder, struct ArrowBuffer* body, int64_t i,
+    struct ArrowArray* out, enum ArrowValidationLevel validation_level,
+    struct ArrowError* error) {
+  struct ArrowIpcSharedBuffer shared;
+  int result = ArrowIpcSharedBufferInit(&shared, body);
+  if (result != NANOARROW_OK) {
+    ArrowBufferReset(body);
+    ArrowErrorSet(error, "ArrowIpcSharedBufferInit() failed");
+    return result;
+  }
+
+  // Nothing else can reference the body, so buffers that require an endian swap
+  // can be swapped where they are instead of copied
+  struct ArrowIpcBufferFactory factory = ArrowIpcBufferFactoryFromShared(&shared);
+  factory.mutable_body = 1;
+
+  result = ArrowIpcDecoderDecodeArrayFromSharedInternal(decoder, factory, i, out,
+                                                         validation_level, error);
+  ArrowIpcSharedBufferReset(&shared);
+  return result;
+}
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
 #include <thread>
 
@@ -43,6 +44,7 @@ struct ArrowIpcField {
   struct ArrowArrayView* array_view;
   struct ArrowArray* array;
   int64_t buffer_offset;
+  int64_t variadic_offset;
 };
 
 struct ArrowIpcDecoderPrivate {
@@ -53,6 +55,12 @@ struct ArrowIpcDecoderPrivate {
   int64_t n_fields;
   struct ArrowIpcField* fields;
   int64_t n_buffers;
+  int64_t n_union_fields;
+  int64_t n_variadic_fields;
+  struct ArrowBuffer variadic_buffers;
+  struct ArrowBuffer variadic_buffer_sizes;
+  struct ArrowSchema schema;
+  uint64_t schema_hash;
   const void* last_message;
   struct ArrowIpcFooter footer;
   struct ArrowIpcDecompressor decompressor;
@@ -352,6 +360,9 @@ TEST(NanoarrowIpcTest, NanoarrowIpcDecodeSimpleSchema) {
   EXPECT_EQ(schema.children[0]->flags, ARROW_FLAG_NULLABLE);
   EXPECT_STREQ(schema.children[0]->format, "i");
 
+  // The decoded schema can be modified in place
+  EXPECT_EQ(ArrowSchemaSetName(schema.children[0], "renamed"), NANOARROW_OK);
+
   ArrowSchemaRelease(&schema);
   ArrowIpcDecoderReset(&decoder);
 }
@@ -535,6 +546,22 @@ TEST(NanoarrowIpcTest, NanoarrowIpcSetSchema) {
   EXPECT_EQ(decoder_private->n_fields, 2);
   EXPECT_EQ(decoder_private->n_buffers, 3);
 
+  // Setting a schema with the same types (even if other fields differ) should
+  // reuse what was built from the previous schema
+  struct ArrowIpcField* fields = decoder_private->fields;
+  ASSERT_EQ(ArrowSchemaSetName(schema.children[0], "col1_renamed"), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(decoder_private->fields, fields);
+  EXPECT_EQ(decoder_private->schema_hash, ArrowSchemaHash(&schema, 0));
+
+  // ...but a schema with different types should not
+  ASSERT_EQ(ArrowSchemaSetType(schema.children[0], NANOARROW_TYPE_STRING), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcDecoderSetSchema(&decoder, &schema, nullptr), NANOARROW_OK);
+  EXPECT_EQ(decoder_private->n_fields, 2);
+  EXPECT_EQ(decoder_private->n_buffers, 4);
+  EXPECT_EQ(decoder_private->fields[1].array_view->storage_type, NANOARROW_TYPE_STRING);
+  EXPECT_EQ(decoder_private->schema_hash, ArrowSchemaHash(&schema, 0));
+
   ArrowSchemaRelease(&schema);
   ArrowIpcDecoderReset(&decoder);
 }
@@ -925,12 +952,675 @@ void AssertArrayViewIdentical(const struct ArrowArrayView* actual,
     }
   }
 
+  ASSERT_EQ(actual->n_variadic_buffers, expected->n_variadic_buffers);
+  for (int32_t i = 0; i < actual->n_variadic_buffers; i++) {
+    ASSERT_EQ(actual->variadic_buffer_sizes[i], expected->variadic_buffer_sizes[i]);
+    if (actual->variadic_buffer_sizes[i] != 0) {
+      ASSERT_EQ(memcmp(actual->variadic_buffers[i], expected->variadic_buffers[i],
+                       actual->variadic_buffer_sizes[i]),
+                0);
+    }
+  }
+
   ASSERT_EQ(actual->n_children, expected->n_children);
   for (int i = 0; i < actual->n_children; i++) {
     AssertArrayViewIdentical(actual->children[i], expected->children[i]);
   }
 }
 
+static std::string ViewTestString(int64_t i) {
+  // Alternate between values that are inlined in the view and values that
+  // live in a variadic buffer
+  if (i % 2 == 0) {
+    return "short" + std::to_string(i);
+  } else {
+    return std::string(100, static_cast<char>('a' + (i % 26))) + std::to_string(i);
+  }
+}
+
+static void MakeViewTestBatch(struct ArrowSchema* schema, struct ArrowArray* array,
+                              int64_t n) {
+  ArrowSchemaInit(schema);
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_STRING_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "views"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "ints"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2], NANOARROW_TYPE_LIST_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[2], "list_views"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int64_t i = 0; i < n; i++) {
+    if (i % 7 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[0], 1), NANOARROW_OK);
+    } else {
+      std::string value = ViewTestString(i);
+      ASSERT_EQ(
+          ArrowArrayAppendString(array->children[0],
+                                 {value.data(), static_cast<int64_t>(value.size())}),
+          NANOARROW_OK);
+    }
+
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[1], i), NANOARROW_OK);
+
+    for (int64_t j = 0; j < (i % 3); j++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[2]->children[0], i + j),
+                NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(array->children[2]), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+static void CheckViewTestStrings(const struct ArrowArrayView* array_view, int64_t n) {
+  ASSERT_EQ(array_view->storage_type, NANOARROW_TYPE_STRING_VIEW);
+  ASSERT_EQ(array_view->length, n);
+  for (int64_t i = 0; i < n; i++) {
+    if (i % 7 == 0) {
+      EXPECT_TRUE(ArrowArrayViewIsNull(array_view, i));
+      continue;
+    }
+
+    struct ArrowStringView item = ArrowArrayViewGetStringUnsafe(array_view, i);
+    EXPECT_EQ(std::string(item.data, item.size_bytes), ViewTestString(i));
+  }
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcViewTypesRoundtrip) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  struct ArrowError error;
+  constexpr int64_t kNumRows = 2000;
+
+  ASSERT_NO_FATAL_FAILURE(MakeViewTestBatch(schema.get(), array.get(), kNumRows));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), &error), NANOARROW_OK);
+
+  // Make sure the long strings span more than one variadic buffer
+  int32_t n_variadic_buffers = array_view->children[0]->n_variadic_buffers;
+  ASSERT_GT(n_variadic_buffers, 1);
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  nanoarrow::UniqueBuffer buffer, body_buffer;
+  ASSERT_EQ(ArrowIpcEncoderInit(encoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSimpleRecordBatch(encoder.get(), array_view.get(),
+                                                   body_buffer.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(
+      ArrowIpcEncoderFinalizeBuffer(encoder.get(), /*encapsulate=*/true, buffer.get()),
+      NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(decoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(decoder.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(decoder.get(),
+                                        {{buffer->data}, buffer->size_bytes}, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  struct ArrowBufferView body = {{body_buffer->data}, body_buffer->size_bytes};
+
+  // Check the whole batch as an ArrowArrayView, which points into the body
+  struct ArrowArrayView* roundtripped;
+  ASSERT_EQ(
+      ArrowIpcDecoderDecodeArrayView(decoder.get(), body, -1, &roundtripped, &error),
+      NANOARROW_OK)
+      << error.message;
+  AssertArrayViewIdentical(roundtripped, array_view.get());
+  ASSERT_NO_FATAL_FAILURE(CheckViewTestStrings(roundtripped->children[0], kNumRows));
+  for (int32_t i = 0; i < n_variadic_buffers; i++) {
+    const uint8_t* variadic_buffer =
+        reinterpret_cast<const uint8_t*>(roundtripped->children[0]->variadic_buffers[i]);
+    EXPECT_GE(variadic_buffer, body.data.as_uint8);
+    EXPECT_LT(variadic_buffer, body.data.as_uint8 + body.size_bytes);
+  }
+
+  // Fields after the binary view must account for its variadic buffers
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayView(decoder.get(), body, 1, &roundtripped, &error),
+            NANOARROW_OK)
+      << error.message;
+  AssertArrayViewIdentical(roundtripped, array_view->children[1]);
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayView(decoder.get(), body, 2, &roundtripped, &error),
+            NANOARROW_OK)
+      << error.message;
+  AssertArrayViewIdentical(roundtripped, array_view->children[2]);
+
+  // Check ArrowArray extraction with a copy and with shared buffers
+  nanoarrow::UniqueArray decoded;
+  ASSERT_EQ(ArrowIpcDecoderDecodeArray(decoder.get(), body, -1, decoded.get(),
+                                       NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(decoded->children[0]->n_buffers,
+            NANOARROW_BINARY_VIEW_FIXED_BUFFERS + n_variadic_buffers + 1);
+
+  nanoarrow::UniqueArrayView decoded_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(decoded_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(decoded_view.get(), decoded.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  AssertArrayViewIdentical(decoded_view.get(), array_view.get());
+
+  struct ArrowIpcSharedBuffer shared;
+  nanoarrow::UniqueBuffer shared_body;
+  ASSERT_EQ(ArrowBufferAppend(shared_body.get(), body_buffer->data,
+                              body_buffer->size_bytes),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&shared, shared_body.get()), NANOARROW_OK);
+  decoded.reset();
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromShared(decoder.get(), &shared, 0,
+                                                 decoded.get(),
+                                                 NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ArrowIpcSharedBufferReset(&shared);
+
+  decoded_view.reset();
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(decoded_view.get(), schema->children[0], &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(decoded_view.get(), decoded.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_NO_FATAL_FAILURE(CheckViewTestStrings(decoded_view.get(), kNumRows));
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcViewTypesVariadicBufferCountErrors) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueSchema binary_schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  struct ArrowError error;
+
+  ASSERT_NO_FATAL_FAILURE(MakeViewTestBatch(schema.get(), array.get(), 10));
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), &error), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  nanoarrow::UniqueBuffer buffer, body_buffer;
+  ASSERT_EQ(ArrowIpcEncoderInit(encoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSimpleRecordBatch(encoder.get(), array_view.get(),
+                                                   body_buffer.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(
+      ArrowIpcEncoderFinalizeBuffer(encoder.get(), /*encapsulate=*/true, buffer.get()),
+      NANOARROW_OK);
+
+  // A schema without any binary view fields expects no variadicBufferCounts
+  ArrowSchemaInit(binary_schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(binary_schema.get(), 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(binary_schema->children[0], NANOARROW_TYPE_BINARY),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(binary_schema->children[1], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(binary_schema->children[2], NANOARROW_TYPE_LIST_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowSchemaSetType(binary_schema->children[2]->children[0], NANOARROW_TYPE_INT32),
+      NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(decoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(decoder.get(), binary_schema.get(), &error),
+            NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcDecoderDecodeHeader(decoder.get(),
+                                        {{buffer->data}, buffer->size_bytes}, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "Expected 0 variadicBufferCounts in message but found 1");
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcViewTypesSwapEndian) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  struct ArrowError error;
+  constexpr int64_t kNumRows = 100;
+
+  ASSERT_NO_FATAL_FAILURE(MakeViewTestBatch(schema.get(), array.get(), kNumRows));
+
+  // "Manually" swap the integer fields of each view to simulate a message written
+  // by a producer of the non-native endianness
+  auto views = reinterpret_cast<union ArrowBinaryView*>(
+      const_cast<void*>(array->children[0]->buffers[1]));
+  for (int64_t i = 0; i < kNumRows; i++) {
+    bool inlined = views[i].inlined.size <= NANOARROW_BINARY_VIEW_INLINE_SIZE;
+    views[i].inlined.size =
+        static_cast<int32_t>(bswap32(static_cast<uint32_t>(views[i].inlined.size)));
+    if (!inlined) {
+      views[i].ref.buffer_index = static_cast<int32_t>(
+          bswap32(static_cast<uint32_t>(views[i].ref.buffer_index)));
+      views[i].ref.offset =
+          static_cast<int32_t>(bswap32(static_cast<uint32_t>(views[i].ref.offset)));
+    }
+  }
+
+  // Only the string view column is checked (the other columns were not swapped)
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArrayMinimal(array_view.get(), array.get(), &error),
+            NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  nanoarrow::UniqueBuffer buffer, body_buffer;
+  ASSERT_EQ(ArrowIpcEncoderInit(encoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSimpleRecordBatch(encoder.get(), array_view.get(),
+                                                   body_buffer.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(
+      ArrowIpcEncoderFinalizeBuffer(encoder.get(), /*encapsulate=*/true, buffer.get()),
+      NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(decoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(decoder.get(), schema.get(), &error),
+            NANOARROW_OK);
+#ifdef __BIG_ENDIAN__
+  ASSERT_EQ(ArrowIpcDecoderSetEndianness(decoder.get(), NANOARROW_IPC_ENDIANNESS_LITTLE),
+            NANOARROW_OK);
+#else
+  ASSERT_EQ(ArrowIpcDecoderSetEndianness(decoder.get(), NANOARROW_IPC_ENDIANNESS_BIG),
+            NANOARROW_OK);
+#endif
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(decoder.get(),
+                                        {{buffer->data}, buffer->size_bytes}, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  struct ArrowArrayView* roundtripped;
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayView(decoder.get(),
+                                           {{body_buffer->data}, body_buffer->size_bytes},
+                                           0, &roundtripped, &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_NO_FATAL_FAILURE(CheckViewTestStrings(roundtripped, kNumRows));
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcViewAndRunEndEncodedSchemaRoundtrip) {
+  nanoarrow::UniqueSchema schema;
+  struct ArrowError error;
+
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 5), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_STRING_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_BINARY_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2], NANOARROW_TYPE_LIST_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[3], NANOARROW_TYPE_LARGE_LIST_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[3]->children[0], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(schema->children[4], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[4]->children[1], NANOARROW_TYPE_DOUBLE),
+            NANOARROW_OK);
+  for (int64_t i = 0; i < schema->n_children; i++) {
+    ASSERT_EQ(ArrowSchemaSetName(schema->children[i], "col"), NANOARROW_OK);
+  }
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  nanoarrow::UniqueBuffer buffer;
+  ASSERT_EQ(ArrowIpcEncoderInit(encoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSchema(encoder.get(), schema.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(
+      ArrowIpcEncoderFinalizeBuffer(encoder.get(), /*encapsulate=*/true, buffer.get()),
+      NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(decoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(decoder.get(),
+                                        {{buffer->data}, buffer->size_bytes}, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueSchema roundtripped;
+  ASSERT_EQ(ArrowIpcDecoderDecodeSchema(decoder.get(), roundtripped.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+
+  char expected[1024];
+  char actual[1024];
+  ArrowSchemaToString(schema.get(), expected, sizeof(expected), /*recursive=*/true);
+  ArrowSchemaToString(roundtripped.get(), actual, sizeof(actual), /*recursive=*/true);
+  EXPECT_STREQ(actual, expected);
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcRunEndEncodedRoundtrip) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  struct ArrowError error;
+
+  // struct<col: run_end_encoded<int32, string>> with the runs
+  // ["a", "a", "a", null, null, "ccc", "ccc", "ccc", "ccc", "ccc"]
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetTypeRunEndEncoded(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0]->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col"), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  struct ArrowArray* ree = array->children[0];
+  ASSERT_EQ(ArrowArrayAppendInt(ree->children[0], 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(ree->children[0], 5), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendInt(ree->children[0], 10), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(ree->children[1], ArrowCharView("a")), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendNull(ree->children[1], 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayAppendString(ree->children[1], ArrowCharView("ccc")),
+            NANOARROW_OK);
+  ree->length = 10;
+  array->length = 10;
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), &error), NANOARROW_OK)
+      << error.message;
+
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), &error), NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  nanoarrow::UniqueBuffer buffer, body_buffer;
+  ASSERT_EQ(ArrowIpcEncoderInit(encoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSimpleRecordBatch(encoder.get(), array_view.get(),
+                                                   body_buffer.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(
+      ArrowIpcEncoderFinalizeBuffer(encoder.get(), /*encapsulate=*/true, buffer.get()),
+      NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(decoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(decoder.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(decoder.get(),
+                                        {{buffer->data}, buffer->size_bytes}, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  struct ArrowBufferView body = {{body_buffer->data}, body_buffer->size_bytes};
+  struct ArrowArrayView* roundtripped;
+  ASSERT_EQ(
+      ArrowIpcDecoderDecodeArrayView(decoder.get(), body, -1, &roundtripped, &error),
+      NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(ArrowArrayViewValidate(roundtripped, NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  AssertArrayViewIdentical(roundtripped, array_view.get());
+  EXPECT_EQ(roundtripped->children[0]->length, 10);
+
+  // The values child of a run-end encoded field can be decoded on its own
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayView(decoder.get(), body, 2, &roundtripped, &error),
+            NANOARROW_OK)
+      << error.message;
+  AssertArrayViewIdentical(roundtripped, array_view->children[0]->children[1]);
+
+  // Check the shared buffer path, which should not copy the run ends or values
+  struct ArrowIpcSharedBuffer shared;
+  nanoarrow::UniqueBuffer shared_body;
+  ASSERT_EQ(
+      ArrowBufferAppend(shared_body.get(), body_buffer->data, body_buffer->size_bytes),
+      NANOARROW_OK);
+  const uint8_t* body_begin = shared_body->data;
+  const uint8_t* body_end = body_begin + shared_body->size_bytes;
+  ASSERT_EQ(ArrowIpcSharedBufferInit(&shared, shared_body.get()), NANOARROW_OK);
+
+  nanoarrow::UniqueArray decoded;
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromShared(decoder.get(), &shared, -1,
+                                                 decoded.get(),
+                                                 NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  ArrowIpcSharedBufferReset(&shared);
+
+  ASSERT_EQ(decoded->children[0]->n_buffers, 0);
+  auto run_ends =
+      reinterpret_cast<const uint8_t*>(decoded->children[0]->children[0]->buffers[1]);
+  EXPECT_GE(run_ends, body_begin);
+  EXPECT_LT(run_ends, body_end);
+
+  nanoarrow::UniqueArrayView decoded_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(decoded_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(decoded_view.get(), decoded.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  AssertArrayViewIdentical(decoded_view.get(), array_view.get());
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcSwapEndianFromOwned) {
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  struct ArrowError error;
+  // Not a multiple of any SIMD block size to check the remainder
+  constexpr int64_t kNumRows = 1003;
+
+  std::vector<enum ArrowType> types = {
+      NANOARROW_TYPE_INT16,  NANOARROW_TYPE_INT32,      NANOARROW_TYPE_INT64,
+      NANOARROW_TYPE_DOUBLE, NANOARROW_TYPE_DECIMAL128, NANOARROW_TYPE_DECIMAL256};
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), static_cast<int64_t>(types.size())),
+            NANOARROW_OK);
+  for (size_t i = 0; i < types.size(); i++) {
+    if (types[i] == NANOARROW_TYPE_DECIMAL128) {
+      ASSERT_EQ(ArrowSchemaSetTypeDecimal(schema->children[i], types[i], 38, 0),
+                NANOARROW_OK);
+    } else if (types[i] == NANOARROW_TYPE_DECIMAL256) {
+      ASSERT_EQ(ArrowSchemaSetTypeDecimal(schema->children[i], types[i], 76, 0),
+                NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowSchemaSetType(schema->children[i], types[i]), NANOARROW_OK);
+    }
+  }
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  for (int64_t i = 0; i < kNumRows; i++) {
+    for (size_t j = 0; j < types.size(); j++) {
+      if (types[j] == NANOARROW_TYPE_DECIMAL128 ||
+          types[j] == NANOARROW_TYPE_DECIMAL256) {
+        struct ArrowDecimal decimal;
+        ArrowDecimalInit(&decimal, types[j] == NANOARROW_TYPE_DECIMAL128 ? 128 : 256, 38,
+                         0);
+        ArrowDecimalSetInt(&decimal, i * 1000003);
+        ASSERT_EQ(ArrowArrayAppendDecimal(array->children[j], &decimal), NANOARROW_OK);
+      } else {
+        ASSERT_EQ(ArrowArrayAppendInt(array->children[j], i * 31), NANOARROW_OK);
+      }
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), &error), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  nanoarrow::UniqueBuffer buffer, body_buffer;
+  ASSERT_EQ(ArrowIpcEncoderInit(encoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSimpleRecordBatch(encoder.get(), array_view.get(),
+                                                   body_buffer.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(
+      ArrowIpcEncoderFinalizeBuffer(encoder.get(), /*encapsulate=*/true, buffer.get()),
+      NANOARROW_OK);
+
+  // Decode the message as if it had been written with the non-native endianness
+  // such that every value is byte-swapped
+  nanoarrow::ipc::UniqueDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(decoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(decoder.get(), schema.get(), &error), NANOARROW_OK);
+#ifdef __BIG_ENDIAN__
+  ASSERT_EQ(ArrowIpcDecoderSetEndianness(decoder.get(), NANOARROW_IPC_ENDIANNESS_LITTLE),
+            NANOARROW_OK);
+#else
+  ASSERT_EQ(ArrowIpcDecoderSetEndianness(decoder.get(), NANOARROW_IPC_ENDIANNESS_BIG),
+            NANOARROW_OK);
+#endif
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(decoder.get(),
+                                        {{buffer->data}, buffer->size_bytes}, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  auto check_swapped = [&](struct ArrowArray* decoded) {
+    for (size_t j = 0; j < types.size(); j++) {
+      auto expected = reinterpret_cast<const uint8_t*>(array->children[j]->buffers[1]);
+      auto actual = reinterpret_cast<const uint8_t*>(decoded->children[j]->buffers[1]);
+      int64_t width = array_view->children[j]->layout.element_size_bits[1] / 8;
+      for (int64_t i = 0; i < kNumRows; i++) {
+        for (int64_t k = 0; k < width; k++) {
+          ASSERT_EQ(actual[i * width + k], expected[i * width + width - k - 1])
+              << "column " << j << " row " << i;
+        }
+      }
+    }
+  };
+
+  // Copy and swap
+  nanoarrow::UniqueArray decoded;
+  ASSERT_EQ(ArrowIpcDecoderDecodeArray(decoder.get(),
+                                       {{body_buffer->data}, body_buffer->size_bytes}, -1,
+                                       decoded.get(), NANOARROW_VALIDATION_LEVEL_FULL,
+                                       &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_NO_FATAL_FAILURE(check_swapped(decoded.get()));
+
+  // Swap in place: the buffers of the decoded array point into the original body
+  nanoarrow::UniqueBuffer owned_body;
+  ASSERT_EQ(
+      ArrowBufferAppend(owned_body.get(), body_buffer->data, body_buffer->size_bytes),
+      NANOARROW_OK);
+  const uint8_t* body_begin = owned_body->data;
+  const uint8_t* body_end = body_begin + owned_body->size_bytes;
+
+  decoded.reset();
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromOwned(decoder.get(), owned_body.get(), -1,
+                                                decoded.get(),
+                                                NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(owned_body->data, nullptr);
+  ASSERT_NO_FATAL_FAILURE(check_swapped(decoded.get()));
+  for (size_t j = 0; j < types.size(); j++) {
+    auto data = reinterpret_cast<const uint8_t*>(decoded->children[j]->buffers[1]);
+    EXPECT_GE(data, body_begin);
+    EXPECT_LT(data, body_end);
+  }
+}
+
+TEST(NanoarrowIpcTest, NanoarrowIpcSwapEndianFromOwnedAliasedBuffers) {
+#ifdef __BIG_ENDIAN__
+  GTEST_SKIP() << "Patching the message flatbuffer assumes a little endian host";
+#endif
+  nanoarrow::UniqueSchema schema;
+  nanoarrow::UniqueArray array;
+  nanoarrow::UniqueArrayView array_view;
+  struct ArrowError error;
+  constexpr int64_t kNumRows = 100;
+
+  ArrowSchemaInit(schema.get());
+  ASSERT_EQ(ArrowSchemaSetTypeStruct(schema.get(), 2), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[0], NANOARROW_TYPE_INT32), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[1], NANOARROW_TYPE_INT32), NANOARROW_OK);
+
+  ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+  for (int64_t i = 0; i < kNumRows; i++) {
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[0], i * 31), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendInt(array->children[1], -i * 31 - 1), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), &error),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), &error), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueEncoder encoder;
+  nanoarrow::UniqueBuffer buffer, body_buffer;
+  ASSERT_EQ(ArrowIpcEncoderInit(encoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcEncoderEncodeSimpleRecordBatch(encoder.get(), array_view.get(),
+                                                   body_buffer.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(
+      ArrowIpcEncoderFinalizeBuffer(encoder.get(), /*encapsulate=*/true, buffer.get()),
+      NANOARROW_OK);
+
+  // Point the data buffer of the second column at the data buffer of the first one
+  // by rewriting its Buffer struct (offset, length), which is the last one in the
+  // message
+  int64_t length = kNumRows * static_cast<int64_t>(sizeof(int32_t));
+  auto find = [](struct ArrowBuffer* haystack, const void* needle, int64_t size) {
+    auto needle_begin = static_cast<const uint8_t*>(needle);
+    uint8_t* end = haystack->data + haystack->size_bytes;
+    uint8_t* found =
+        std::find_end(haystack->data, end, needle_begin, needle_begin + size);
+    return found == end ? -1 : found - haystack->data;
+  };
+  int64_t offsets[] = {find(body_buffer.get(), array->children[0]->buffers[1], length),
+                       find(body_buffer.get(), array->children[1]->buffers[1], length)};
+  ASSERT_GE(offsets[0], 0);
+  ASSERT_GT(offsets[1], offsets[0]);
+
+  int64_t buffer_struct[] = {offsets[1], length};
+  int64_t struct_offset = find(buffer.get(), buffer_struct, sizeof(buffer_struct));
+  ASSERT_GE(struct_offset, 0);
+  memcpy(buffer->data + struct_offset, &offsets[0], sizeof(int64_t));
+
+  nanoarrow::ipc::UniqueDecoder decoder;
+  ASSERT_EQ(ArrowIpcDecoderInit(decoder.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetSchema(decoder.get(), schema.get(), &error), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderSetEndianness(decoder.get(), NANOARROW_IPC_ENDIANNESS_BIG),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcDecoderDecodeHeader(decoder.get(),
+                                        {{buffer->data}, buffer->size_bytes}, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  // Both columns must see the first column's values swapped exactly once
+  nanoarrow::UniqueArray decoded;
+  ASSERT_EQ(ArrowIpcDecoderDecodeArrayFromOwned(decoder.get(), body_buffer.get(), -1,
+                                                decoded.get(),
+                                                NANOARROW_VALIDATION_LEVEL_FULL, &error),
+            NANOARROW_OK)
+      << error.message;
+  auto expected = reinterpret_cast<const int32_t*>(array->children[0]->buffers[1]);
+  for (int64_t j = 0; j < 2; j++) {
+    auto actual = reinterpret_cast<const int32_t*>(decoded->children[j]->buffers[1]);
+    for (int64_t i = 0; i < kNumRows; i++) {
+      ASSERT_EQ(actual[i], static_cast<int32_t>(bswap32(expected[i])))
+          << "column " << j << " row " << i;
+    }
+  }
+}
+
 #if defined(NANOARROW_BUILD_TESTS_WITH_ARROW)
 TEST_P(ArrowTypeParameterizedTestFixture, NanoarrowIpcNanoarrowArrayRoundtrip) {
   struct ArrowError error;
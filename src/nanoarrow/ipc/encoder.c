@@ -44,6 +44,7 @@ struct ArrowIpcEncoderPrivate {
   flatcc_builder_t builder;
   struct ArrowBuffer buffers;
   struct ArrowBuffer nodes;
+  struct ArrowBuffer variadic_buffer_counts;
   int encoding_footer;
 };
 
@@ -63,6 +64,7 @@ ArrowErrorCode ArrowIpcEncoderInit(struct ArrowIpcEncoder* encoder) {
   private->encoding_footer = 0;
   ArrowBufferInit(&private->buffers);
   ArrowBufferInit(&private->nodes);
+  ArrowBufferInit(&private->variadic_buffer_counts);
   return NANOARROW_OK;
 }
 
@@ -74,6 +76,7 @@ void ArrowIpcEncoderReset(struct ArrowIpcEncoder* encoder) {
     flatcc_builder_clear(&private->builder);
     ArrowBufferReset(&private->nodes);
     ArrowBufferReset(&private->buffers);
+    ArrowBufferReset(&private->variadic_buffer_counts);
     ArrowFree(private);
   }
   memset(encoder, 0, sizeof(struct ArrowIpcEncoder));
@@ -211,6 +214,14 @@ static ArrowErrorCode ArrowIpcEncodeFieldType(flatcc_builder_t* builder,
       FLATCC_RETURN_UNLESS_0(Field_type_LargeBinary_create(builder), error);
       return NANOARROW_OK;
 
+    case NANOARROW_TYPE_STRING_VIEW:
+      FLATCC_RETURN_UNLESS_0(Field_type_Utf8View_create(builder), error);
+      return NANOARROW_OK;
+
+    case NANOARROW_TYPE_BINARY_VIEW:
+      FLATCC_RETURN_UNLESS_0(Field_type_BinaryView_create(builder), error);
+      return NANOARROW_OK;
+
     case NANOARROW_TYPE_DATE32:
       FLATCC_RETURN_UNLESS_0(Field_type_Date_create(builder, ns(DateUnit_DAY)), error);
       return NANOARROW_OK;
@@ -280,6 +291,14 @@ static ArrowErrorCode ArrowIpcEncodeFieldType(flatcc_builder_t* builder,
       FLATCC_RETURN_UNLESS_0(Field_type_LargeList_create(builder), error);
       return NANOARROW_OK;
 
+    case NANOARROW_TYPE_LIST_VIEW:
+      FLATCC_RETURN_UNLESS_0(Field_type_ListView_create(builder), error);
+      return NANOARROW_OK;
+
+    case NANOARROW_TYPE_LARGE_LIST_VIEW:
+      FLATCC_RETURN_UNLESS_0(Field_type_LargeListView_create(builder), error);
+      return NANOARROW_OK;
+
     case NANOARROW_TYPE_FIXED_SIZE_LIST:
       FLATCC_RETURN_UNLESS_0(
           Field_type_FixedSizeList_create(builder, schema_view->fixed_size), error);
@@ -529,10 +548,23 @@ static ArrowErrorCode ArrowIpcEncoderBuildContiguousBodyBufferCallback(
   return NANOARROW_OK;
 }
 
+static ArrowErrorCode ArrowIpcEncoderEncodeBuffer(
+    struct ArrowIpcEncoder* encoder, struct ArrowIpcBufferEncoder* buffer_encoder,
+    struct ArrowBufferView buffer_view, struct ArrowBuffer* buffers,
+    struct ArrowError* error) {
+  struct ns(Buffer) buffer;
+  NANOARROW_RETURN_NOT_OK(buffer_encoder->encode_buffer(
+      buffer_view, encoder, buffer_encoder, &buffer.offset, &buffer.length, error));
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferAppend(buffers, &buffer, sizeof(buffer)),
+                                     error);
+  return NANOARROW_OK;
+}
+
 static ArrowErrorCode ArrowIpcEncoderEncodeRecordBatchImpl(
     struct ArrowIpcEncoder* encoder, struct ArrowIpcBufferEncoder* buffer_encoder,
     const struct ArrowArrayView* array_view, struct ArrowBuffer* buffers,
-    struct ArrowBuffer* nodes, struct ArrowError* error) {
+    struct ArrowBuffer* nodes, struct ArrowBuffer* variadic_buffer_counts,
+    struct ArrowError* error) {
   if (array_view->offset != 0) {
     ArrowErrorSet(error, "Cannot encode arrays with nonzero offset");
     return ENOTSUP;
@@ -545,17 +577,36 @@ static ArrowErrorCode ArrowIpcEncoderEncodeRecordBatchImpl(
     NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferAppend(nodes, &node, sizeof(node)),
                                        error);
 
-    for (int64_t b = 0; b < child->array->n_buffers; ++b) {
-      struct ns(Buffer) buffer;
-      NANOARROW_RETURN_NOT_OK(
-          buffer_encoder->encode_buffer(child->buffer_views[b], encoder, buffer_encoder,
-                                        &buffer.offset, &buffer.length, error));
+    if (child->storage_type == NANOARROW_TYPE_STRING_VIEW ||
+        child->storage_type == NANOARROW_TYPE_BINARY_VIEW) {
+      // Binary views are written as the validity and views buffers followed by
+      // each variadic data buffer (the buffer sizes are implied by the Buffer
+      // entries and are not written)
+      for (int64_t b = 0; b < NANOARROW_BINARY_VIEW_FIXED_BUFFERS; ++b) {
+        NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeBuffer(
+            encoder, buffer_encoder, child->buffer_views[b], buffers, error));
+      }
+
+      for (int32_t b = 0; b < child->n_variadic_buffers; ++b) {
+        struct ArrowBufferView buffer_view;
+        buffer_view.data.data = child->variadic_buffers[b];
+        buffer_view.size_bytes = child->variadic_buffer_sizes[b];
+        NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeBuffer(
+            encoder, buffer_encoder, buffer_view, buffers, error));
+      }
+
+      int64_t n_variadic_buffers = child->n_variadic_buffers;
       NANOARROW_RETURN_NOT_OK_WITH_ERROR(
-          ArrowBufferAppend(buffers, &buffer, sizeof(buffer)), error);
+          ArrowBufferAppendInt64(variadic_buffer_counts, n_variadic_buffers), error);
+    } else {
+      for (int64_t b = 0; b < child->array->n_buffers; ++b) {
+        NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeBuffer(
+            encoder, buffer_encoder, child->buffer_views[b], buffers, error));
+      }
     }
 
     NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeRecordBatchImpl(
-        encoder, buffer_encoder, child, buffers, nodes, error));
+        encoder, buffer_encoder, child, buffers, nodes, variadic_buffer_counts, error));
   }
   return NANOARROW_OK;
 }
@@ -583,6 +634,7 @@ static ArrowErrorCode ArrowIpcEncoderEncodeRecordBatch(
 
   flatcc_builder_t* builder = &private->builder;
 
+  NANOARROW_TRACE_BEGIN(trace_start);
   FLATCC_RETURN_UNLESS_0(Message_start_as_root(builder), error);
   FLATCC_RETURN_UNLESS_0(Message_version_add(builder, ns(MetadataVersion_V5)), error);
 
@@ -591,8 +643,10 @@ static ArrowErrorCode ArrowIpcEncoderEncodeRecordBatch(
 
   NANOARROW_ASSERT_OK(ArrowBufferResize(&private->buffers, 0, 0));
   NANOARROW_ASSERT_OK(ArrowBufferResize(&private->nodes, 0, 0));
+  NANOARROW_ASSERT_OK(ArrowBufferResize(&private->variadic_buffer_counts, 0, 0));
   NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeRecordBatchImpl(
-      encoder, buffer_encoder, array_view, &private->buffers, &private->nodes, error));
+      encoder, buffer_encoder, array_view, &private->buffers, &private->nodes,
+      &private->variadic_buffer_counts, error));
 
   FLATCC_RETURN_UNLESS_0(RecordBatch_nodes_create(  //
                              builder, (struct ns(FieldNode)*)private->nodes.data,
@@ -603,11 +657,22 @@ static ArrowErrorCode ArrowIpcEncoderEncodeRecordBatch(
                              private->buffers.size_bytes / sizeof(struct ns(Buffer))),
                          error);
 
+  // variadicBufferCounts is omitted entirely if there are no binary view fields
+  if (private->variadic_buffer_counts.size_bytes > 0) {
+    FLATCC_RETURN_UNLESS_0(
+        RecordBatch_variadicBufferCounts_create(  //
+            builder, (int64_t*)private->variadic_buffer_counts.data,
+            private->variadic_buffer_counts.size_bytes / sizeof(int64_t)),
+        error);
+  }
+
   FLATCC_RETURN_UNLESS_0(Message_header_RecordBatch_end(builder), error);
 
   FLATCC_RETURN_UNLESS_0(Message_bodyLength_add(builder, buffer_encoder->body_length),
                          error);
   FLATCC_RETURN_IF_NULL(ns(Message_end_as_root(builder)), error);
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_ENCODE_RECORD_BATCH, trace_start,
+                      buffer_encoder->body_length);
   return NANOARROW_OK;
 }
 
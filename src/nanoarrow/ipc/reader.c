@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "nanoarrow/common/atomic_internal.h"
 #include "nanoarrow/nanoarrow.h"
 #include "nanoarrow/nanoarrow_ipc.h"
 
@@ -182,14 +183,259 @@ ArrowErrorCode ArrowIpcInputStreamInitFile(struct ArrowIpcInputStream* stream,
   return NANOARROW_OK;
 }
 
+// The number of released message bodies a reader will keep around for reuse
+#define NANOARROW_IPC_BODY_POOL_SIZE 4
+
+// Each slot in the body pool is either empty, temporarily owned by exactly one
+// thread while its contents are read or written, or full (i.e., holds a released
+// body buffer that can be handed out again).
+#define NANOARROW_IPC_BODY_POOL_SLOT_EMPTY 0
+#define NANOARROW_IPC_BODY_POOL_SLOT_BUSY 1
+#define NANOARROW_IPC_BODY_POOL_SLOT_FULL 2
+
+// When shared buffers are used, the reader hands its body buffer off to the decoded
+// ArrowArray and must allocate a new one for the next message. The body pool is an
+// ArrowBufferAllocator for the body buffer whose free() callback (called when the last
+// ArrowArray referencing an ArrowIpcSharedBuffer is released) keeps the memory keyed
+// by its size such that the next message of the same size can reuse it. Because arrays
+// may be released after the reader itself, the pool is reference counted: the reader
+// holds one reference and every outstanding allocation holds one reference.
+#if NANOARROW_USE_STDATOMIC
+struct ArrowIpcBodyPoolSlot {
+  atomic_int state;
+  uint8_t* data;
+  int64_t size_bytes;
+};
+
+struct ArrowIpcBodyPool {
+  struct ArrowIpcBodyPoolSlot slots[NANOARROW_IPC_BODY_POOL_SIZE];
+  atomic_int closed;
+  atomic_long reference_count;
+};
+
+static int64_t ArrowIpcBodyPoolUpdate(struct ArrowIpcBodyPool* pool, int delta) {
+  int64_t old_count = atomic_fetch_add(&pool->reference_count, delta);
+  return old_count + delta;
+}
+
+static int ArrowIpcBodyPoolSlotAcquire(struct ArrowIpcBodyPoolSlot* slot, int state) {
+  int expected = state;
+  return atomic_compare_exchange_strong(&slot->state, &expected,
+                                        NANOARROW_IPC_BODY_POOL_SLOT_BUSY);
+}
+
+static void ArrowIpcBodyPoolSlotRelease(struct ArrowIpcBodyPoolSlot* slot, int state) {
+  atomic_store(&slot->state, state);
+}
+
+static int ArrowIpcBodyPoolIsClosed(struct ArrowIpcBodyPool* pool) {
+  return atomic_load(&pool->closed);
+}
+
+static void ArrowIpcBodyPoolInitState(struct ArrowIpcBodyPool* pool) {
+  for (int i = 0; i < NANOARROW_IPC_BODY_POOL_SIZE; i++) {
+    atomic_init(&pool->slots[i].state, NANOARROW_IPC_BODY_POOL_SLOT_EMPTY);
+  }
+
+  atomic_init(&pool->closed, 0);
+  atomic_init(&pool->reference_count, 1);
+}
+
+static void ArrowIpcBodyPoolSetClosed(struct ArrowIpcBodyPool* pool) {
+  atomic_store(&pool->closed, 1);
+}
+#else
+struct ArrowIpcBodyPoolSlot {
+  int state;
+  uint8_t* data;
+  int64_t size_bytes;
+};
+
+struct ArrowIpcBodyPool {
+  struct ArrowIpcBodyPoolSlot slots[NANOARROW_IPC_BODY_POOL_SIZE];
+  int closed;
+  int64_t reference_count;
+};
+
+static int64_t ArrowIpcBodyPoolUpdate(struct ArrowIpcBodyPool* pool, int delta) {
+  pool->reference_count += delta;
+  return pool->reference_count;
+}
+
+static int ArrowIpcBodyPoolSlotAcquire(struct ArrowIpcBodyPoolSlot* slot, int state) {
+  if (slot->state != state) {
+    return 0;
+  }
+
+  slot->state = NANOARROW_IPC_BODY_POOL_SLOT_BUSY;
+  return 1;
+}
+
+static void ArrowIpcBodyPoolSlotRelease(struct ArrowIpcBodyPoolSlot* slot, int state) {
+  slot->state = state;
+}
+
+static int ArrowIpcBodyPoolIsClosed(struct ArrowIpcBodyPool* pool) {
+  return pool->closed;
+}
+
+static void ArrowIpcBodyPoolInitState(struct ArrowIpcBodyPool* pool) {
+  for (int i = 0; i < NANOARROW_IPC_BODY_POOL_SIZE; i++) {
+    pool->slots[i].state = NANOARROW_IPC_BODY_POOL_SLOT_EMPTY;
+  }
+
+  pool->closed = 0;
+  pool->reference_count = 1;
+}
+
+static void ArrowIpcBodyPoolSetClosed(struct ArrowIpcBodyPool* pool) {
+  pool->closed = 1;
+}
+#endif
+
+// Returns a previously released buffer of exactly size_bytes or NULL if there is none
+static uint8_t* ArrowIpcBodyPoolTake(struct ArrowIpcBodyPool* pool, int64_t size_bytes) {
+  for (int i = 0; i < NANOARROW_IPC_BODY_POOL_SIZE; i++) {
+    struct ArrowIpcBodyPoolSlot* slot = pool->slots + i;
+    if (!ArrowIpcBodyPoolSlotAcquire(slot, NANOARROW_IPC_BODY_POOL_SLOT_FULL)) {
+      continue;
+    }
+
+    if (slot->size_bytes == size_bytes) {
+      uint8_t* out = slot->data;
+      slot->data = NULL;
+      ArrowIpcBodyPoolSlotRelease(slot, NANOARROW_IPC_BODY_POOL_SLOT_EMPTY);
+      return out;
+    }
+
+    ArrowIpcBodyPoolSlotRelease(slot, NANOARROW_IPC_BODY_POOL_SLOT_FULL);
+  }
+
+  return NULL;
+}
+
+// Stores a released buffer in an empty slot or, if all slots are full, in place of
+// the first one we can acquire (the most recently released size is the most likely
+// to be requested next).
+static void ArrowIpcBodyPoolPut(struct ArrowIpcBodyPool* pool, uint8_t* data,
+                                int64_t size_bytes) {
+  if (!ArrowIpcBodyPoolIsClosed(pool)) {
+    for (int i = 0; i < NANOARROW_IPC_BODY_POOL_SIZE; i++) {
+      struct ArrowIpcBodyPoolSlot* slot = pool->slots + i;
+      if (ArrowIpcBodyPoolSlotAcquire(slot, NANOARROW_IPC_BODY_POOL_SLOT_EMPTY)) {
+        slot->data = data;
+        slot->size_bytes = size_bytes;
+        ArrowIpcBodyPoolSlotRelease(slot, NANOARROW_IPC_BODY_POOL_SLOT_FULL);
+        return;
+      }
+    }
+
+    for (int i = 0; i < NANOARROW_IPC_BODY_POOL_SIZE; i++) {
+      struct ArrowIpcBodyPoolSlot* slot = pool->slots + i;
+      if (ArrowIpcBodyPoolSlotAcquire(slot, NANOARROW_IPC_BODY_POOL_SLOT_FULL)) {
+        uint8_t* evicted = slot->data;
+        slot->data = data;
+        slot->size_bytes = size_bytes;
+        ArrowIpcBodyPoolSlotRelease(slot, NANOARROW_IPC_BODY_POOL_SLOT_FULL);
+        ArrowFree(evicted);
+        return;
+      }
+    }
+  }
+
+  ArrowFree(data);
+}
+
+static void ArrowIpcBodyPoolDrain(struct ArrowIpcBodyPool* pool) {
+  for (int i = 0; i < NANOARROW_IPC_BODY_POOL_SIZE; i++) {
+    struct ArrowIpcBodyPoolSlot* slot = pool->slots + i;
+    if (ArrowIpcBodyPoolSlotAcquire(slot, NANOARROW_IPC_BODY_POOL_SLOT_FULL)) {
+      ArrowFree(slot->data);
+      slot->data = NULL;
+      ArrowIpcBodyPoolSlotRelease(slot, NANOARROW_IPC_BODY_POOL_SLOT_EMPTY);
+    }
+  }
+}
+
+static void ArrowIpcBodyPoolRelease(struct ArrowIpcBodyPool* pool) {
+  if (ArrowIpcBodyPoolUpdate(pool, -1) == 0) {
+    ArrowIpcBodyPoolDrain(pool);
+    ArrowFree(pool);
+  }
+}
+
+static uint8_t* ArrowIpcBodyPoolReallocate(struct ArrowBufferAllocator* allocator,
+                                           uint8_t* ptr, int64_t old_size,
+                                           int64_t new_size) {
+  NANOARROW_UNUSED(old_size);
+  struct ArrowIpcBodyPool* pool = (struct ArrowIpcBodyPool*)allocator->private_data;
+
+  if (ptr != NULL) {
+    return (uint8_t*)ArrowRealloc(ptr, new_size);
+  }
+
+  uint8_t* out = ArrowIpcBodyPoolTake(pool, new_size);
+  if (out == NULL) {
+    out = (uint8_t*)ArrowMalloc(new_size);
+  }
+
+  if (out != NULL) {
+    ArrowIpcBodyPoolUpdate(pool, 1);
+  }
+
+  return out;
+}
+
+static void ArrowIpcBodyPoolFree(struct ArrowBufferAllocator* allocator, uint8_t* ptr,
+                                 int64_t size) {
+  if (ptr == NULL) {
+    return;
+  }
+
+  struct ArrowIpcBodyPool* pool = (struct ArrowIpcBodyPool*)allocator->private_data;
+  ArrowIpcBodyPoolPut(pool, ptr, size);
+  ArrowIpcBodyPoolRelease(pool);
+}
+
+static struct ArrowIpcBodyPool* ArrowIpcBodyPoolCreate(void) {
+  struct ArrowIpcBodyPool* pool =
+      (struct ArrowIpcBodyPool*)ArrowMalloc(sizeof(struct ArrowIpcBodyPool));
+  if (pool == NULL) {
+    return NULL;
+  }
+
+  memset(pool, 0, sizeof(struct ArrowIpcBodyPool));
+  ArrowIpcBodyPoolInitState(pool);
+  return pool;
+}
+
+static struct ArrowBufferAllocator ArrowIpcBodyPoolAllocator(
+    struct ArrowIpcBodyPool* pool) {
+  struct ArrowBufferAllocator allocator;
+  allocator.reallocate = &ArrowIpcBodyPoolReallocate;
+  allocator.free = &ArrowIpcBodyPoolFree;
+  allocator.private_data = pool;
+  return allocator;
+}
+
+// Called when the reader is released: cached buffers are freed immediately and
+// any buffers released afterwards are freed instead of cached.
+static void ArrowIpcBodyPoolClose(struct ArrowIpcBodyPool* pool) {
+  ArrowIpcBodyPoolSetClosed(pool);
+  ArrowIpcBodyPoolDrain(pool);
+  ArrowIpcBodyPoolRelease(pool);
+}
+
 struct ArrowIpcArrayStreamReaderPrivate {
   struct ArrowIpcInputStream input;
   struct ArrowIpcDecoder decoder;
   int use_shared_buffers;
+  enum ArrowIpcHeaderVerification header_verification;
   struct ArrowSchema out_schema;
   int64_t field_index;
   struct ArrowBuffer header;
   struct ArrowBuffer body;
+  struct ArrowIpcBodyPool* body_pool;
   int32_t expected_header_prefix_size;
   struct ArrowError error;
 };
@@ -211,6 +457,10 @@ static void ArrowIpcArrayStreamReaderRelease(struct ArrowArrayStream* stream) {
   ArrowBufferReset(&private_data->header);
   ArrowBufferReset(&private_data->body);
 
+  if (private_data->body_pool != NULL) {
+    ArrowIpcBodyPoolClose(private_data->body_pool);
+  }
+
   ArrowFree(private_data);
   stream->release = NULL;
 }
@@ -224,9 +474,11 @@ static int ArrowIpcArrayStreamReaderNextHeader(
   // Read 8 bytes (continuation + header size in bytes)
   NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowBufferReserve(&private_data->header, 8),
                                      &private_data->error);
+  NANOARROW_TRACE_BEGIN(read_prefix_start);
   NANOARROW_RETURN_NOT_OK(private_data->input.read(&private_data->input,
                                                    private_data->header.data, 8,
                                                    &bytes_read, &private_data->error));
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_READ_INPUT, read_prefix_start, bytes_read);
   private_data->header.size_bytes += bytes_read;
 
   if (bytes_read == 0) {
@@ -309,17 +561,38 @@ static int ArrowIpcArrayStreamReaderNextHeader(
       ArrowBufferReserve(&private_data->header,
                          expected_header_bytes - extra_bytes_already_read),
       &private_data->error);
+  NANOARROW_TRACE_BEGIN(read_header_start);
   NANOARROW_RETURN_NOT_OK(private_data->input.read(
       &private_data->input, private_data->header.data + private_data->header.size_bytes,
       expected_header_bytes - extra_bytes_already_read, &bytes_read,
       &private_data->error));
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_READ_INPUT, read_header_start, bytes_read);
   private_data->header.size_bytes += bytes_read;
 
-  // Verify + decode the header
+  // Verify + decode the header. If verification was skipped for this message, the
+  // decode has to happen first so that the message type and version are populated.
   input_view.data.data = private_data->header.data;
   input_view.size_bytes = private_data->header.size_bytes;
-  NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(&private_data->decoder, input_view,
-                                                      &private_data->error));
+  int verify;
+  switch (private_data->header_verification) {
+    case NANOARROW_IPC_HEADER_VERIFICATION_SCHEMA_ONLY:
+      verify = message_type == NANOARROW_IPC_MESSAGE_TYPE_SCHEMA;
+      break;
+    case NANOARROW_IPC_HEADER_VERIFICATION_NONE:
+      verify = 0;
+      break;
+    default:
+      verify = 1;
+      break;
+  }
+
+  if (verify) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderVerifyHeader(
+        &private_data->decoder, input_view, &private_data->error));
+  } else {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeHeader(
+        &private_data->decoder, input_view, &private_data->error));
+  }
 
   // If we have a 4-byte header prefix, make sure the metadata version is V4
   // (Note that some V4 IPC files have an 8 byte header prefix).
@@ -332,7 +605,7 @@ static int ArrowIpcArrayStreamReaderNextHeader(
 
   // Don't decode the message if it's of the wrong type (because the error message
   // is better communicated by the caller)
-  if (private_data->decoder.message_type != message_type) {
+  if (private_data->decoder.message_type != message_type || !verify) {
     return NANOARROW_OK;
   }
 
@@ -346,13 +619,28 @@ static int ArrowIpcArrayStreamReaderNextBody(
   int64_t bytes_read;
   int64_t bytes_to_read = private_data->decoder.body_size_bytes;
 
+  // If the previous body was handed off to a shared buffer, make sure the next one
+  // is allocated from (and eventually returned to) the body pool
+  if (private_data->body_pool != NULL && private_data->body.data == NULL) {
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowBufferSetAllocator(&private_data->body,
+                                ArrowIpcBodyPoolAllocator(private_data->body_pool)),
+        &private_data->error);
+  }
+
   // Read the body bytes
   private_data->body.size_bytes = 0;
+  NANOARROW_TRACE_BEGIN(allocate_start);
   NANOARROW_RETURN_NOT_OK_WITH_ERROR(
       ArrowBufferReserve(&private_data->body, bytes_to_read), &private_data->error);
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_ALLOCATE_BUFFER, allocate_start,
+                      bytes_to_read);
+
+  NANOARROW_TRACE_BEGIN(read_start);
   NANOARROW_RETURN_NOT_OK(private_data->input.read(&private_data->input,
                                                    private_data->body.data, bytes_to_read,
                                                    &bytes_read, &private_data->error));
+  NANOARROW_TRACE_END(NANOARROW_TRACE_IPC_READ_INPUT, read_start, bytes_read);
   private_data->body.size_bytes += bytes_read;
 
   if (bytes_read != bytes_to_read) {
@@ -466,14 +754,11 @@ static int ArrowIpcArrayStreamReaderGetNext(struct ArrowArrayStream* stream,
   struct ArrowArray tmp;
 
   if (private_data->use_shared_buffers) {
-    struct ArrowIpcSharedBuffer shared;
-    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
-        ArrowIpcSharedBufferInit(&shared, &private_data->body), &private_data->error);
-    result = ArrowIpcDecoderDecodeArrayFromShared(
-        &private_data->decoder, &shared, private_data->field_index, &tmp,
-        NANOARROW_VALIDATION_LEVEL_FULL, &private_data->error);
-    ArrowIpcSharedBufferReset(&shared);
-    NANOARROW_RETURN_NOT_OK(result);
+    // The body was read for this message only, so the decoder can take ownership
+    // (and e.g. swap endianness in place)
+    NANOARROW_RETURN_NOT_OK(ArrowIpcDecoderDecodeArrayFromOwned(
+        &private_data->decoder, &private_data->body, private_data->field_index, &tmp,
+        NANOARROW_VALIDATION_LEVEL_FULL, &private_data->error));
   } else {
     struct ArrowBufferView body_view;
     body_view.data.data = private_data->body.data;
@@ -495,6 +780,13 @@ static const char* ArrowIpcArrayStreamReaderGetLastError(
   return private_data->error.message;
 }
 
+void ArrowIpcArrayStreamReaderOptionsInit(
+    struct ArrowIpcArrayStreamReaderOptions* options) {
+  options->field_index = -1;
+  options->use_shared_buffers = ArrowIpcSharedBufferIsThreadSafe();
+  options->header_verification = NANOARROW_IPC_HEADER_VERIFICATION_ALL;
+}
+
 ArrowErrorCode ArrowIpcArrayStreamReaderInit(
     struct ArrowArrayStream* out, struct ArrowIpcInputStream* input_stream,
     struct ArrowIpcArrayStreamReaderOptions* options) {
@@ -505,8 +797,42 @@ ArrowErrorCode ArrowIpcArrayStreamReaderInit(
     return ENOMEM;
   }
 
+  struct ArrowIpcArrayStreamReaderOptions default_options;
+  if (options == NULL) {
+    ArrowIpcArrayStreamReaderOptionsInit(&default_options);
+    options = &default_options;
+  }
+
+  switch (options->header_verification) {
+    case NANOARROW_IPC_HEADER_VERIFICATION_ALL:
+    case NANOARROW_IPC_HEADER_VERIFICATION_SCHEMA_ONLY:
+    case NANOARROW_IPC_HEADER_VERIFICATION_NONE:
+      break;
+    default:
+      ArrowFree(private_data);
+      return EINVAL;
+  }
+
+  private_data->field_index = options->field_index;
+  private_data->use_shared_buffers = options->use_shared_buffers;
+  private_data->header_verification = options->header_verification;
+
+  // Only shared buffers hand off the body; otherwise the body buffer is reused as-is
+  if (private_data->use_shared_buffers) {
+    private_data->body_pool = ArrowIpcBodyPoolCreate();
+    if (private_data->body_pool == NULL) {
+      ArrowFree(private_data);
+      return ENOMEM;
+    }
+  } else {
+    private_data->body_pool = NULL;
+  }
+
   int result = ArrowIpcDecoderInit(&private_data->decoder);
   if (result != NANOARROW_OK) {
+    if (private_data->body_pool != NULL) {
+      ArrowIpcBodyPoolClose(private_data->body_pool);
+    }
     ArrowFree(private_data);
     return result;
   }
@@ -517,14 +843,6 @@ ArrowErrorCode ArrowIpcArrayStreamReaderInit(
   ArrowIpcInputStreamMove(input_stream, &private_data->input);
   private_data->expected_header_prefix_size = kExpectedHeaderPrefixSizeNotSet;
 
-  if (options != NULL) {
-    private_data->field_index = options->field_index;
-    private_data->use_shared_buffers = options->use_shared_buffers;
-  } else {
-    private_data->field_index = -1;
-    private_data->use_shared_buffers = ArrowIpcSharedBufferIsThreadSafe();
-  }
-
   out->private_data = private_data;
   out->get_schema = &ArrowIpcArrayStreamReaderGetSchema;
   out->get_next = &ArrowIpcArrayStreamReaderGetNext;
@@ -19,6 +19,9 @@
 
 #include <stdio.h>
 
+#include <cstring>
+#include <string>
+
 #include "nanoarrow/nanoarrow_ipc.h"
 
 static uint8_t kSimpleSchema[] = {
@@ -182,6 +185,8 @@ TEST(NanoarrowIpcReader, StreamReaderBasic) {
 
   ASSERT_EQ(ArrowArrayStreamGetSchema(&stream, &schema, nullptr), NANOARROW_OK);
   EXPECT_STREQ(schema.format, "+s");
+  // The caller owns a schema it can modify
+  EXPECT_EQ(ArrowSchemaSetName(&schema, "renamed"), NANOARROW_OK);
   ArrowSchemaRelease(&schema);
 
   struct ArrowArray array;
@@ -198,6 +203,41 @@ TEST(NanoarrowIpcReader, StreamReaderBasic) {
   ArrowArrayStreamRelease(&stream);
 }
 
+#if defined(NANOARROW_ENABLE_TRACING)
+TEST(NanoarrowIpcReader, StreamReaderTracing) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  ASSERT_EQ(
+      ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+      NANOARROW_OK);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, nullptr), NANOARROW_OK);
+
+  ArrowTraceResetStats();
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(&stream, &array, nullptr), NANOARROW_OK);
+  ArrowArrayRelease(&array);
+  ArrowArrayStreamRelease(&stream);
+
+  // One schema message and one record batch message
+  struct ArrowTraceStats stats;
+  ASSERT_EQ(ArrowTraceGetStats(&stats), NANOARROW_OK);
+  EXPECT_EQ(stats.count[NANOARROW_TRACE_IPC_VERIFY_HEADER], 2);
+  EXPECT_EQ(stats.count[NANOARROW_TRACE_IPC_DECODE_HEADER], 2);
+  EXPECT_EQ(stats.bytes[NANOARROW_TRACE_IPC_READ_INPUT],
+            sizeof(kSimpleSchema) + sizeof(kSimpleRecordBatch));
+  EXPECT_GE(stats.count[NANOARROW_TRACE_ARRAY_VIEW_VALIDATE], 1);
+  EXPECT_EQ(stats.count[NANOARROW_TRACE_IPC_DECOMPRESS], 0);
+  EXPECT_EQ(stats.count[NANOARROW_TRACE_IPC_SWAP_ENDIAN], 0);
+}
+#endif
+
 TEST(NanoarrowIpcReader, StreamReaderBasicNoSharedBuffers) {
   struct ArrowBuffer input_buffer;
   ArrowBufferInit(&input_buffer);
@@ -212,6 +252,7 @@ TEST(NanoarrowIpcReader, StreamReaderBasicNoSharedBuffers) {
 
   struct ArrowArrayStream stream;
   struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
   options.field_index = -1;
   options.use_shared_buffers = 0;
   ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
@@ -235,6 +276,190 @@ TEST(NanoarrowIpcReader, StreamReaderBasicNoSharedBuffers) {
   ArrowArrayStreamRelease(&stream);
 }
 
+TEST(NanoarrowIpcReader, StreamReaderSharedBuffersReuseBody) {
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(
+        ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+        NANOARROW_OK);
+  }
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.field_index = -1;
+  options.use_shared_buffers = 1;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  // Once the first batch is released, its body should be recycled for the next
+  // message of the same size
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(&stream, &array, nullptr), NANOARROW_OK);
+  ASSERT_EQ(array.n_children, 1);
+  const void* first_data = array.children[0]->buffers[1];
+  ArrowArrayRelease(&array);
+
+  ASSERT_EQ(ArrowArrayStreamGetNext(&stream, &array, nullptr), NANOARROW_OK);
+  EXPECT_EQ(array.children[0]->buffers[1], first_data);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(array.children[0]->buffers[1])[2], 3);
+
+  // While a batch is still referenced, its body can't be reused
+  struct ArrowArray array2;
+  ASSERT_EQ(ArrowArrayStreamGetNext(&stream, &array2, nullptr), NANOARROW_OK);
+  EXPECT_NE(array2.children[0]->buffers[1], first_data);
+
+  // Arrays may outlive the reader
+  ArrowArrayStreamRelease(&stream);
+  EXPECT_EQ(reinterpret_cast<const int32_t*>(array.children[0]->buffers[1])[2], 3);
+  ArrowArrayRelease(&array);
+  ArrowArrayRelease(&array2);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderOptionsInit) {
+  struct ArrowIpcArrayStreamReaderOptions options;
+  memset(&options, 0xff, sizeof(options));
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  EXPECT_EQ(options.field_index, -1);
+  EXPECT_EQ(options.use_shared_buffers, ArrowIpcSharedBufferIsThreadSafe());
+  EXPECT_EQ(options.header_verification, NANOARROW_IPC_HEADER_VERIFICATION_ALL);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderInvalidHeaderVerification) {
+  for (int verification : {-1, 3}) {
+    SCOPED_TRACE(verification);
+
+    struct ArrowBuffer input_buffer;
+    ArrowBufferInit(&input_buffer);
+    ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+              NANOARROW_OK);
+
+    struct ArrowIpcInputStream input;
+    ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+    struct ArrowArrayStream stream;
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    options.header_verification = static_cast<ArrowIpcHeaderVerification>(verification);
+    EXPECT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), EINVAL);
+
+    // The reader did not take ownership of the input stream
+    input.release(&input);
+  }
+}
+
+TEST(NanoarrowIpcReader, StreamReaderSkipHeaderVerification) {
+  for (auto verification : {NANOARROW_IPC_HEADER_VERIFICATION_SCHEMA_ONLY,
+                            NANOARROW_IPC_HEADER_VERIFICATION_NONE}) {
+    SCOPED_TRACE(static_cast<int>(verification));
+
+    struct ArrowBuffer input_buffer;
+    ArrowBufferInit(&input_buffer);
+    ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+              NANOARROW_OK);
+    ASSERT_EQ(
+        ArrowBufferAppend(&input_buffer, kSimpleRecordBatch, sizeof(kSimpleRecordBatch)),
+        NANOARROW_OK);
+    ASSERT_EQ(ArrowBufferAppend(&input_buffer, kEndOfStream, sizeof(kEndOfStream)),
+              NANOARROW_OK);
+
+    struct ArrowIpcInputStream input;
+    ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+    struct ArrowArrayStream stream;
+    struct ArrowIpcArrayStreamReaderOptions options;
+    ArrowIpcArrayStreamReaderOptionsInit(&options);
+    options.use_shared_buffers = 0;
+    options.header_verification = verification;
+    ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+    struct ArrowSchema schema;
+    ASSERT_EQ(ArrowArrayStreamGetSchema(&stream, &schema, nullptr), NANOARROW_OK);
+    EXPECT_STREQ(schema.format, "+s");
+    ASSERT_EQ(schema.n_children, 1);
+    EXPECT_STREQ(schema.children[0]->format, "i");
+    ArrowSchemaRelease(&schema);
+
+    struct ArrowArray array;
+    ASSERT_EQ(ArrowArrayStreamGetNext(&stream, &array, nullptr), NANOARROW_OK);
+    EXPECT_EQ(array.length, 3);
+    ASSERT_EQ(array.n_children, 1);
+    EXPECT_EQ(reinterpret_cast<const int32_t*>(array.children[0]->buffers[1])[2], 3);
+    ArrowArrayRelease(&array);
+
+    ASSERT_EQ(ArrowArrayStreamGetNext(&stream, &array, nullptr), NANOARROW_OK);
+    EXPECT_EQ(array.release, nullptr);
+
+    ArrowArrayStreamRelease(&stream);
+  }
+}
+
+TEST(NanoarrowIpcReader, StreamReaderSkipHeaderVerificationUnexpectedMessage) {
+  // Even without verification, a message of the wrong type that decodes
+  // successfully should be reported as such
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, kSimpleSchema, sizeof(kSimpleSchema)),
+            NANOARROW_OK);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.header_verification = NANOARROW_IPC_HEADER_VERIFICATION_NONE;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowSchema schema;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowArrayStreamGetSchema(&stream, &schema, &error), NANOARROW_OK);
+  ArrowSchemaRelease(&schema);
+
+  struct ArrowArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(&stream, &array, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Unexpected message type (expected RecordBatch)");
+
+  ArrowArrayStreamRelease(&stream);
+}
+
+TEST(NanoarrowIpcReader, StreamReaderSkipHeaderVerificationDecodeError) {
+  // A stream that starts with an (unsupported) Tensor message: without verification,
+  // the error from decoding the header must be reported rather than the message type
+  uint8_t tensor_message[sizeof(kSimpleSchema)];
+  memcpy(tensor_message, kSimpleSchema, sizeof(kSimpleSchema));
+  ASSERT_EQ(tensor_message[29], 0x01);
+  tensor_message[29] = 0x04;
+
+  struct ArrowBuffer input_buffer;
+  ArrowBufferInit(&input_buffer);
+  ASSERT_EQ(ArrowBufferAppend(&input_buffer, tensor_message, sizeof(tensor_message)),
+            NANOARROW_OK);
+
+  struct ArrowIpcInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(&input, &input_buffer), NANOARROW_OK);
+
+  struct ArrowArrayStream stream;
+  struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
+  options.header_verification = NANOARROW_IPC_HEADER_VERIFICATION_NONE;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
+
+  struct ArrowSchema schema;
+  struct ArrowError error;
+  ASSERT_EQ(ArrowArrayStreamGetSchema(&stream, &schema, &error), ENOTSUP);
+  EXPECT_STREQ(error.message, "Unsupported message type: 'Tensor'");
+
+  ArrowArrayStreamRelease(&stream);
+}
+
 TEST(NanoarrowIpcReader, StreamReaderBasicWithEndOfStream) {
   struct ArrowBuffer input_buffer;
   ArrowBufferInit(&input_buffer);
@@ -434,6 +659,7 @@ TEST(NanoarrowIpcReader, StreamReaderUnsupportedFieldIndex) {
 
   struct ArrowArrayStream stream;
   struct ArrowIpcArrayStreamReaderOptions options;
+  ArrowIpcArrayStreamReaderOptionsInit(&options);
   options.field_index = 0;
   options.use_shared_buffers = 0;
   ASSERT_EQ(ArrowIpcArrayStreamReaderInit(&stream, &input, &options), NANOARROW_OK);
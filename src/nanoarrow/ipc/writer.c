@@ -18,6 +18,7 @@
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include "flatcc/flatcc_builder.h"
 #include "nanoarrow/ipc/flatcc_generated.h"
@@ -181,8 +182,58 @@ struct ArrowIpcWriterPrivate {
   int writing_file;
   int64_t bytes_written;
   struct ArrowIpcFooter footer;
+
+  // Whether a schema has been written and, if coalescing was enabled when it was
+  // written, a copy of it (parsed once into schema_view_tree) and copies of the
+  // batches that have been written but not yet encoded (an array of struct ArrowArray)
+  int schema_written;
+  struct ArrowSchema schema;
+  struct ArrowSchemaViewTree schema_view_tree;
+  int coalesce;
+  struct ArrowIpcWriterCoalesceOptions coalesce_options;
+  struct ArrowBuffer pending;
+  int64_t pending_length;
+  int64_t pending_size_bytes;
+  int64_t pending_since_ms;
 };
 
+static int64_t ArrowIpcWriterNumPending(struct ArrowIpcWriterPrivate* private) {
+  return private->pending.size_bytes / (int64_t)sizeof(struct ArrowArray);
+}
+
+static void ArrowIpcWriterReleasePending(struct ArrowIpcWriterPrivate* private) {
+  struct ArrowArray* pending = (struct ArrowArray*)private->pending.data;
+  for (int64_t i = 0; i < ArrowIpcWriterNumPending(private); i++) {
+    ArrowArrayRelease(pending + i);
+  }
+
+  private->pending.size_bytes = 0;
+  private->pending_length = 0;
+  private->pending_size_bytes = 0;
+}
+
+static void ArrowIpcWriterReleaseSchema(struct ArrowIpcWriterPrivate* private) {
+  if (private->schema.release != NULL) {
+    ArrowSchemaRelease(&private->schema);
+  }
+  ArrowSchemaViewTreeReset(&private->schema_view_tree);
+}
+
+// Only a writer that coalesces needs its own copy of the schema (to concatenate the
+// pending batches), so plain writers never pay for it
+static ArrowErrorCode ArrowIpcWriterCopySchema(struct ArrowIpcWriterPrivate* private,
+                                               const struct ArrowSchema* in,
+                                               struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowSchemaDeepCopy(in, &private->schema), error);
+  ArrowErrorCode result =
+      ArrowSchemaViewTreeInit(&private->schema_view_tree, &private->schema, error);
+  if (result != NANOARROW_OK) {
+    ArrowIpcWriterReleaseSchema(private);
+  }
+
+  return result;
+}
+
 ArrowErrorCode ArrowIpcWriterInit(struct ArrowIpcWriter* writer,
                                   struct ArrowIpcOutputStream* output_stream) {
   NANOARROW_DCHECK(writer != NULL && output_stream != NULL);
@@ -203,6 +254,16 @@ ArrowErrorCode ArrowIpcWriterInit(struct ArrowIpcWriter* writer,
   private->bytes_written = 0;
   ArrowIpcFooterInit(&private->footer);
 
+  private->schema_written = 0;
+  private->schema.release = NULL;
+  memset(&private->schema_view_tree, 0, sizeof(struct ArrowSchemaViewTree));
+  private->coalesce = 0;
+  memset(&private->coalesce_options, 0, sizeof(struct ArrowIpcWriterCoalesceOptions));
+  ArrowBufferInit(&private->pending);
+  private->pending_length = 0;
+  private->pending_size_bytes = 0;
+  private->pending_since_ms = 0;
+
   writer->private_data = private;
   return NANOARROW_OK;
 }
@@ -221,6 +282,11 @@ void ArrowIpcWriterReset(struct ArrowIpcWriter* writer) {
 
     ArrowIpcFooterReset(&private->footer);
 
+    ArrowIpcWriterReleaseSchema(private);
+
+    ArrowIpcWriterReleasePending(private);
+    ArrowBufferReset(&private->pending);
+
     ArrowFree(private);
   }
   memset(writer, 0, sizeof(struct ArrowIpcWriter));
@@ -247,6 +313,63 @@ static struct ArrowBufferView ArrowBufferToBufferView(const struct ArrowBuffer*
 // - exposing internal buffers which have not been completely sent, deferring
 //   follow-up transmission to the caller
 
+static int64_t ArrowIpcWriterNowMillis(void) {
+#if defined(TIME_UTC)
+  struct timespec ts;
+  if (timespec_get(&ts, TIME_UTC) == TIME_UTC) {
+    return (int64_t)ts.tv_sec * 1000 + (int64_t)ts.tv_nsec / 1000000;
+  }
+#endif
+  return (int64_t)time(NULL) * 1000;
+}
+
+// Coalescing keeps a compact copy of each incoming array view (the caller's buffers
+// are only borrowed) and concatenates them into a single batch when flushed.
+static int64_t ArrowIpcWriterPendingSizeBytes(struct ArrowArray* array) {
+  // The copies are always built by nanoarrow, whose private data holds the validity
+  // buffer, at most two more fixed buffers, and any variadic buffers and their sizes
+  // (array->n_buffers counts these but ArrowArrayBuffer() can't reach them)
+  struct ArrowArrayPrivateData* private_data =
+      (struct ArrowArrayPrivateData*)array->private_data;
+  int64_t size_bytes = private_data->bitmap.buffer.size_bytes;
+  for (int i = 0; i < (NANOARROW_MAX_FIXED_BUFFERS - 1); i++) {
+    size_bytes += private_data->buffers[i].size_bytes;
+  }
+
+  for (int32_t i = 0; i < private_data->n_variadic_buffers; i++) {
+    size_bytes += private_data->variadic_buffer_sizes[i];
+  }
+  size_bytes += private_data->n_variadic_buffers * (int64_t)sizeof(int64_t);
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    size_bytes += ArrowIpcWriterPendingSizeBytes(array->children[i]);
+  }
+
+  if (array->dictionary != NULL) {
+    size_bytes += ArrowIpcWriterPendingSizeBytes(array->dictionary);
+  }
+
+  return size_bytes;
+}
+
+// Add a copy of in to the pending batches. On failure, the pending batches are
+// left as they were.
+static ArrowErrorCode ArrowIpcWriterAppendPending(struct ArrowIpcWriterPrivate* private,
+                                                  const struct ArrowArrayView* in,
+                                                  struct ArrowError* error) {
+  NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+      ArrowBufferReserve(&private->pending, sizeof(struct ArrowArray)), error);
+
+  struct ArrowArray copy;
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayConcatenateViews(&private->schema, &in, 1, &copy, error));
+
+  ArrowBufferAppendUnsafe(&private->pending, &copy, sizeof(struct ArrowArray));
+  private->pending_length += copy.length;
+  private->pending_size_bytes += ArrowIpcWriterPendingSizeBytes(&copy);
+  return NANOARROW_OK;
+}
+
 ArrowErrorCode ArrowIpcWriterWriteSchema(struct ArrowIpcWriter* writer,
                                          const struct ArrowSchema* in,
                                          struct ArrowError* error) {
@@ -254,6 +377,9 @@ ArrowErrorCode ArrowIpcWriterWriteSchema(struct ArrowIpcWriter* writer,
   struct ArrowIpcWriterPrivate* private =
       (struct ArrowIpcWriterPrivate*)writer->private_data;
 
+  // Rows buffered for the previous schema are written before it is replaced
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterFlush(writer, error));
+
   NANOARROW_ASSERT_OK(ArrowBufferResize(&private->buffer, 0, 0));
 
   NANOARROW_RETURN_NOT_OK(ArrowIpcEncoderEncodeSchema(&private->encoder, in, error));
@@ -266,26 +392,22 @@ ArrowErrorCode ArrowIpcWriterWriteSchema(struct ArrowIpcWriter* writer,
     NANOARROW_RETURN_NOT_OK_WITH_ERROR(ArrowSchemaDeepCopy(in, &private->footer.schema),
                                        error);
   }
+
+  ArrowIpcWriterReleaseSchema(private);
+  private->schema_written = 1;
+  if (private->coalesce) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcWriterCopySchema(private, in, error));
+  }
+
   private->bytes_written += private->buffer.size_bytes;
 
   return ArrowIpcOutputStreamWrite(&private->output_stream,
                                    ArrowBufferToBufferView(&private->buffer), error);
 }
 
-ArrowErrorCode ArrowIpcWriterWriteArrayView(struct ArrowIpcWriter* writer,
-                                            const struct ArrowArrayView* in,
-                                            struct ArrowError* error) {
-  NANOARROW_DCHECK(writer != NULL && writer->private_data != NULL);
-  struct ArrowIpcWriterPrivate* private =
-      (struct ArrowIpcWriterPrivate*)writer->private_data;
-
-  if (in == NULL) {
-    int32_t eos[] = {-1, 0};
-    private->bytes_written += sizeof(eos);
-    struct ArrowBufferView eos_view = {.data.as_int32 = eos, .size_bytes = sizeof(eos)};
-    return ArrowIpcOutputStreamWrite(&private->output_stream, eos_view, error);
-  }
-
+static ArrowErrorCode ArrowIpcWriterWriteRecordBatch(
+    struct ArrowIpcWriterPrivate* private, const struct ArrowArrayView* in,
+    struct ArrowError* error) {
   NANOARROW_ASSERT_OK(ArrowBufferResize(&private->buffer, 0, 0));
   NANOARROW_ASSERT_OK(ArrowBufferResize(&private->body_buffer, 0, 0));
 
@@ -317,6 +439,193 @@ ArrowErrorCode ArrowIpcWriterWriteArrayView(struct ArrowIpcWriter* writer,
   return NANOARROW_OK;
 }
 
+// Encode the pending batches as a single RecordBatch. On failure, the pending batches
+// are left as they were.
+static ArrowErrorCode ArrowIpcWriterWritePending(struct ArrowIpcWriterPrivate* private,
+                                                 struct ArrowError* error) {
+  int64_t n_pending = ArrowIpcWriterNumPending(private);
+  struct ArrowArray* pending = (struct ArrowArray*)private->pending.data;
+
+  struct ArrowArray combined;
+  combined.release = NULL;
+  struct ArrowArray* to_write = pending;
+  if (n_pending > 1) {
+    struct ArrowBuffer arrays;
+    ArrowBufferInit(&arrays);
+    NANOARROW_RETURN_NOT_OK_WITH_ERROR(
+        ArrowBufferReserve(&arrays, n_pending * sizeof(struct ArrowArray*)), error);
+    for (int64_t i = 0; i < n_pending; i++) {
+      struct ArrowArray* array = pending + i;
+      ArrowBufferAppendUnsafe(&arrays, &array, sizeof(struct ArrowArray*));
+    }
+
+    ArrowErrorCode result =
+        ArrowArrayConcatenate(&private->schema, (struct ArrowArray**)arrays.data,
+                              n_pending, &combined, error);
+    ArrowBufferReset(&arrays);
+    NANOARROW_RETURN_NOT_OK(result);
+    to_write = &combined;
+  }
+
+  struct ArrowArrayView array_view;
+  ArrowErrorCode result = ArrowArrayViewInitFromSchemaViewTree(
+      &array_view, &private->schema_view_tree, error);
+  if (result == NANOARROW_OK) {
+    result = ArrowArrayViewSetArray(&array_view, to_write, error);
+  }
+
+  if (result == NANOARROW_OK) {
+    result = ArrowIpcWriterWriteRecordBatch(private, &array_view, error);
+  }
+
+  ArrowArrayViewReset(&array_view);
+  if (combined.release != NULL) {
+    ArrowArrayRelease(&combined);
+  }
+  NANOARROW_RETURN_NOT_OK(result);
+
+  ArrowIpcWriterReleasePending(private);
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcWriterFlush(struct ArrowIpcWriter* writer,
+                                   struct ArrowError* error) {
+  NANOARROW_DCHECK(writer != NULL && writer->private_data != NULL);
+  struct ArrowIpcWriterPrivate* private =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  if (ArrowIpcWriterNumPending(private) == 0) {
+    return NANOARROW_OK;
+  }
+
+  return ArrowIpcWriterWritePending(private, error);
+}
+
+ArrowErrorCode ArrowIpcWriterSetCoalesceOptions(
+    struct ArrowIpcWriter* writer, const struct ArrowIpcWriterCoalesceOptions* options,
+    struct ArrowError* error) {
+  NANOARROW_DCHECK(writer != NULL && writer->private_data != NULL);
+  struct ArrowIpcWriterPrivate* private =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  // Rows buffered under the previous options are written before anything changes
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterFlush(writer, error));
+
+  if (options == NULL) {
+    private->coalesce = 0;
+    return NANOARROW_OK;
+  }
+
+  if (options->target_rows < 0 || options->target_bytes < 0 ||
+      options->max_latency_ms < 0) {
+    ArrowErrorSet(error, "Coalesce options must be non-negative");
+    return EINVAL;
+  }
+
+  // The schema is only copied while coalescing. A file writer keeps one for the
+  // footer, but a stream writer can't recover a schema written without it.
+  if (private->schema_written && private->schema.release == NULL) {
+    if (private->footer.schema.release == NULL) {
+      ArrowErrorSet(error,
+                    "Can't enable coalescing after a schema was written without it");
+      return EINVAL;
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        ArrowIpcWriterCopySchema(private, &private->footer.schema, error));
+  }
+
+  private->coalesce = 1;
+  private->coalesce_options = *options;
+  return NANOARROW_OK;
+}
+
+ArrowErrorCode ArrowIpcWriterWriteArrayView(struct ArrowIpcWriter* writer,
+                                            const struct ArrowArrayView* in,
+                                            struct ArrowError* error) {
+  NANOARROW_DCHECK(writer != NULL && writer->private_data != NULL);
+  struct ArrowIpcWriterPrivate* private =
+      (struct ArrowIpcWriterPrivate*)writer->private_data;
+
+  if (in == NULL) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcWriterFlush(writer, error));
+
+    int32_t eos[] = {-1, 0};
+    private->bytes_written += sizeof(eos);
+    struct ArrowBufferView eos_view = {.data.as_int32 = eos, .size_bytes = sizeof(eos)};
+    return ArrowIpcOutputStreamWrite(&private->output_stream, eos_view, error);
+  }
+
+  if (!private->coalesce) {
+    return ArrowIpcWriterWriteRecordBatch(private, in, error);
+  }
+
+  if (!private->schema_written) {
+    ArrowErrorSet(error, "Can't coalesce record batches before a schema is written");
+    return EINVAL;
+  }
+
+  const struct ArrowIpcWriterCoalesceOptions* options = &private->coalesce_options;
+  if (private->pending_length == 0 && options->max_latency_ms > 0) {
+    private->pending_since_ms = ArrowIpcWriterNowMillis();
+  }
+
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterAppendPending(private, in, error));
+
+  int flush = 0;
+  if (options->target_rows > 0 && private->pending_length >= options->target_rows) {
+    flush = 1;
+  } else if (options->target_bytes > 0 &&
+             private->pending_size_bytes >= options->target_bytes) {
+    flush = 1;
+  } else if (options->max_latency_ms > 0 &&
+             (ArrowIpcWriterNowMillis() - private->pending_since_ms) >=
+                 options->max_latency_ms) {
+    flush = 1;
+  }
+
+  if (flush) {
+    NANOARROW_RETURN_NOT_OK(ArrowIpcWriterFlush(writer, error));
+  }
+
+  return NANOARROW_OK;
+}
+
+// The encoder requires every node to have a zero offset, which is not the case for
+// arrays that were sliced (e.g., by ArrowRechunkArrayStreamInit())
+static int ArrowIpcArrayViewHasOffset(const struct ArrowArrayView* array_view) {
+  if (array_view->offset != 0) {
+    return 1;
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    if (ArrowIpcArrayViewHasOffset(array_view->children[i])) {
+      return 1;
+    }
+  }
+
+  if (array_view->dictionary != NULL) {
+    return ArrowIpcArrayViewHasOffset(array_view->dictionary);
+  }
+
+  return 0;
+}
+
+// Replace array (and the array_view pointing to it) with a compact copy whose nodes
+// all have a zero offset
+static ArrowErrorCode ArrowIpcWriterRemoveOffset(struct ArrowSchema* schema,
+                                                 struct ArrowArray* array,
+                                                 struct ArrowArrayView* array_view,
+                                                 struct ArrowError* error) {
+  struct ArrowArray compact;
+  const struct ArrowArrayView* array_views[] = {array_view};
+  NANOARROW_RETURN_NOT_OK(
+      ArrowArrayConcatenateViews(schema, array_views, 1, &compact, error));
+  ArrowArrayRelease(array);
+  ArrowArrayMove(&compact, array);
+  return ArrowArrayViewSetArray(array_view, array, error);
+}
+
 static ArrowErrorCode ArrowIpcWriterWriteArrayStreamImpl(
     struct ArrowIpcWriter* writer, struct ArrowArrayStream* in,
     struct ArrowSchema* schema, struct ArrowArray* array,
@@ -332,6 +641,11 @@ static ArrowErrorCode ArrowIpcWriterWriteArrayStreamImpl(
     }
 
     NANOARROW_RETURN_NOT_OK(ArrowArrayViewSetArray(array_view, array, error));
+    if (ArrowIpcArrayViewHasOffset(array_view)) {
+      NANOARROW_RETURN_NOT_OK(
+          ArrowIpcWriterRemoveOffset(schema, array, array_view, error));
+    }
+
     NANOARROW_RETURN_NOT_OK(ArrowIpcWriterWriteArrayView(writer, array_view, error));
     ArrowArrayRelease(array);
   }
@@ -398,6 +712,8 @@ ArrowErrorCode ArrowIpcWriterFinalizeFile(struct ArrowIpcWriter* writer,
 
   NANOARROW_DCHECK(private->writing_file);
 
+  NANOARROW_RETURN_NOT_OK(ArrowIpcWriterFlush(writer, error));
+
   NANOARROW_ASSERT_OK(ArrowBufferResize(&private->buffer, 0, 0));
   NANOARROW_RETURN_NOT_OK(
       ArrowIpcEncoderEncodeFooter(&private->encoder, &private->footer, error));
@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 
 #include <stdio.h>
+#include <string>
+#include <vector>
 
 #include "nanoarrow/nanoarrow_ipc.hpp"
 
@@ -126,8 +128,31 @@ struct ArrowIpcWriterPrivate {
   int writing_file;
   int64_t bytes_written;
   struct ArrowIpcFooter footer;
+
+  int schema_written;
+  struct ArrowSchema schema;
+  struct ArrowSchemaViewTree schema_view_tree;
+  int coalesce;
+  struct ArrowIpcWriterCoalesceOptions coalesce_options;
+  struct ArrowBuffer pending;
+  int64_t pending_length;
+  int64_t pending_size_bytes;
+  int64_t pending_since_ms;
 };
 
+static int64_t ArrayViewSizeBytes(struct ArrowArrayView* array_view) {
+  int64_t size_bytes = 0;
+  for (int64_t i = 0; i < ArrowArrayViewGetNumBuffers(array_view); i++) {
+    size_bytes += ArrowArrayViewGetBufferView(array_view, i).size_bytes;
+  }
+
+  for (int64_t i = 0; i < array_view->n_children; i++) {
+    size_bytes += ArrayViewSizeBytes(array_view->children[i]);
+  }
+
+  return size_bytes;
+}
+
 #define NANOARROW_IPC_FILE_PADDED_MAGIC "ARROW1\0"
 
 TEST(NanoarrowIpcWriter, FileWriting) {
@@ -204,3 +229,489 @@ TEST(NanoarrowIpcWriter, FileWriting) {
   auto after_footer = p->bytes_written;
   EXPECT_GT(after_footer, after_eos);
 }
+
+static void MakeCoalesceSchema(struct ArrowSchema* schema) {
+  ASSERT_EQ(ArrowSchemaInitFromType(schema, NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema, 3), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "i"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[1], NANOARROW_TYPE_STRING),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[1], "s"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[2], NANOARROW_TYPE_LIST),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[2], "l"), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetType(schema->children[2]->children[0], NANOARROW_TYPE_INT32),
+            NANOARROW_OK);
+}
+
+// Rows are numbered across batches so that the coalesced output can be checked
+// against the row number alone
+static void MakeCoalesceBatch(struct ArrowSchema* schema, int64_t first_row,
+                              int64_t num_rows, struct ArrowArray* array) {
+  ASSERT_EQ(ArrowArrayInitFromSchema(array, schema, nullptr), NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayStartAppending(array), NANOARROW_OK);
+  for (int64_t row = first_row; row < (first_row + num_rows); row++) {
+    if (row % 4 == 0) {
+      ASSERT_EQ(ArrowArrayAppendNull(array->children[0], 1), NANOARROW_OK);
+    } else {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[0], row), NANOARROW_OK);
+    }
+
+    std::string value = "row" + std::to_string(row);
+    ASSERT_EQ(ArrowArrayAppendString(array->children[1], ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+
+    for (int64_t i = 0; i < (row % 3); i++) {
+      ASSERT_EQ(ArrowArrayAppendInt(array->children[2]->children[0], row + i),
+                NANOARROW_OK);
+    }
+    ASSERT_EQ(ArrowArrayFinishElement(array->children[2]), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array), NANOARROW_OK);
+  }
+  ASSERT_EQ(ArrowArrayFinishBuildingDefault(array, nullptr), NANOARROW_OK);
+}
+
+static void WriteCoalesceBatch(struct ArrowIpcWriter* writer, struct ArrowSchema* schema,
+                               int64_t first_row, int64_t num_rows) {
+  nanoarrow::UniqueArray array;
+  MakeCoalesceBatch(schema, first_row, num_rows, array.get());
+
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema, nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+
+  struct ArrowError error;
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(writer, array_view.get(), &error), NANOARROW_OK)
+      << error.message;
+}
+
+static void ReadCoalescedBatches(struct ArrowBuffer* output,
+                                 std::vector<int64_t>* batch_lengths) {
+  nanoarrow::ipc::UniqueInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(input.get(), output), NANOARROW_OK);
+
+  nanoarrow::UniqueArrayStream stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(stream.get(), input.get(), nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowArrayStreamGetSchema(stream.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+
+  int64_t row = 0;
+  while (true) {
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayStreamGetNext(stream.get(), array.get(), nullptr), NANOARROW_OK);
+    if (array->release == nullptr) {
+      break;
+    }
+
+    batch_lengths->push_back(array->length);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+              NANOARROW_OK);
+    struct ArrowArrayView* ints = array_view->children[0];
+    struct ArrowArrayView* strings = array_view->children[1];
+    struct ArrowArrayView* lists = array_view->children[2];
+    for (int64_t i = 0; i < array->length; i++, row++) {
+      if (row % 4 == 0) {
+        EXPECT_TRUE(ArrowArrayViewIsNull(ints, i));
+      } else {
+        EXPECT_FALSE(ArrowArrayViewIsNull(ints, i));
+        EXPECT_EQ(ArrowArrayViewGetIntUnsafe(ints, i), row);
+      }
+
+      struct ArrowStringView value = ArrowArrayViewGetStringUnsafe(strings, i);
+      EXPECT_EQ(std::string(value.data, value.size_bytes), "row" + std::to_string(row));
+
+      int64_t list_start = ArrowArrayViewListChildOffset(lists, i);
+      int64_t list_end = ArrowArrayViewListChildOffset(lists, i + 1);
+      ASSERT_EQ(list_end - list_start, row % 3);
+      for (int64_t j = list_start; j < list_end; j++) {
+        EXPECT_EQ(ArrowArrayViewGetIntUnsafe(lists->children[0], j),
+                  row + (j - list_start));
+      }
+    }
+  }
+}
+
+TEST(NanoarrowIpcWriter, CoalesceTargetRows) {
+  struct ArrowError error;
+
+  nanoarrow::UniqueBuffer output;
+  nanoarrow::ipc::UniqueOutputStream stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(stream.get(), output.get()), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), stream.get()), NANOARROW_OK);
+
+  struct ArrowIpcWriterCoalesceOptions options;
+  options.target_rows = 10;
+  options.target_bytes = 0;
+  options.max_latency_ms = 0;
+  ASSERT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), &options, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueSchema schema;
+  MakeCoalesceSchema(schema.get());
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(writer.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+
+  // Five batches of three rows: the fourth batch crosses the target and the
+  // last three rows are flushed by the end of stream
+  int64_t size_after_schema = output->size_bytes;
+  for (int64_t i = 0; i < 5; i++) {
+    WriteCoalesceBatch(writer.get(), schema.get(), i * 3, 3);
+    if (i < 3) {
+      EXPECT_EQ(output->size_bytes, size_after_schema);
+    }
+  }
+  EXPECT_GT(output->size_bytes, size_after_schema);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(writer.get(), nullptr, &error), NANOARROW_OK)
+      << error.message;
+
+  std::vector<int64_t> batch_lengths;
+  ReadCoalescedBatches(output.get(), &batch_lengths);
+  EXPECT_EQ(batch_lengths, std::vector<int64_t>({12, 3}));
+}
+
+TEST(NanoarrowIpcWriter, CoalesceTargetBytesAndFlush) {
+  struct ArrowError error;
+
+  nanoarrow::UniqueBuffer output;
+  nanoarrow::ipc::UniqueOutputStream stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(stream.get(), output.get()), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), stream.get()), NANOARROW_OK);
+
+  struct ArrowIpcWriterCoalesceOptions options;
+  options.target_rows = 0;
+  options.target_bytes = 1024 * 1024;
+  options.max_latency_ms = 0;
+  ASSERT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), &options, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueSchema schema;
+  MakeCoalesceSchema(schema.get());
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(writer.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+
+  // Nothing reaches the target, so batches are only written on explicit flush
+  WriteCoalesceBatch(writer.get(), schema.get(), 0, 2);
+  WriteCoalesceBatch(writer.get(), schema.get(), 2, 5);
+  ASSERT_EQ(ArrowIpcWriterFlush(writer.get(), &error), NANOARROW_OK) << error.message;
+  // ...and flushing with nothing pending is a no-op
+  ASSERT_EQ(ArrowIpcWriterFlush(writer.get(), &error), NANOARROW_OK) << error.message;
+  WriteCoalesceBatch(writer.get(), schema.get(), 7, 1);
+
+  // Disabling coalescing writes the pending rows first
+  ASSERT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), nullptr, &error),
+            NANOARROW_OK)
+      << error.message;
+  WriteCoalesceBatch(writer.get(), schema.get(), 8, 2);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(writer.get(), nullptr, &error), NANOARROW_OK)
+      << error.message;
+
+  std::vector<int64_t> batch_lengths;
+  ReadCoalescedBatches(output.get(), &batch_lengths);
+  EXPECT_EQ(batch_lengths, std::vector<int64_t>({7, 1, 2}));
+}
+
+TEST(NanoarrowIpcWriter, CoalesceOptionsValidation) {
+  struct ArrowError error;
+
+  nanoarrow::UniqueBuffer output;
+  nanoarrow::ipc::UniqueOutputStream stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(stream.get(), output.get()), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), stream.get()), NANOARROW_OK);
+
+  struct ArrowIpcWriterCoalesceOptions options;
+  options.target_rows = 0;
+  options.target_bytes = 0;
+  options.max_latency_ms = -1;
+  EXPECT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), &options, &error), EINVAL);
+  EXPECT_STREQ(error.message, "Coalesce options must be non-negative");
+
+  options.max_latency_ms = 0;
+  ASSERT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), &options, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  // Batches can't be buffered until there is a schema to concatenate them with
+  nanoarrow::UniqueSchema schema;
+  MakeCoalesceSchema(schema.get());
+  nanoarrow::UniqueArray array;
+  MakeCoalesceBatch(schema.get(), 0, 1, array.get());
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr), NANOARROW_OK);
+  EXPECT_EQ(ArrowIpcWriterWriteArrayView(writer.get(), array_view.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Can't coalesce record batches before a schema is written");
+  EXPECT_EQ(output->size_bytes, 0);
+
+  // A stream writer doesn't keep the schema unless coalescing was already enabled
+  nanoarrow::ipc::UniqueWriter plain_writer;
+  nanoarrow::ipc::UniqueOutputStream plain_stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(plain_stream.get(), output.get()),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterInit(plain_writer.get(), plain_stream.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(plain_writer.get(), schema.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(ArrowIpcWriterSetCoalesceOptions(plain_writer.get(), &options, &error),
+            EINVAL);
+  EXPECT_STREQ(error.message,
+               "Can't enable coalescing after a schema was written without it");
+}
+
+TEST(NanoarrowIpcWriter, CoalesceViewType) {
+  struct ArrowError error;
+
+  nanoarrow::UniqueBuffer output;
+  nanoarrow::ipc::UniqueOutputStream stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(stream.get(), output.get()), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), stream.get()), NANOARROW_OK);
+
+  struct ArrowIpcWriterCoalesceOptions options;
+  options.target_rows = 0;
+  options.target_bytes = 0;
+  options.max_latency_ms = 0;
+  ASSERT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), &options, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueSchema schema;
+  ASSERT_EQ(ArrowSchemaInitFromType(schema.get(), NANOARROW_TYPE_STRUCT), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaAllocateChildren(schema.get(), 1), NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaInitFromType(schema->children[0], NANOARROW_TYPE_STRING_VIEW),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowSchemaSetName(schema->children[0], "col"), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(writer.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+
+  // Long values live in variadic buffers, which must be carried over by the copy
+  // and counted towards the pending size
+  auto* p = static_cast<struct ArrowIpcWriterPrivate*>(writer->private_data);
+  int64_t expected_size_bytes = 0;
+  std::vector<std::string> values = {"short", "a value that is too long to inline",
+                                     "another value that is too long to inline"};
+  for (const auto& value : values) {
+    nanoarrow::UniqueArray array;
+    ASSERT_EQ(ArrowArrayInitFromSchema(array.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayStartAppending(array.get()), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayAppendString(array->children[0], ArrowCharView(value.c_str())),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishElement(array.get()), NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayFinishBuildingDefault(array.get(), nullptr), NANOARROW_OK);
+
+    nanoarrow::UniqueArrayView array_view;
+    ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), nullptr),
+              NANOARROW_OK);
+    ASSERT_EQ(ArrowIpcWriterWriteArrayView(writer.get(), array_view.get(), &error),
+              NANOARROW_OK)
+        << error.message;
+
+    expected_size_bytes += ArrayViewSizeBytes(array_view.get());
+    EXPECT_EQ(p->pending_size_bytes, expected_size_bytes);
+  }
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(writer.get(), nullptr, &error), NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::ipc::UniqueInputStream input;
+  ASSERT_EQ(ArrowIpcInputStreamInitBuffer(input.get(), output.get()), NANOARROW_OK);
+  nanoarrow::UniqueArrayStream array_stream;
+  ASSERT_EQ(ArrowIpcArrayStreamReaderInit(array_stream.get(), input.get(), nullptr),
+            NANOARROW_OK);
+
+  nanoarrow::UniqueArray array;
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(array->length, 3);
+  nanoarrow::UniqueArrayView array_view;
+  ASSERT_EQ(ArrowArrayViewInitFromSchema(array_view.get(), schema.get(), nullptr),
+            NANOARROW_OK);
+  ASSERT_EQ(ArrowArrayViewSetArray(array_view.get(), array.get(), &error), NANOARROW_OK)
+      << error.message;
+  for (int64_t i = 0; i < 3; i++) {
+    struct ArrowStringView value =
+        ArrowArrayViewGetStringUnsafe(array_view->children[0], i);
+    EXPECT_EQ(std::string(value.data, value.size_bytes), values[i]);
+  }
+
+  array.reset();
+  ASSERT_EQ(ArrowArrayStreamGetNext(array_stream.get(), array.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(array->release, nullptr);
+}
+
+TEST(NanoarrowIpcWriter, CoalesceWriteSchemaFlushes) {
+  struct ArrowError error;
+
+  nanoarrow::UniqueBuffer output;
+  nanoarrow::ipc::UniqueOutputStream stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(stream.get(), output.get()), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), stream.get()), NANOARROW_OK);
+
+  struct ArrowIpcWriterCoalesceOptions options;
+  options.target_rows = 0;
+  options.target_bytes = 0;
+  options.max_latency_ms = 0;
+  ASSERT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), &options, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueSchema schema;
+  MakeCoalesceSchema(schema.get());
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(writer.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+  int64_t schema_size = output->size_bytes;
+
+  WriteCoalesceBatch(writer.get(), schema.get(), 0, 4);
+  EXPECT_EQ(output->size_bytes, schema_size);
+
+  // Writing a schema again must not drop the rows buffered for the previous one
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(writer.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_GT(output->size_bytes, 2 * schema_size);
+
+  // Only read the first schema and batch
+  output->size_bytes -= schema_size;
+  int32_t eos[] = {-1, 0};
+  ASSERT_EQ(ArrowBufferAppend(output.get(), eos, sizeof(eos)), NANOARROW_OK);
+  std::vector<int64_t> batch_lengths;
+  ReadCoalescedBatches(output.get(), &batch_lengths);
+  EXPECT_EQ(batch_lengths, std::vector<int64_t>({4}));
+}
+
+// An output stream that appends to a buffer unless it has been asked to fail
+struct FailingOutputStreamPrivate {
+  struct ArrowBuffer* output;
+  int fail;
+};
+
+static ArrowErrorCode FailingOutputStreamWrite(struct ArrowIpcOutputStream* stream,
+                                               const void* buf, int64_t buf_size_bytes,
+                                               int64_t* size_written_out,
+                                               struct ArrowError* error) {
+  auto* private_data = static_cast<FailingOutputStreamPrivate*>(stream->private_data);
+  if (private_data->fail) {
+    ArrowErrorSet(error, "Write failed");
+    return EIO;
+  }
+
+  *size_written_out = buf_size_bytes;
+  return ArrowBufferAppend(private_data->output, buf, buf_size_bytes);
+}
+
+static void FailingOutputStreamRelease(struct ArrowIpcOutputStream* stream) {
+  stream->release = nullptr;
+}
+
+TEST(NanoarrowIpcWriter, CoalesceFailedFlushKeepsPending) {
+  struct ArrowError error;
+
+  nanoarrow::UniqueBuffer output;
+  FailingOutputStreamPrivate private_data{output.get(), 0};
+  nanoarrow::ipc::UniqueOutputStream stream;
+  stream->write = &FailingOutputStreamWrite;
+  stream->release = &FailingOutputStreamRelease;
+  stream->private_data = &private_data;
+
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), stream.get()), NANOARROW_OK);
+
+  struct ArrowIpcWriterCoalesceOptions options;
+  options.target_rows = 0;
+  options.target_bytes = 0;
+  options.max_latency_ms = 0;
+  ASSERT_EQ(ArrowIpcWriterSetCoalesceOptions(writer.get(), &options, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueSchema schema;
+  MakeCoalesceSchema(schema.get());
+  ASSERT_EQ(ArrowIpcWriterWriteSchema(writer.get(), schema.get(), &error), NANOARROW_OK)
+      << error.message;
+  WriteCoalesceBatch(writer.get(), schema.get(), 0, 3);
+  WriteCoalesceBatch(writer.get(), schema.get(), 3, 2);
+
+  private_data.fail = 1;
+  int64_t size_before_flush = output->size_bytes;
+  EXPECT_EQ(ArrowIpcWriterFlush(writer.get(), &error), EIO);
+  EXPECT_STREQ(error.message, "Write failed");
+  EXPECT_EQ(output->size_bytes, size_before_flush);
+
+  // The rows are still pending and are written once the stream recovers
+  private_data.fail = 0;
+  WriteCoalesceBatch(writer.get(), schema.get(), 5, 1);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayView(writer.get(), nullptr, &error), NANOARROW_OK)
+      << error.message;
+
+  std::vector<int64_t> batch_lengths;
+  ReadCoalescedBatches(output.get(), &batch_lengths);
+  EXPECT_EQ(batch_lengths, std::vector<int64_t>({6}));
+}
+
+TEST(NanoarrowIpcWriter, WriteRechunkedArrayStream) {
+  struct ArrowError error;
+
+  nanoarrow::UniqueSchema schema;
+  MakeCoalesceSchema(schema.get());
+
+  // Rechunking splits the large batch into slices with nonzero offsets, which the
+  // IPC writer copies before encoding them
+  std::vector<int64_t> lengths = {3, 25, 2, 0, 7};
+  nanoarrow::UniqueArrayStream src;
+  ASSERT_EQ(ArrowBasicArrayStreamInit(src.get(), schema.get(),
+                                      static_cast<int64_t>(lengths.size())),
+            NANOARROW_OK);
+
+  // The stream took ownership of schema
+  MakeCoalesceSchema(schema.get());
+  int64_t first_row = 0;
+  for (size_t i = 0; i < lengths.size(); i++) {
+    nanoarrow::UniqueArray array;
+    MakeCoalesceBatch(schema.get(), first_row, lengths[i], array.get());
+    ArrowBasicArrayStreamSetArray(src.get(), static_cast<int64_t>(i), array.get());
+    first_row += lengths[i];
+  }
+
+  nanoarrow::UniqueArrayStream rechunked;
+  ASSERT_EQ(ArrowRechunkArrayStreamInit(rechunked.get(), src.get(), 10, 0, &error),
+            NANOARROW_OK)
+      << error.message;
+
+  nanoarrow::UniqueBuffer output;
+  nanoarrow::ipc::UniqueOutputStream stream;
+  ASSERT_EQ(ArrowIpcOutputStreamInitBuffer(stream.get(), output.get()), NANOARROW_OK);
+
+  nanoarrow::ipc::UniqueWriter writer;
+  ASSERT_EQ(ArrowIpcWriterInit(writer.get(), stream.get()), NANOARROW_OK);
+  ASSERT_EQ(ArrowIpcWriterWriteArrayStream(writer.get(), rechunked.get(), &error),
+            NANOARROW_OK)
+      << error.message;
+
+  std::vector<int64_t> batch_lengths;
+  ReadCoalescedBatches(output.get(), &batch_lengths);
+  EXPECT_EQ(batch_lengths, std::vector<int64_t>({10, 10, 10, 7}));
+}
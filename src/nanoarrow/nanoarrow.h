@@ -45,13 +45,27 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferAllocatorDefault)
 #define ArrowBufferDeallocator \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBufferDeallocator)
+#define ArrowHalfFloatToFloatN \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowHalfFloatToFloatN)
+#define ArrowFloatToHalfFloatN \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowFloatToHalfFloatN)
 #define ArrowErrorSet NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowErrorSet)
+#define ArrowTraceEventName NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTraceEventName)
+#define ArrowTraceNowNs NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTraceNowNs)
+#define ArrowTraceRecord NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTraceRecord)
+#define ArrowTraceGetStats NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTraceGetStats)
+#define ArrowTraceResetStats NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTraceResetStats)
+#define ArrowTraceSetCallback NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowTraceSetCallback)
 #define ArrowLayoutInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowLayoutInit)
 #define ArrowDecimalSetDigits NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDecimalSetDigits)
 #define ArrowDecimalAppendDigitsToBuffer \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDecimalAppendDigitsToBuffer)
 #define ArrowDecimalAppendStringToBuffer \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDecimalAppendStringToBuffer)
+#define ArrowArrayViewDecimalToStrings \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewDecimalToStrings)
+#define ArrowArrayAppendDecimalFromStrings \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayAppendDecimalFromStrings)
 #define ArrowSchemaInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaInit)
 #define ArrowSchemaInitFromType \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaInitFromType)
@@ -69,6 +83,9 @@
 #define ArrowSchemaSetTypeUnion \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetTypeUnion)
 #define ArrowSchemaDeepCopy NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaDeepCopy)
+#define ArrowSchemaCompact NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaCompact)
+#define ArrowSchemaHash NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaHash)
+#define ArrowSchemaEquals NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaEquals)
 #define ArrowSchemaSetFormat NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetFormat)
 #define ArrowSchemaSetName NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaSetName)
 #define ArrowSchemaSetMetadata \
@@ -84,6 +101,14 @@
 #define ArrowMetadataSizeOf NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataSizeOf)
 #define ArrowMetadataHasKey NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataHasKey)
 #define ArrowMetadataGetValue NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataGetValue)
+#define ArrowMetadataIndexInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexInit)
+#define ArrowMetadataIndexFind \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexFind)
+#define ArrowMetadataIndexGetValue \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexGetValue)
+#define ArrowMetadataIndexReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataIndexReset)
 #define ArrowMetadataBuilderInit \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataBuilderInit)
 #define ArrowMetadataBuilderAppend \
@@ -93,6 +118,10 @@
 #define ArrowMetadataBuilderRemove \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowMetadataBuilderRemove)
 #define ArrowSchemaViewInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaViewInit)
+#define ArrowSchemaViewTreeInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaViewTreeInit)
+#define ArrowSchemaViewTreeReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaViewTreeReset)
 #define ArrowSchemaToString NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowSchemaToString)
 #define ArrowArrayInitFromType \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayInitFromType)
@@ -118,6 +147,8 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewInitFromType)
 #define ArrowArrayViewInitFromSchema \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewInitFromSchema)
+#define ArrowArrayViewInitFromSchemaViewTree \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewInitFromSchemaViewTree)
 #define ArrowArrayViewAllocateChildren \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewAllocateChildren)
 #define ArrowArrayViewAllocateDictionary \
@@ -131,6 +162,27 @@
 #define ArrowArrayViewValidate \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewValidate)
 #define ArrowArrayViewCompare NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewCompare)
+#define ArrowArraySlice NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArraySlice)
+#define ArrowArrayIsShared NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayIsShared)
+#define ArrowArrayConcatenate NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayConcatenate)
+#define ArrowArrayConcatenateViews \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayConcatenateViews)
+#define ArrowArrayTake NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayTake)
+#define ArrowArrayFilter NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayFilter)
+#define ArrowArrayDictionaryDecode \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayDictionaryDecode)
+#define ArrowDictionaryBuilderInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderInit)
+#define ArrowDictionaryBuilderAppendString \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendString)
+#define ArrowDictionaryBuilderAppendNull \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendNull)
+#define ArrowDictionaryBuilderAppendArrayView \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderAppendArrayView)
+#define ArrowDictionaryBuilderFinish \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderFinish)
+#define ArrowDictionaryBuilderReset \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowDictionaryBuilderReset)
 #define ArrowArrayViewReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowArrayViewReset)
 #define ArrowBasicArrayStreamInit \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBasicArrayStreamInit)
@@ -138,6 +190,8 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBasicArrayStreamSetArray)
 #define ArrowBasicArrayStreamValidate \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowBasicArrayStreamValidate)
+#define ArrowRechunkArrayStreamInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowRechunkArrayStreamInit)
 
 #endif
 
@@ -284,6 +338,56 @@ NANOARROW_DLL NANOARROW_CHECK_PRINTF_ATTRIBUTE int ArrowErrorSet(struct ArrowErr
 
 /// @}
 
+/// \defgroup nanoarrow-tracing Hot path instrumentation
+///
+/// When nanoarrow is built with NANOARROW_ENABLE_TRACING defined (e.g., by
+/// configuring with -DNANOARROW_ENABLE_TRACING=ON), array building, validation,
+/// and the IPC reader, decoder, and encoder record the wall time and number of
+/// bytes processed at each point described by enum ArrowTraceEvent. Without
+/// this definition the instrumentation compiles to nothing.
+///
+/// Accumulated statistics are global to the process and are updated atomically
+/// when nanoarrow is compiled with C11 atomics.
+///
+/// @{
+
+/// \brief Return a human-readable name for an ArrowTraceEvent
+///
+/// Returns NULL for invalid values for event.
+NANOARROW_DLL const char* ArrowTraceEventName(enum ArrowTraceEvent event);
+
+/// \brief Return a monotonic timestamp in nanoseconds
+///
+/// Returns 0 if nanoarrow was not built with NANOARROW_ENABLE_TRACING.
+NANOARROW_DLL int64_t ArrowTraceNowNs(void);
+
+/// \brief Accumulate a recorded event and invoke the callback, if set
+///
+/// This is usually called via NANOARROW_TRACE_END() and has no effect if
+/// nanoarrow was not built with NANOARROW_ENABLE_TRACING.
+NANOARROW_DLL void ArrowTraceRecord(enum ArrowTraceEvent event, int64_t elapsed_ns,
+                                    int64_t bytes);
+
+/// \brief Copy the statistics accumulated since the last reset into out
+///
+/// Returns ENOTSUP if nanoarrow was not built with NANOARROW_ENABLE_TRACING.
+NANOARROW_DLL ArrowErrorCode ArrowTraceGetStats(struct ArrowTraceStats* out);
+
+/// \brief Reset all accumulated statistics to zero
+NANOARROW_DLL void ArrowTraceResetStats(void);
+
+/// \brief Set (or clear with NULL) a callback invoked for each recorded event
+///
+/// The callback is invoked synchronously from the thread that recorded the event.
+/// The callback and private_data are read without synchronization, so they must be
+/// set or cleared while no other thread is using nanoarrow (unlike the statistics,
+/// which are updated atomically when C11 atomics are available). Returns ENOTSUP if
+/// nanoarrow was not built with NANOARROW_ENABLE_TRACING.
+NANOARROW_DLL ArrowErrorCode ArrowTraceSetCallback(ArrowTraceCallback callback,
+                                                   void* private_data);
+
+/// @}
+
 /// \defgroup nanoarrow-utils Utility data structures
 ///
 /// @{
@@ -313,12 +417,52 @@ NANOARROW_DLL ArrowErrorCode ArrowDecimalAppendDigitsToBuffer(
 NANOARROW_DLL ArrowErrorCode ArrowDecimalAppendStringToBuffer(
     const struct ArrowDecimal* decimal, struct ArrowBuffer* buffer);
 
+/// \brief Format every element of a decimal array as a string
+///
+/// Appends the decimal representation (e.g., "-123.45") of each element of
+/// array_view, whose storage type must be one of the decimal types, to out,
+/// which must be a string, large string, or string view array that has been
+/// prepared with ArrowArrayStartAppending(). Null elements are appended as nulls.
+/// This is considerably faster than calling ArrowDecimalAppendStringToBuffer()
+/// for each element.
+NANOARROW_DLL ArrowErrorCode ArrowArrayViewDecimalToStrings(
+    const struct ArrowArrayView* array_view, int32_t scale, struct ArrowArray* out,
+    struct ArrowError* error);
+
+/// \brief Parse every element of a string array as a decimal
+///
+/// Appends the value of each element of strings (e.g., "-123.45") to array, which
+/// must be a decimal array that has been prepared with ArrowArrayStartAppending().
+/// precision and scale are those declared by the array's type. Fractional digits
+/// beyond scale must be zero. Returns EINVAL if an element can't be parsed or has
+/// more than precision significant digits. Null elements are appended as nulls.
+NANOARROW_DLL ArrowErrorCode ArrowArrayAppendDecimalFromStrings(
+    struct ArrowArray* array, const struct ArrowArrayView* strings, int32_t precision,
+    int32_t scale, struct ArrowError* error);
+
 /// \brief Get the half float value of a float
+///
+/// Values are rounded to the nearest half float (ties to even) and subnormal
+/// results are preserved.
 static inline uint16_t ArrowFloatToHalfFloat(float value);
 
 /// \brief Get the float value of a half float
 static inline float ArrowHalfFloatToFloat(uint16_t value);
 
+/// \brief Convert n half float values to float
+///
+/// Uses F16C or AVX-512 conversion instructions when nanoarrow was compiled to
+/// target them and produces the same result as ArrowHalfFloatToFloat().
+NANOARROW_DLL void ArrowHalfFloatToFloatN(const uint16_t* values, float* out,
+                                          int64_t n);
+
+/// \brief Convert n float values to half float
+///
+/// Uses F16C or AVX-512 conversion instructions when nanoarrow was compiled to
+/// target them and produces the same result as ArrowFloatToHalfFloat().
+NANOARROW_DLL void ArrowFloatToHalfFloatN(const float* values, uint16_t* out,
+                                          int64_t n);
+
 /// \brief Resolve a chunk index from increasing int64_t offsets
 ///
 /// Given a buffer of increasing int64_t offsets that begin with 0 (e.g., offset buffer
@@ -440,6 +584,42 @@ NANOARROW_DLL ArrowErrorCode ArrowSchemaSetTypeUnion(struct ArrowSchema* schema,
 NANOARROW_DLL ArrowErrorCode ArrowSchemaDeepCopy(const struct ArrowSchema* schema,
                                                  struct ArrowSchema* schema_out);
 
+/// \brief Make a deep copy of a schema in a single allocation
+///
+/// Copies all nodes, child pointer arrays, and format, name, and metadata strings of
+/// schema into one contiguous allocation that is freed when the last node is released.
+/// This avoids many small allocations for very wide or deeply nested schemas and keeps
+/// the copy compact in memory. The result is frozen: ArrowSchemaSetFormat(),
+/// ArrowSchemaSetName(), ArrowSchemaSetMetadata(), ArrowSchemaAllocateChildren(), and
+/// ArrowSchemaAllocateDictionary() return EINVAL for any of its nodes (use
+/// ArrowSchemaDeepCopy() to obtain a copy that can be modified). Children may be moved
+/// out of a compact schema; however, releasing nodes of the same compact schema from
+/// multiple threads concurrently is not supported.
+NANOARROW_DLL ArrowErrorCode ArrowSchemaCompact(const struct ArrowSchema* schema,
+                                                struct ArrowSchema* schema_out);
+
+/// \brief Compute a 64-bit hash of a schema
+///
+/// Walks the schema tree once and combines the type information of each node
+/// and, depending on compare_flags (a combination of NANOARROW_SCHEMA_COMPARE_*
+/// values), its name, metadata, and nullability. Schemas for which
+/// ArrowSchemaEquals() returns true with the same compare_flags have the same
+/// hash, which makes the result suitable as a key for caching objects derived
+/// from a schema. Hash values are not stable across nanoarrow versions.
+NANOARROW_DLL uint64_t ArrowSchemaHash(const struct ArrowSchema* schema,
+                                       int64_t compare_flags);
+
+/// \brief Check two schemas for equality
+///
+/// Returns true if lhs and rhs have identical type information and, depending
+/// on compare_flags (a combination of NANOARROW_SCHEMA_COMPARE_* values),
+/// identical names, metadata, and nullability. A NULL name is equal to an empty
+/// name and NULL metadata is equal to metadata without any keys. Metadata is
+/// compared byte-for-byte (i.e., the order of keys matters).
+NANOARROW_DLL char ArrowSchemaEquals(const struct ArrowSchema* lhs,
+                                     const struct ArrowSchema* rhs,
+                                     int64_t compare_flags);
+
 /// \brief Copy format into schema->format
 ///
 /// schema must have been allocated using ArrowSchemaInitFromType() or
@@ -518,6 +698,61 @@ NANOARROW_DLL ArrowErrorCode ArrowMetadataGetValue(const char* metadata,
                                                    struct ArrowStringView key,
                                                    struct ArrowStringView* value_out);
 
+/// \brief A hash index of the key/value pairs in schema metadata
+///
+/// ArrowMetadataGetValue() scans the metadata string on every call. An
+/// ArrowMetadataIndex reads the metadata once so that each subsequent lookup
+/// takes constant time. Like the ArrowMetadataReader, the index does not
+/// own the metadata and is only valid for the lifetime of the underlying
+/// metadata pointer.
+struct ArrowMetadataIndex {
+  /// \brief The metadata string from which this index was built
+  const char* metadata;
+
+  /// \brief The number of key/value pairs in the metadata
+  int64_t n_keys;
+
+  /// \brief The number of keys that are a repeat of a previous key
+  int64_t n_duplicate_keys;
+
+  /// \brief Keys in the order in which they appear in the metadata
+  struct ArrowStringView* keys;
+
+  /// \brief Values in the order in which they appear in the metadata
+  struct ArrowStringView* values;
+
+  /// \brief The number of slots in the hash table (zero or a power of two)
+  int64_t n_slots;
+
+  /// \brief Hash table slots (positions in keys or -1 for an empty slot)
+  int32_t* slots;
+};
+
+/// \brief Initialize an ArrowMetadataIndex
+///
+/// metadata may be NULL, in which case the index contains no keys. The index
+/// must be released with ArrowMetadataIndexReset() if this call succeeds.
+NANOARROW_DLL ArrowErrorCode ArrowMetadataIndexInit(struct ArrowMetadataIndex* index,
+                                                    const char* metadata);
+
+/// \brief Find the position of a key in an ArrowMetadataIndex
+///
+/// Returns the position in index->keys of the first instance of key or -1
+/// if key is not present.
+NANOARROW_DLL int64_t ArrowMetadataIndexFind(const struct ArrowMetadataIndex* index,
+                                             struct ArrowStringView key);
+
+/// \brief Extract a value from an ArrowMetadataIndex
+///
+/// Equivalent to ArrowMetadataGetValue(): if key does not exist in the
+/// index, value_out is unmodified.
+NANOARROW_DLL ArrowErrorCode ArrowMetadataIndexGetValue(
+    const struct ArrowMetadataIndex* index, struct ArrowStringView key,
+    struct ArrowStringView* value_out);
+
+/// \brief Release resources held by an ArrowMetadataIndex
+NANOARROW_DLL void ArrowMetadataIndexReset(struct ArrowMetadataIndex* index);
+
 /// \brief Initialize a builder for schema metadata from key/value pairs
 ///
 /// metadata can be an existing metadata string or NULL to initialize
@@ -643,6 +878,41 @@ NANOARROW_DLL ArrowErrorCode ArrowSchemaViewInit(struct ArrowSchemaView* schema_
                                                  const struct ArrowSchema* schema,
                                                  struct ArrowError* error);
 
+/// \brief A parsed ArrowSchemaView for every node of an ArrowSchema
+///
+/// Parsing a schema with ArrowSchemaViewInit() for every column of every
+/// batch is expensive for wide schemas. An ArrowSchemaViewTree parses
+/// each node exactly once so that consumers that need the parsed views
+/// repeatedly can reuse them. The tree does not own the schema it was
+/// built from, which must outlive it and must not be modified.
+struct ArrowSchemaViewTree {
+  /// \brief The number of nodes in the tree, including dictionaries
+  int64_t n_nodes;
+
+  /// \brief The parsed view of each node in depth-first order
+  ///
+  /// The root is at index 0. Each node is followed by the subtrees of its
+  /// children in order and then by the subtree of its dictionary, if present.
+  struct ArrowSchemaView* schema_views;
+
+  /// \brief The index one past the last node in each node's subtree
+  ///
+  /// The first child of node i (if any) is node i + 1 and its next sibling
+  /// is node subtree_end[i + 1].
+  int64_t* subtree_end;
+};
+
+/// \brief Initialize an ArrowSchemaViewTree
+///
+/// Parses and validates every node of schema. The tree must be released
+/// with ArrowSchemaViewTreeReset() if this call succeeds.
+NANOARROW_DLL ArrowErrorCode ArrowSchemaViewTreeInit(struct ArrowSchemaViewTree* tree,
+                                                     const struct ArrowSchema* schema,
+                                                     struct ArrowError* error);
+
+/// \brief Release resources held by an ArrowSchemaViewTree
+NANOARROW_DLL void ArrowSchemaViewTreeReset(struct ArrowSchemaViewTree* tree);
+
 /// @}
 
 /// \defgroup nanoarrow-buffer Owning, growable buffers
@@ -962,6 +1232,15 @@ static inline ArrowErrorCode ArrowArrayAppendUInt(struct ArrowArray* array,
 static inline ArrowErrorCode ArrowArrayAppendDouble(struct ArrowArray* array,
                                                     double value);
 
+/// \brief Append n non-null float values to an array
+///
+/// Appends values to an array with a half float, float, or double storage type
+/// (returning EINVAL otherwise). Values are converted to half float using
+/// ArrowFloatToHalfFloatN(), which is considerably faster than appending values
+/// one at a time.
+static inline ArrowErrorCode ArrowArrayAppendFloatN(struct ArrowArray* array,
+                                                    const float* values, int64_t n);
+
 /// \brief Append a string of bytes to an array
 ///
 /// Returns NANOARROW_OK if value can be exactly represented by
@@ -1042,6 +1321,138 @@ NANOARROW_DLL ArrowErrorCode ArrowArrayFinishBuilding(
     struct ArrowArray* array, enum ArrowValidationLevel validation_level,
     struct ArrowError* error);
 
+/// \brief Create a zero-copy slice of an ArrowArray
+///
+/// Populates out with elements [offset, offset + length) of src without copying
+/// buffer content. If src was itself populated by ArrowArraySlice() (see
+/// ArrowArrayIsShared()), out shares ownership of its buffers and src is not
+/// modified. Otherwise, ownership of src is transferred to a reference-counted holder
+/// that out refers to and src is released (i.e., src->release is set to NULL); to take
+/// more than one slice of such an array, take further slices of out (e.g., slice the
+/// full range first). The buffers are released when out and any of its children or
+/// further slices have all been released. Reference counting is thread safe when
+/// nanoarrow is compiled with C11 atomics. Returns EINVAL if the requested range is out
+/// of bounds. If NANOARROW_OK is not returned, src is not modified.
+///
+/// Because out does not own an ArrowArrayPrivateData, it can't be used with the
+/// functions that build arrays (e.g., ArrowArrayStartAppending(), ArrowArrayReserve(),
+/// ArrowArraySetBuffer(), or ArrowArrayFinishBuilding()), which return EINVAL for such
+/// arrays.
+NANOARROW_DLL ArrowErrorCode ArrowArraySlice(struct ArrowArray* src, int64_t offset,
+                                             int64_t length, struct ArrowArray* out);
+
+/// \brief Check if an ArrowArray shares its buffers with a slice
+///
+/// Returns 1 if array was populated by ArrowArraySlice() and 0 otherwise.
+NANOARROW_DLL int8_t ArrowArrayIsShared(const struct ArrowArray* array);
+
+/// \brief Concatenate ArrowArrays of the same type into a single ArrowArray
+///
+/// Copies the content of n_arrays arrays, each of which must be valid for schema,
+/// into a newly allocated array. Each output buffer is allocated once. Offsets,
+/// union offsets, run ends, view buffer indices, and dictionary indices are rebased
+/// such that the result does not depend on the input arrays, which are not modified.
+/// Returns EOVERFLOW if the result can't be represented by the offset or index
+/// type of schema (e.g., if a string array would exceed 2 GB of data).
+NANOARROW_DLL ArrowErrorCode ArrowArrayConcatenate(const struct ArrowSchema* schema,
+                                                   struct ArrowArray** arrays,
+                                                   int64_t n_arrays,
+                                                   struct ArrowArray* out,
+                                                   struct ArrowError* error);
+
+/// \brief Concatenate ArrowArrayViews of the same type into a single ArrowArray
+///
+/// Identical to ArrowArrayConcatenate() except the input is described by
+/// n_array_views array views, each of which must have been initialized from schema.
+/// With a single array view, this creates a compact copy that does not depend on
+/// the buffers the view refers to.
+NANOARROW_DLL ArrowErrorCode ArrowArrayConcatenateViews(
+    const struct ArrowSchema* schema, const struct ArrowArrayView** array_views,
+    int64_t n_array_views, struct ArrowArray* out, struct ArrowError* error);
+
+/// \brief Select elements of an ArrowArrayView by index into a new ArrowArray
+///
+/// Populates out with the n_indices elements of array_view at indices, each of which
+/// must be in the range [0, array_view->length). All layouts are supported. Buffers are
+/// gathered element by element into newly allocated buffers (fixed-width values and
+/// validity bits using tight loops, binary values and list children using a single
+/// pass over the offsets followed by a copy). Out-of-line binary view data is
+/// compacted, run-end encoded arrays remain run-end encoded, and the dictionary of a
+/// dictionary-encoded array is copied as-is.
+NANOARROW_DLL ArrowErrorCode ArrowArrayTake(const struct ArrowArrayView* array_view,
+                                            const int64_t* indices, int64_t n_indices,
+                                            struct ArrowArray* out,
+                                            struct ArrowError* error);
+
+/// \brief Select elements of an ArrowArrayView by bitmap into a new ArrowArray
+///
+/// Populates out with the elements of array_view for which the corresponding bit of
+/// mask is set. mask must contain at least array_view->length bits, the first of
+/// which corresponds to the first element of array_view (i.e., mask is not offset by
+/// array_view->offset). See ArrowArrayTake() for details.
+NANOARROW_DLL ArrowErrorCode ArrowArrayFilter(const struct ArrowArrayView* array_view,
+                                              const uint8_t* mask,
+                                              struct ArrowArray* out,
+                                              struct ArrowError* error);
+
+/// \brief Materialize the values of a dictionary-encoded ArrowArrayView
+///
+/// Populates out with a dense array of the dictionary's type containing the
+/// dictionary value referenced by each index of array_view. An element is null if
+/// its index is null or it references a null dictionary value. Values are gathered
+/// as described in ArrowArrayTake() (i.e., fixed-width values using tight loops and
+/// binary values using a pass to compute offsets followed by a copy). Returns EINVAL
+/// if array_view does not have a dictionary or contains an out-of-range index.
+NANOARROW_DLL ArrowErrorCode ArrowArrayDictionaryDecode(
+    const struct ArrowArrayView* array_view, struct ArrowArray* out,
+    struct ArrowError* error);
+
+/// @}
+
+/// \defgroup nanoarrow-dictionary-builder Dictionary encoding
+///
+/// These functions build dictionary-encoded arrays with int32 indices from string
+/// or binary values. Each distinct value is stored once in the dictionary, whose
+/// value buffer doubles as the storage for the keys of an open-addressing hash
+/// table. The result corresponds to a schema with type int32 whose dictionary
+/// schema has the value type passed to ArrowDictionaryBuilderInit().
+///
+/// @{
+
+/// \brief Initialize an ArrowDictionaryBuilder
+///
+/// value_type must be one of NANOARROW_TYPE_STRING, NANOARROW_TYPE_LARGE_STRING,
+/// NANOARROW_TYPE_BINARY, or NANOARROW_TYPE_LARGE_BINARY. The caller is responsible
+/// for calling ArrowDictionaryBuilderReset() if this function returns NANOARROW_OK.
+NANOARROW_DLL ArrowErrorCode ArrowDictionaryBuilderInit(
+    struct ArrowDictionaryBuilder* builder, enum ArrowType value_type);
+
+/// \brief Append a value, adding it to the dictionary if it has not been seen before
+NANOARROW_DLL ArrowErrorCode ArrowDictionaryBuilderAppendString(
+    struct ArrowDictionaryBuilder* builder, struct ArrowStringView value);
+
+/// \brief Append n null indices
+NANOARROW_DLL ArrowErrorCode ArrowDictionaryBuilderAppendNull(
+    struct ArrowDictionaryBuilder* builder, int64_t n);
+
+/// \brief Append every element of a string, binary, or view ArrowArrayView
+///
+/// Null elements are appended as null indices.
+NANOARROW_DLL ArrowErrorCode ArrowDictionaryBuilderAppendArrayView(
+    struct ArrowDictionaryBuilder* builder, const struct ArrowArrayView* array_view,
+    struct ArrowError* error);
+
+/// \brief Finish building and move the result to out
+///
+/// On success, the builder is empty and may be reused to build another array
+/// with a new dictionary.
+NANOARROW_DLL ArrowErrorCode ArrowDictionaryBuilderFinish(
+    struct ArrowDictionaryBuilder* builder, struct ArrowArray* out,
+    struct ArrowError* error);
+
+/// \brief Release memory held by an ArrowDictionaryBuilder
+NANOARROW_DLL void ArrowDictionaryBuilderReset(struct ArrowDictionaryBuilder* builder);
+
 /// @}
 
 /// \defgroup nanoarrow-array-view Reading arrays
@@ -1066,6 +1477,16 @@ NANOARROW_DLL ArrowErrorCode
 ArrowArrayViewInitFromSchema(struct ArrowArrayView* array_view,
                              const struct ArrowSchema* schema, struct ArrowError* error);
 
+/// \brief Initialize the contents of an ArrowArrayView from an ArrowSchemaViewTree
+///
+/// Equivalent to ArrowArrayViewInitFromSchema() using the schema from which
+/// the tree was built but without parsing it again. Use this when initializing
+/// many ArrowArrayViews with the same schema.
+NANOARROW_DLL ArrowErrorCode
+ArrowArrayViewInitFromSchemaViewTree(struct ArrowArrayView* array_view,
+                                     const struct ArrowSchemaViewTree* tree,
+                                     struct ArrowError* error);
+
 /// \brief Allocate the array_view->children array
 ///
 /// Includes the memory for each child struct ArrowArrayView
@@ -1261,6 +1682,35 @@ NANOARROW_DLL ArrowErrorCode ArrowBasicArrayStreamValidate(
 
 /// @}
 
+/// \defgroup nanoarrow-rechunk-array-stream Rechunking ArrowArrayStream implementation
+///
+/// An ArrowArrayStream that re-slices and coalesces the arrays of another
+/// ArrowArrayStream into batches of a target size.
+///
+/// @{
+
+/// \brief Initialize an ArrowArrayStream that rechunks the output of src
+///
+/// Each array produced by array_stream contains target_rows rows (or fewer for the
+/// final array). If target_bytes is greater than zero, the number of rows is reduced
+/// such that the estimated size of each array (based on the average size of a row of
+/// the input array that begins it) is at most target_bytes. Input arrays that contain
+/// more rows than required are sliced with ArrowArraySlice() (without copying, such
+/// that output arrays may have a nonzero offset) and input arrays that contain fewer
+/// rows are combined using ArrowArrayConcatenate().
+///
+/// If reading from src or copying fails, the rows already collected for the next
+/// array are kept and a subsequent call to get_next() resumes from them.
+///
+/// At least one of target_rows or target_bytes must be greater than zero. If this
+/// function returns NANOARROW_OK, ownership of src is transferred to array_stream
+/// and the caller is responsible for releasing array_stream.
+NANOARROW_DLL ArrowErrorCode ArrowRechunkArrayStreamInit(
+    struct ArrowArrayStream* array_stream, struct ArrowArrayStream* src,
+    int64_t target_rows, int64_t target_bytes, struct ArrowError* error);
+
+/// @}
+
 // Undefine ArrowErrorCode, which may have been defined to annotate functions that return
 // it to warn for an unused result.
 #if defined(ArrowErrorCode)
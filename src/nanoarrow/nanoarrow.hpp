@@ -24,6 +24,7 @@
 
 #include "nanoarrow/hpp/array_stream.hpp"
 #include "nanoarrow/hpp/buffer.hpp"
+#include "nanoarrow/hpp/builder.hpp"
 #include "nanoarrow/hpp/exception.hpp"
 #include "nanoarrow/hpp/operators.hpp"
 #include "nanoarrow/hpp/unique.hpp"
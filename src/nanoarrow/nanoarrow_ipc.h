@@ -53,6 +53,8 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeArray)
 #define ArrowIpcDecoderDecodeArrayFromShared \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeArrayFromShared)
+#define ArrowIpcDecoderDecodeArrayFromOwned \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderDecodeArrayFromOwned)
 #define ArrowIpcDecoderSetSchema \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcDecoderSetSchema)
 #define ArrowIpcDecoderSetEndianness \
@@ -71,6 +73,8 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcInputStreamMove)
 #define ArrowIpcArrayStreamReaderInit \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcArrayStreamReaderInit)
+#define ArrowIpcArrayStreamReaderOptionsInit \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcArrayStreamReaderOptionsInit)
 #define ArrowIpcEncoderInit NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderInit)
 #define ArrowIpcEncoderReset NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcEncoderReset)
 #define ArrowIpcEncoderFinalizeBuffer \
@@ -95,6 +99,9 @@
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterWriteArrayView)
 #define ArrowIpcWriterWriteArrayStream \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterWriteArrayStream)
+#define ArrowIpcWriterSetCoalesceOptions \
+  NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterSetCoalesceOptions)
+#define ArrowIpcWriterFlush NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterFlush)
 #define ArrowIpcWriterStartFile \
   NANOARROW_SYMBOL(NANOARROW_NAMESPACE, ArrowIpcWriterStartFile)
 #define ArrowIpcWriterFinalizeFile \
@@ -154,6 +161,21 @@ enum ArrowIpcCompressionType {
   NANOARROW_IPC_COMPRESSION_TYPE_ZSTD
 };
 
+/// \brief Message header verification enumerator
+///
+/// Flatbuffer verification guarantees that decoding a message header will not
+/// access memory outside the bytes that were read for that header. Skipping it
+/// removes a full pass over each header and is only safe when the source of the
+/// bytes is trusted (e.g., a file written by the same process).
+enum ArrowIpcHeaderVerification {
+  /// \brief Verify every message header (the default)
+  NANOARROW_IPC_HEADER_VERIFICATION_ALL,
+  /// \brief Verify only the Schema message header
+  NANOARROW_IPC_HEADER_VERIFICATION_SCHEMA_ONLY,
+  /// \brief Do not verify any message headers
+  NANOARROW_IPC_HEADER_VERIFICATION_NONE
+};
+
 /// \brief Feature flag for a stream that uses dictionary replacement
 #define NANOARROW_IPC_FEATURE_DICTIONARY_REPLACEMENT 1
 
@@ -448,6 +470,19 @@ NANOARROW_DLL ArrowErrorCode ArrowIpcDecoderDecodeArrayFromShared(
     struct ArrowArray* out, enum ArrowValidationLevel validation_level,
     struct ArrowError* error);
 
+/// \brief Decode an ArrowArray from a body whose ownership is transferred to the decoder
+///
+/// Like ArrowIpcDecoderDecodeArrayFromShared(), buffers of out reference body instead
+/// of copying it. Because nothing else may reference body, buffers that require an
+/// endian swap are swapped in place instead of copied into a new allocation (unless the
+/// message describes buffers that share bytes of the body, in which case they are
+/// copied). body must point to writable memory and is reset regardless of the return
+/// value.
+NANOARROW_DLL ArrowErrorCode ArrowIpcDecoderDecodeArrayFromOwned(
+    struct ArrowIpcDecoder* decoder, struct ArrowBuffer* body, int64_t i,
+    struct ArrowArray* out, enum ArrowValidationLevel validation_level,
+    struct ArrowError* error);
+
 /// \brief An user-extensible input data source
 struct ArrowIpcInputStream {
   /// \brief Read up to buf_size_bytes from stream into buf
@@ -488,6 +523,9 @@ NANOARROW_DLL ArrowErrorCode ArrowIpcInputStreamInitFile(
     struct ArrowIpcInputStream* stream, void* file_ptr, int close_on_release);
 
 /// \brief Options for ArrowIpcArrayStreamReaderInit()
+///
+/// Initialize with ArrowIpcArrayStreamReaderOptionsInit() before setting any fields
+/// such that fields added in future versions take their default values.
 struct ArrowIpcArrayStreamReaderOptions {
   /// \brief The field index to extract.
   ///
@@ -501,17 +539,35 @@ struct ArrowIpcArrayStreamReaderOptions {
   /// (since unreferenced portions of the file are often not loaded into memory) or
   /// (2) if all data from all columns are about to be referenced anyway. When loading
   /// a single field there is probably no advantage to using shared buffers.
-  /// Defaults to the value of ArrowIpcSharedBufferIsThreadSafe().
+  /// When shared buffers are used, message bodies are returned to the reader once
+  /// the last array referencing them is released and are reused for subsequent
+  /// messages of the same size. Defaults to the value of
+  /// ArrowIpcSharedBufferIsThreadSafe().
   int use_shared_buffers;
+
+  /// \brief Which message headers should be verified before they are decoded
+  ///
+  /// Defaults to NANOARROW_IPC_HEADER_VERIFICATION_ALL. Other values should only
+  /// be used for trusted input: an unverified header that is malformed may cause
+  /// the reader to access memory outside the header.
+  enum ArrowIpcHeaderVerification header_verification;
 };
 
+/// \brief Initialize ArrowIpcArrayStreamReaderOptions with default values
+///
+/// The defaults are identical to the behaviour of ArrowIpcArrayStreamReaderInit()
+/// when options is NULL.
+NANOARROW_DLL void ArrowIpcArrayStreamReaderOptionsInit(
+    struct ArrowIpcArrayStreamReaderOptions* options);
+
 /// \brief Initialize an ArrowArrayStream from an input stream of bytes
 ///
 /// The stream of bytes must begin with a Schema message and be followed by
 /// zero or more RecordBatch messages as described in the Arrow IPC stream
 /// format specification. Returns NANOARROW_OK on success. If NANOARROW_OK
 /// is returned, the ArrowArrayStream takes ownership of input_stream and
-/// the caller is responsible for releasing out.
+/// the caller is responsible for releasing out. Returns EINVAL if options
+/// contains an invalid value.
 NANOARROW_DLL ArrowErrorCode ArrowIpcArrayStreamReaderInit(
     struct ArrowArrayStream* out, struct ArrowIpcInputStream* input_stream,
     struct ArrowIpcArrayStreamReaderOptions* options);
@@ -644,10 +700,52 @@ NANOARROW_DLL ArrowErrorCode ArrowIpcWriterWriteArrayView(struct ArrowIpcWriter*
                                                           const struct ArrowArrayView* in,
                                                           struct ArrowError* error);
 
+/// \brief Options for ArrowIpcWriterSetCoalesceOptions()
+///
+/// A value of zero disables the corresponding flush condition.
+struct ArrowIpcWriterCoalesceOptions {
+  /// \brief Flush once at least this many rows are pending
+  int64_t target_rows;
+
+  /// \brief Flush once the pending buffers are at least this many bytes
+  int64_t target_bytes;
+
+  /// \brief Flush once the oldest pending row has waited this many milliseconds
+  ///
+  /// The writer has no background thread: this condition is only checked when
+  /// ArrowIpcWriterWriteArrayView() is called. Callers that need a hard latency
+  /// bound should call ArrowIpcWriterFlush() from their own timer.
+  int64_t max_latency_ms;
+};
+
+/// \brief Coalesce small record batches into larger messages
+///
+/// When options is non-NULL, array views passed to ArrowIpcWriterWriteArrayView()
+/// are copied into a pending batch that is encoded as a single RecordBatch message
+/// once one of the flush conditions in options is met, when
+/// ArrowIpcWriterFlush() is called, when the end of the stream is written, or
+/// when a file is finalized. Pass NULL to disable coalescing. Any rows pending
+/// under previous options are written first. Rows that are still pending when
+/// the writer is released are discarded. ArrowIpcWriterWriteSchema() writes any
+/// pending rows before the new schema. If appending or writing the pending rows
+/// fails, the rows that were already pending are kept. The writer only keeps a
+/// copy of the schema while coalescing is enabled: a stream writer must enable
+/// coalescing before ArrowIpcWriterWriteSchema() (EINVAL is returned otherwise).
+NANOARROW_DLL ArrowErrorCode ArrowIpcWriterSetCoalesceOptions(
+    struct ArrowIpcWriter* writer, const struct ArrowIpcWriterCoalesceOptions* options,
+    struct ArrowError* error);
+
+/// \brief Write any pending coalesced rows as a RecordBatch message
+///
+/// This is a no-op if coalescing is disabled or no rows are pending.
+NANOARROW_DLL ArrowErrorCode ArrowIpcWriterFlush(struct ArrowIpcWriter* writer,
+                                                 struct ArrowError* error);
+
 /// \brief Write an entire stream (including EOS) to the output byte stream
 ///
-/// Errors are propagated from the underlying encoder, array stream, and output byte
-/// stream.
+/// Arrays with a nonzero offset (e.g., slices produced by ArrowRechunkArrayStreamInit())
+/// are copied before they are encoded. Errors are propagated from the underlying
+/// encoder, array stream, and output byte stream.
 NANOARROW_DLL ArrowErrorCode ArrowIpcWriterWriteArrayStream(struct ArrowIpcWriter* writer,
                                                             struct ArrowArrayStream* in,
                                                             struct ArrowError* error);
@@ -144,6 +144,17 @@ class NANOARROW_DLL TestingJSONReader {
                               int num_batch = kNumBatchReadAll,
                               ArrowError* error = nullptr);
 
+  /// \brief Read JSON representing a data file object from an input stream
+  ///
+  /// Like ReadDataFile(), but reads `{"schema": {...}, "batches": [...], ...}`
+  /// incrementally from `in` such that only one batch is parsed at a time when
+  /// get_next() is called on `out`. `in` must remain valid until `out` is released.
+  /// If the schema contains dictionary-encoded fields and "dictionaries" follows
+  /// "batches" in the input, the unparsed text of the batches is buffered until the
+  /// dictionaries have been read.
+  ArrowErrorCode ReadDataFileStream(std::istream& in, ArrowArrayStream* out,
+                                    ArrowError* error = nullptr);
+
   /// \brief Read JSON representing a Schema
   ///
   /// Reads a JSON object in the form `{"fields": [...], "metadata": [...]}`,
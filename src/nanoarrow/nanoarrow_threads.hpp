@@ -0,0 +1,535 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef NANOARROW_THREADS_HPP_INCLUDED
+#define NANOARROW_THREADS_HPP_INCLUDED
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nanoarrow/nanoarrow.hpp"
+
+NANOARROW_CXX_NAMESPACE_BEGIN
+
+/// \defgroup nanoarrow_hpp-threads Multi-threaded ArrayStream helpers
+///
+/// ArrowArrayStream implementations that hand arrays between threads. These live
+/// in their own header (not included by nanoarrow.hpp) so that only users who
+/// need them pull in the standard threading headers, and must link against the
+/// platform's threading library (e.g., Threads::Threads in CMake).
+///
+/// @{
+
+namespace internal {
+
+// State shared between the producer (QueueArrayStream) and consumer (the
+// exported ArrowArrayStream) ends of a queue
+struct ArrayQueueState {
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::deque<UniqueArray> arrays;
+  int64_t capacity;
+  bool closed{false};
+  bool consumer_released{false};
+  ArrowErrorCode code{NANOARROW_OK};
+  std::string message;
+  UniqueSchema schema;
+};
+
+class ArrayQueueReader {
+ public:
+  explicit ArrayQueueReader(std::shared_ptr<ArrayQueueState> state)
+      : state_(std::move(state)) {}
+
+  ~ArrayQueueReader() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->consumer_released = true;
+    state_->arrays.clear();
+    state_->not_full.notify_all();
+  }
+
+ private:
+  std::shared_ptr<ArrayQueueState> state_;
+  std::string last_error_;
+
+  friend class ArrayStreamFactory<ArrayQueueReader>;
+
+  int GetSchema(struct ArrowSchema* schema) {
+    return ArrowSchemaDeepCopy(state_->schema.get(), schema);
+  }
+
+  int GetNext(struct ArrowArray* array) {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->not_empty.wait(lock,
+                           [this] { return !state_->arrays.empty() || state_->closed; });
+
+    if (!state_->arrays.empty()) {
+      state_->arrays.front().move(array);
+      state_->arrays.pop_front();
+      state_->not_full.notify_one();
+      return NANOARROW_OK;
+    }
+
+    if (state_->code != NANOARROW_OK) {
+      last_error_ = state_->message;
+      return state_->code;
+    }
+
+    array->release = nullptr;
+    return NANOARROW_OK;
+  }
+
+  const char* GetLastError() { return last_error_.c_str(); }
+};
+
+}  // namespace internal
+
+/// \brief A bounded, thread-safe queue exported as an ArrowArrayStream
+///
+/// One or more producer threads push() arrays into the queue and signal the end of
+/// the stream with close(), while a consumer reads them in the order they were
+/// pushed via the ArrowArrayStream exported by ToArrayStream(). When the queue
+/// holds capacity arrays, push() blocks until the consumer has drawn one from the
+/// stream, which provides backpressure for a producer that is faster than its
+/// consumer. An error passed to close() is returned from the stream's get_next()
+/// (and its message from get_last_error()) after any queued arrays have been
+/// consumed. If the QueueArrayStream is destroyed before close() is called, the
+/// stream is closed without an error.
+///
+/// An example usage might be:
+///
+/// \code
+/// QueueArrayStream queue(schema, 4);
+/// UniqueArrayStream stream;
+/// queue.ToArrayStream(stream.get());
+///
+/// std::thread producer([&] {
+///   UniqueArray array;
+///   while (/* more input */) {
+///     // ...populate array...
+///     if (queue.push(array.get()) != NANOARROW_OK) break;
+///   }
+///   queue.close();
+/// });
+///
+/// // ...consume stream on this thread...
+/// producer.join();
+/// \endcode
+class QueueArrayStream {
+ public:
+  /// \brief Create a QueueArrayStream from an ArrowSchema
+  ///
+  /// Takes ownership of schema. At most capacity arrays are buffered before
+  /// push() blocks.
+  explicit QueueArrayStream(struct ArrowSchema* schema, int64_t capacity = 8)
+      : state_(new internal::ArrayQueueState()) {
+    state_->capacity = capacity < 1 ? 1 : capacity;
+    state_->schema.reset(schema);
+  }
+
+  QueueArrayStream(QueueArrayStream&&) = default;
+  QueueArrayStream(const QueueArrayStream&) = delete;
+  QueueArrayStream& operator=(const QueueArrayStream&) = delete;
+
+  /// \brief Replace this queue with another one
+  ///
+  /// The queue previously held by this object is closed first such that its
+  /// consumer sees the end of the stream and any blocked producer is woken up.
+  QueueArrayStream& operator=(QueueArrayStream&& rhs) {
+    if (this != &rhs) {
+      if (state_) {
+        close();
+      }
+
+      state_ = std::move(rhs.state_);
+    }
+
+    return *this;
+  }
+
+  ~QueueArrayStream() {
+    if (state_) {
+      close();
+    }
+  }
+
+  /// \brief Export the consumer end of this queue to an ArrowArrayStream
+  ///
+  /// The exported stream may be released independently of this object. Only one
+  /// stream should be exported per queue.
+  void ToArrayStream(struct ArrowArrayStream* out) {
+    ArrayStreamFactory<internal::ArrayQueueReader>::InitArrayStream(
+        new internal::ArrayQueueReader(state_), out);
+  }
+
+  /// \brief Append an array to the queue, blocking while the queue is full
+  ///
+  /// Takes ownership of array on success. Returns EINVAL if the queue was already
+  /// closed or ECANCELED if the consumer stream was released, in which case array
+  /// is left untouched.
+  ArrowErrorCode push(struct ArrowArray* array) {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->not_full.wait(lock, [this] {
+      return static_cast<int64_t>(state_->arrays.size()) < state_->capacity ||
+             state_->consumer_released || state_->closed;
+    });
+
+    if (state_->consumer_released) {
+      return ECANCELED;
+    }
+
+    if (state_->closed) {
+      return EINVAL;
+    }
+
+    state_->arrays.emplace_back(array);
+    state_->not_empty.notify_one();
+    return NANOARROW_OK;
+  }
+
+  /// \brief Signal that no more arrays will be pushed
+  void close() { close(NANOARROW_OK, ""); }
+
+  /// \brief Signal that no more arrays will be pushed because of an error
+  ///
+  /// The consumer will receive code from get_next() after draining any queued
+  /// arrays. Calls after the first have no effect.
+  void close(ArrowErrorCode code, const char* message) {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->closed) {
+      return;
+    }
+
+    state_->closed = true;
+    state_->code = code;
+    state_->message = message;
+    state_->not_empty.notify_all();
+    state_->not_full.notify_all();
+  }
+
+  /// \brief The number of arrays currently buffered in the queue
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return static_cast<int64_t>(state_->arrays.size());
+  }
+
+ private:
+  std::shared_ptr<internal::ArrayQueueState> state_;
+};
+
+/// \brief A function that transforms one array of a ParallelMapArrayStream
+///
+/// Implementations populate out from in (which may be moved from) and return
+/// NANOARROW_OK or an errno-compatible error code, optionally setting error.
+using ArrayMapFunction = std::function<ArrowErrorCode(
+    struct ArrowArray* in, struct ArrowArray* out, struct ArrowError* error)>;
+
+namespace internal {
+
+class ParallelMapReader {
+ public:
+  ParallelMapReader(struct ArrowArrayStream* source, struct ArrowSchema* schema,
+                    ArrayMapFunction fn, int n_threads, int64_t max_in_flight)
+      : source_(source), schema_(schema), fn_(std::move(fn)) {
+    if (n_threads < 1) {
+      n_threads = static_cast<int>(std::thread::hardware_concurrency());
+      n_threads = n_threads < 1 ? 1 : n_threads;
+    }
+
+    max_in_flight_ = max_in_flight < 1 ? 2 * static_cast<int64_t>(n_threads)
+                                       : max_in_flight;
+    for (int i = 0; i < n_threads; i++) {
+      workers_.emplace_back([this] { Work(); });
+    }
+  }
+
+  ~ParallelMapReader() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+
+    slot_available_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  std::exception_ptr GetException() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return exception_;
+  }
+
+ private:
+  // The outcome of pulling and mapping one array from the source. An array
+  // whose release callback is NULL with code == NANOARROW_OK marks the end.
+  struct Result {
+    UniqueArray array;
+    ArrowErrorCode code{NANOARROW_OK};
+    std::string message;
+    std::exception_ptr exception;
+  };
+
+  // Pulls happen under source_mutex_ so that sequence numbers follow source order
+  std::mutex source_mutex_;
+  UniqueArrayStream source_;
+  bool source_finished_{false};
+  int64_t next_sequence_{0};
+
+  // Everything else is protected by mutex_
+  std::mutex mutex_;
+  std::condition_variable slot_available_;
+  std::condition_variable result_available_;
+  std::map<int64_t, Result> results_;
+  int64_t next_emit_{0};
+  int64_t in_flight_{0};
+  int64_t max_in_flight_;
+  bool stop_{false};
+  bool finished_{false};
+  ArrowErrorCode finished_code_{NANOARROW_OK};
+  std::string last_error_;
+  std::exception_ptr exception_;
+
+  UniqueSchema schema_;
+  ArrayMapFunction fn_;
+  std::vector<std::thread> workers_;
+
+  friend class ArrayStreamFactory<ParallelMapReader>;
+
+  void Work() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        slot_available_.wait(lock,
+                             [this] { return stop_ || in_flight_ < max_in_flight_; });
+        if (stop_) {
+          return;
+        }
+
+        ++in_flight_;
+      }
+
+      Result result;
+      struct ArrowError error;
+      ArrowErrorInit(&error);
+      int64_t sequence;
+      UniqueArray in;
+
+      {
+        std::lock_guard<std::mutex> lock(source_mutex_);
+        if (source_finished_) {
+          std::lock_guard<std::mutex> lock2(mutex_);
+          --in_flight_;
+          return;
+        }
+
+        sequence = next_sequence_++;
+        result.code = ArrowArrayStreamGetNext(source_.get(), in.get(), &error);
+        source_finished_ = result.code != NANOARROW_OK || in->release == nullptr;
+      }
+
+      if (result.code == NANOARROW_OK && in->release != nullptr) {
+        // An exception can't escape a worker thread without terminating the process
+        // (nor get_next() without unwinding through C frames), so it is reported as
+        // an error and kept for ParallelMapArrayStream::GetException()
+        try {
+          result.code = fn_(in.get(), result.array.get(), &error);
+        } catch (std::exception& e) {
+          result.exception = std::current_exception();
+          result.code = EINVAL;
+          ArrowErrorSet(&error, "ArrayMapFunction threw an exception: %s", e.what());
+        } catch (...) {
+          result.exception = std::current_exception();
+          result.code = EINVAL;
+          ArrowErrorSet(&error, "ArrayMapFunction threw an exception");
+        }
+
+        if (result.code == NANOARROW_OK && result.array->release == nullptr) {
+          ArrowErrorSet(&error, "ArrayMapFunction did not populate its output");
+          result.code = EINVAL;
+        }
+      }
+
+      if (result.code != NANOARROW_OK) {
+        result.array.reset();
+        result.message = error.message;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        results_[sequence] = std::move(result);
+      }
+
+      result_available_.notify_all();
+    }
+  }
+
+  int GetSchema(struct ArrowSchema* schema) {
+    if (schema_->release != nullptr) {
+      return ArrowSchemaDeepCopy(schema_.get(), schema);
+    }
+
+    std::lock_guard<std::mutex> lock(source_mutex_);
+    struct ArrowError error;
+    ArrowErrorInit(&error);
+    int code = ArrowArrayStreamGetSchema(source_.get(), schema, &error);
+    if (code != NANOARROW_OK) {
+      std::lock_guard<std::mutex> lock2(mutex_);
+      last_error_ = error.message;
+    }
+
+    return code;
+  }
+
+  int GetNext(struct ArrowArray* array) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (finished_) {
+      array->release = nullptr;
+      return finished_code_;
+    }
+
+    result_available_.wait(lock, [this] { return results_.count(next_emit_) != 0; });
+    auto it = results_.find(next_emit_);
+    Result result = std::move(it->second);
+    results_.erase(it);
+    ++next_emit_;
+    --in_flight_;
+
+    if (result.code != NANOARROW_OK || result.array->release == nullptr) {
+      // Either the end of the stream or an error: stop pulling from the source
+      finished_ = true;
+      finished_code_ = result.code;
+      last_error_ = result.message;
+      exception_ = result.exception;
+      stop_ = true;
+      lock.unlock();
+      slot_available_.notify_all();
+      array->release = nullptr;
+      return result.code;
+    }
+
+    lock.unlock();
+    slot_available_.notify_one();
+    result.array.move(array);
+    return NANOARROW_OK;
+  }
+
+  const char* GetLastError() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return last_error_.c_str();
+  }
+};
+
+}  // namespace internal
+
+/// \brief Apply a function to each array of an ArrowArrayStream on a pool of threads
+///
+/// Arrays are pulled from the source stream (one at a time, in order) by up to
+/// n_threads worker threads that each apply fn. Results are emitted by the
+/// exported ArrowArrayStream in the same order as their input regardless of the
+/// order in which workers finish. At most max_in_flight arrays are pulled from
+/// the source but not yet consumed at any time, bounding memory usage when the
+/// consumer is slower than the workers. An error from the source stream or from
+/// fn is returned by get_next() (with its message available from
+/// get_last_error()) after all preceding results have been emitted. If fn throws,
+/// get_next() returns EINVAL at the same point (with the exception's what() in the
+/// message if it is a std::exception); exceptions never propagate through the C
+/// callbacks. C++ consumers can retrieve the exception with GetException().
+///
+/// An example usage might be:
+///
+/// \code
+/// UniqueArrayStream decoded;
+/// ParallelMapArrayStream(
+///     source.get(),
+///     [](ArrowArray* in, ArrowArray* out, ArrowError* error) {
+///       // ...transform in into out...
+///       return NANOARROW_OK;
+///     },
+///     4)
+///     .ToArrayStream(decoded.get());
+/// \endcode
+class ParallelMapArrayStream {
+ public:
+  /// \brief Create a ParallelMapArrayStream from a source ArrowArrayStream
+  ///
+  /// Takes ownership of source. If n_threads is less than 1, the number of
+  /// hardware threads is used; if max_in_flight is less than 1, twice the number
+  /// of threads is used.
+  ParallelMapArrayStream(struct ArrowArrayStream* source, ArrayMapFunction fn,
+                         int n_threads = 0, int64_t max_in_flight = 0)
+      : source_(source),
+        fn_(std::move(fn)),
+        n_threads_(n_threads),
+        max_in_flight_(max_in_flight) {}
+
+  /// \brief Set the schema of arrays returned by fn
+  ///
+  /// Takes ownership of schema. By default, the source's schema is used (i.e., fn is
+  /// assumed to preserve the schema of its input).
+  ParallelMapArrayStream& SetSchema(struct ArrowSchema* schema) {
+    schema_.reset(schema);
+    return *this;
+  }
+
+  /// \brief Export to ArrowArrayStream
+  ///
+  /// Worker threads start pulling from the source immediately and are joined when
+  /// the exported stream is released.
+  void ToArrayStream(struct ArrowArrayStream* out) {
+    auto impl = new internal::ParallelMapReader(source_.get(), schema_.get(),
+                                                std::move(fn_), n_threads_,
+                                                max_in_flight_);
+    ArrayStreamFactory<internal::ParallelMapReader>::InitArrayStream(impl, out);
+  }
+
+  /// \brief Get the exception thrown by fn, if any
+  ///
+  /// Returns the exception that caused get_next() on stream to fail, or nullptr if fn
+  /// has not thrown or stream was not exported by ToArrayStream(). C++ callers may
+  /// pass the result to std::rethrow_exception().
+  static std::exception_ptr GetException(struct ArrowArrayStream* stream) {
+    auto impl = ArrayStreamFactory<internal::ParallelMapReader>::GetInstance(stream);
+    if (impl == nullptr) {
+      return nullptr;
+    }
+
+    return impl->GetException();
+  }
+
+ private:
+  UniqueArrayStream source_;
+  UniqueSchema schema_;
+  ArrayMapFunction fn_;
+  int n_threads_;
+  int64_t max_in_flight_;
+};
+
+/// @}
+
+NANOARROW_CXX_NAMESPACE_END
+
+#endif
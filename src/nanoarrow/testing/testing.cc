@@ -16,8 +16,10 @@
 // under the License.
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <unordered_map>
 #include <vector>
@@ -146,7 +148,48 @@ class LocalizedStream {
   std::streamsize previous_precision_;
 };
 
+// Integers are formatted into a stack buffer and written with std::ostream::write(),
+// which avoids the locale-aware (and comparatively slow) formatting of operator<<()
+// for every value. This is equivalent to std::to_chars() (which requires C++17).
+void WriteUInt(std::ostream& out, uint64_t value) {
+  char buf[24];
+  char* end = buf + sizeof(buf);
+  char* ptr = end;
+  do {
+    *--ptr = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+
+  out.write(ptr, end - ptr);
+}
+
+void WriteInt(std::ostream& out, int64_t value) {
+  if (value < 0) {
+    out.put('-');
+    WriteUInt(out, static_cast<uint64_t>(0) - static_cast<uint64_t>(value));
+  } else {
+    WriteUInt(out, static_cast<uint64_t>(value));
+  }
+}
+
 void WriteString(std::ostream& out, ArrowStringView value) {
+  // Most strings don't need escaping and can be written directly
+  bool needs_escape = false;
+  for (int64_t i = 0; i < value.size_bytes; i++) {
+    unsigned char c = static_cast<unsigned char>(value.data[i]);
+    if (c < 0x20 || c >= 0x80 || c == '"' || c == '\\') {
+      needs_escape = true;
+      break;
+    }
+  }
+
+  if (!needs_escape) {
+    out.put('"');
+    out.write(value.data, value.size_bytes);
+    out.put('"');
+    return;
+  }
+
   std::string value_str(value.data, static_cast<size_t>(value.size_bytes));
   out << nlohmann::json(value_str);
 }
@@ -172,14 +215,14 @@ void WriteBitmap(std::ostream& out, const uint8_t* bits, int64_t length) {
   out << "[";
 
   if (bits == nullptr) {
-    out << "1";
+    out.put('1');
     for (int64_t i = 1; i < length; i++) {
-      out << ", 1";
+      out.write(", 1", 3);
     }
   } else {
-    out << static_cast<int32_t>(ArrowBitGet(bits, 0));
+    out.put(ArrowBitGet(bits, 0) ? '1' : '0');
     for (int64_t i = 1; i < length; i++) {
-      out << ", " << static_cast<int32_t>(ArrowBitGet(bits, i));
+      out.write(ArrowBitGet(bits, i) ? ", 1" : ", 0", 3);
     }
   }
 
@@ -200,15 +243,20 @@ ArrowErrorCode WriteOffsetOrTypeID(std::ostream& out, ArrowBufferView content) {
 
   if (sizeof(T) == sizeof(int64_t)) {
     // Ensure int64s are quoted (i.e, "123456")
-    out << R"(")" << values[0] << R"(")";
+    out << R"(")";
+    WriteInt(out, static_cast<int64_t>(values[0]));
+    out << R"(")";
     for (int64_t i = 1; i < n_values; i++) {
-      out << R"(, ")" << values[i] << R"(")";
+      out << R"(, ")";
+      WriteInt(out, static_cast<int64_t>(values[i]));
+      out << R"(")";
     }
   } else {
     // No need to quote smaller ints (i.e., 123456)
-    out << static_cast<int64_t>(values[0]);
+    WriteInt(out, static_cast<int64_t>(values[0]));
     for (int64_t i = 1; i < n_values; i++) {
-      out << ", " << static_cast<int64_t>(values[i]);
+      out << ", ";
+      WriteInt(out, static_cast<int64_t>(values[i]));
     }
   }
 
@@ -218,9 +266,9 @@ ArrowErrorCode WriteOffsetOrTypeID(std::ostream& out, ArrowBufferView content) {
 
 void WriteIntMaybeNull(std::ostream& out, const ArrowArrayView* view, int64_t i) {
   if (ArrowArrayViewIsNull(view, i)) {
-    out << 0;
+    out.put('0');
   } else {
-    out << ArrowArrayViewGetIntUnsafe(view, i);
+    WriteInt(out, ArrowArrayViewGetIntUnsafe(view, i));
   }
 }
 
@@ -228,7 +276,9 @@ void WriteQuotedIntMaybeNull(std::ostream& out, const ArrowArrayView* view, int6
   if (ArrowArrayViewIsNull(view, i)) {
     out << R"("0")";
   } else {
-    out << R"(")" << ArrowArrayViewGetIntUnsafe(view, i) << R"(")";
+    out.put('"');
+    WriteInt(out, ArrowArrayViewGetIntUnsafe(view, i));
+    out.put('"');
   }
 }
 
@@ -236,7 +286,9 @@ void WriteQuotedUIntMaybeNull(std::ostream& out, const ArrowArrayView* view, int
   if (ArrowArrayViewIsNull(view, i)) {
     out << R"("0")";
   } else {
-    out << R"(")" << ArrowArrayViewGetUIntUnsafe(view, i) << R"(")";
+    out.put('"');
+    WriteUInt(out, ArrowArrayViewGetUIntUnsafe(view, i));
+    out.put('"');
   }
 }
 
@@ -2264,6 +2316,331 @@ ArrowErrorCode RecordDictionaryBatches(const json& value,
   return NANOARROW_OK;
 }
 
+void SetArrayAllocatorRecursive(ArrowArray* array, ArrowBufferAllocator allocator) {
+  for (int i = 0; i < array->n_buffers; i++) {
+    ArrowArrayBuffer(array, i)->allocator = allocator;
+  }
+
+  for (int64_t i = 0; i < array->n_children; i++) {
+    SetArrayAllocatorRecursive(array->children[i], allocator);
+  }
+
+  if (array->dictionary != nullptr) {
+    SetArrayAllocatorRecursive(array->dictionary, allocator);
+  }
+}
+
+// Minimal tokenizer that splits a JSON document read from a std::istream into the
+// text of its values without parsing them. This lets a data file be consumed one
+// top-level member (or one batch) at a time instead of parsing the whole document
+// into memory.
+class JSONScanner {
+ public:
+  explicit JSONScanner(std::istream& in) : in_(in.rdbuf()) {}
+
+  // Returns the next non-whitespace character without consuming it
+  int Peek() {
+    int c = in_->sgetc();
+    while (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+      c = in_->snextc();
+    }
+
+    return c;
+  }
+
+  ArrowErrorCode Expect(char expected, ArrowError* error) {
+    int c = Peek();
+    if (c != expected) {
+      if (c == std::char_traits<char>::eof()) {
+        ArrowErrorSet(error, "Expected '%c' but found end of input", expected);
+      } else {
+        ArrowErrorSet(error, "Expected '%c' but found '%c'", expected,
+                      static_cast<char>(c));
+      }
+      return EINVAL;
+    }
+
+    in_->sbumpc();
+    return NANOARROW_OK;
+  }
+
+  // Reads the text of the next value (object, array, string, or scalar) into out
+  ArrowErrorCode ReadValue(std::string* out, ArrowError* error) {
+    out->clear();
+    int c = Peek();
+
+    switch (c) {
+      case '{':
+      case '[':
+        return ReadNested(out, error);
+      case '"':
+        out->push_back(static_cast<char>(in_->sbumpc()));
+        return ReadStringTail(out, error);
+      default:
+        break;
+    }
+
+    while (c != std::char_traits<char>::eof() && c != ',' && c != '}' && c != ']' &&
+           c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+      out->push_back(static_cast<char>(c));
+      c = in_->snextc();
+    }
+
+    if (out->empty()) {
+      ArrowErrorSet(error, "Expected JSON value but found end of input");
+      return EINVAL;
+    }
+
+    return NANOARROW_OK;
+  }
+
+  // Reads a string value and returns its unescaped content
+  ArrowErrorCode ReadKey(std::string* out, ArrowError* error) {
+    if (Peek() != '"') {
+      return Expect('"', error);
+    }
+
+    NANOARROW_RETURN_NOT_OK(ReadValue(out, error));
+    if (out->find('\\') == std::string::npos) {
+      *out = out->substr(1, out->size() - 2);
+    } else {
+      *out = json::parse(*out).get<std::string>();
+    }
+
+    return NANOARROW_OK;
+  }
+
+ private:
+  std::streambuf* in_;
+
+  ArrowErrorCode UnexpectedEndOfInput(ArrowError* error) {
+    ArrowErrorSet(error, "Unexpected end of input while reading JSON value");
+    return EINVAL;
+  }
+
+  // Reads the remainder of a string whose opening quote has already been read
+  ArrowErrorCode ReadStringTail(std::string* out, ArrowError* error) {
+    int c;
+    while ((c = in_->sbumpc()) != std::char_traits<char>::eof()) {
+      out->push_back(static_cast<char>(c));
+      if (c == '"') {
+        return NANOARROW_OK;
+      } else if (c == '\\') {
+        c = in_->sbumpc();
+        if (c == std::char_traits<char>::eof()) {
+          break;
+        }
+        out->push_back(static_cast<char>(c));
+      }
+    }
+
+    return UnexpectedEndOfInput(error);
+  }
+
+  ArrowErrorCode ReadNested(std::string* out, ArrowError* error) {
+    int64_t depth = 0;
+    int c;
+    while ((c = in_->sbumpc()) != std::char_traits<char>::eof()) {
+      out->push_back(static_cast<char>(c));
+      switch (c) {
+        case '"':
+          NANOARROW_RETURN_NOT_OK(ReadStringTail(out, error));
+          break;
+        case '{':
+        case '[':
+          depth++;
+          break;
+        case '}':
+        case ']':
+          if (--depth == 0) {
+            return NANOARROW_OK;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+
+    return UnexpectedEndOfInput(error);
+  }
+};
+
+// ArrowArrayStream implementation that parses one element of a data file's "batches"
+// at a time. Because "dictionaries" are usually written after "batches", the text of
+// the batches is buffered until the dictionaries are read if the schema contains a
+// dictionary-encoded field and dictionaries have not yet been seen.
+class DataFileStreamReader {
+ public:
+  DataFileStreamReader(std::istream& in, ArrowBufferAllocator allocator)
+      : scanner_(in),
+        allocator_(allocator),
+        state_(kStateMembers),
+        first_member_(true),
+        first_batch_(true),
+        has_batches_(false),
+        has_dictionaries_(false) {
+    ArrowErrorInit(&error_);
+  }
+
+  ArrowErrorCode Init(ArrowError* error) {
+    NANOARROW_RETURN_NOT_OK(scanner_.Expect('{', error));
+    NANOARROW_RETURN_NOT_OK(ReadMembers(error));
+
+    if (state_ == kStateBatches && !dictionaries_.empty() && !has_dictionaries_) {
+      std::string batch_json;
+      bool end_of_batches = false;
+      while (true) {
+        NANOARROW_RETURN_NOT_OK(ReadBatchJSON(&batch_json, &end_of_batches, error));
+        if (end_of_batches) {
+          break;
+        }
+
+        pending_batches_.push_back(std::move(batch_json));
+      }
+
+      NANOARROW_RETURN_NOT_OK(ReadMembers(error));
+    }
+
+    NANOARROW_RETURN_NOT_OK(
+        Check(schema_->release != nullptr, error, "data file missing key 'schema'"));
+    NANOARROW_RETURN_NOT_OK(
+        Check(has_batches_, error, "data file missing key 'batches'"));
+    return NANOARROW_OK;
+  }
+
+ private:
+  enum State { kStateMembers, kStateBatches, kStateDone };
+
+  JSONScanner scanner_;
+  ArrowBufferAllocator allocator_;
+  State state_;
+  bool first_member_;
+  bool first_batch_;
+  bool has_batches_;
+  bool has_dictionaries_;
+  nanoarrow::UniqueSchema schema_;
+  nanoarrow::UniqueArrayView array_view_;
+  internal::DictionaryContext dictionaries_;
+  std::deque<std::string> pending_batches_;
+  std::string value_json_;
+  ArrowError error_;
+
+  friend class ArrayStreamFactory<DataFileStreamReader>;
+
+  int GetSchema(ArrowSchema* out) { return ArrowSchemaDeepCopy(schema_.get(), out); }
+
+  int GetNext(ArrowArray* out) {
+    try {
+      std::string batch_json;
+      if (!pending_batches_.empty()) {
+        batch_json = std::move(pending_batches_.front());
+        pending_batches_.pop_front();
+      } else if (state_ == kStateBatches) {
+        bool end_of_batches = false;
+        NANOARROW_RETURN_NOT_OK(ReadBatchJSON(&batch_json, &end_of_batches, &error_));
+        if (end_of_batches) {
+          // Consume the remainder of the data file so that errors are reported
+          NANOARROW_RETURN_NOT_OK(ReadMembers(&error_));
+        }
+      }
+
+      if (batch_json.empty()) {
+        out->release = nullptr;
+        return NANOARROW_OK;
+      }
+
+      nanoarrow::UniqueArray array;
+      NANOARROW_RETURN_NOT_OK(
+          ArrowArrayInitFromArrayView(array.get(), array_view_.get(), &error_));
+      SetArrayAllocatorRecursive(array.get(), allocator_);
+      NANOARROW_RETURN_NOT_OK(SetArrayBatch(json::parse(batch_json), schema_.get(),
+                                            array_view_.get(), array.get(), dictionaries_,
+                                            &error_));
+      ArrowArrayMove(array.get(), out);
+      return NANOARROW_OK;
+    } catch (json::exception& e) {
+      ArrowErrorSet(&error_,
+                    "Exception in ArrowArrayStream::get_next() of "
+                    "TestingJSONReader::ReadDataFileStream(): %s",
+                    e.what());
+      return EINVAL;
+    }
+  }
+
+  const char* GetLastError() { return error_.message; }
+
+  // Reads members of the data file object until the start of the "batches" array
+  // or the end of the object
+  ArrowErrorCode ReadMembers(ArrowError* error) {
+    std::string key;
+    while (state_ == kStateMembers) {
+      if (scanner_.Peek() == '}') {
+        NANOARROW_RETURN_NOT_OK(scanner_.Expect('}', error));
+        state_ = kStateDone;
+        break;
+      }
+
+      if (!first_member_) {
+        NANOARROW_RETURN_NOT_OK(scanner_.Expect(',', error));
+      }
+      first_member_ = false;
+
+      NANOARROW_RETURN_NOT_OK(scanner_.ReadKey(&key, error));
+      NANOARROW_RETURN_NOT_OK(scanner_.Expect(':', error));
+
+      if (key == "batches") {
+        NANOARROW_RETURN_NOT_OK(
+            Check(!has_batches_, error, "data file has duplicate key 'batches'"));
+        NANOARROW_RETURN_NOT_OK(Check(schema_->release != nullptr, error,
+                                      "data file key 'schema' must precede 'batches'"));
+        NANOARROW_RETURN_NOT_OK(scanner_.Expect('[', error));
+        has_batches_ = true;
+        state_ = kStateBatches;
+        break;
+      }
+
+      NANOARROW_RETURN_NOT_OK(scanner_.ReadValue(&value_json_, error));
+      if (key == "schema") {
+        NANOARROW_RETURN_NOT_OK(Check(schema_->release == nullptr, error,
+                                      "data file has duplicate key 'schema'"));
+        NANOARROW_RETURN_NOT_OK(
+            SetSchema(schema_.get(), json::parse(value_json_), dictionaries_, error));
+        NANOARROW_RETURN_NOT_OK(
+            ArrowArrayViewInitFromSchema(array_view_.get(), schema_.get(), error));
+      } else if (key == "dictionaries") {
+        NANOARROW_RETURN_NOT_OK(
+            Check(schema_->release != nullptr, error,
+                  "data file key 'schema' must precede 'dictionaries'"));
+        NANOARROW_RETURN_NOT_OK(
+            RecordDictionaryBatches(json::parse(value_json_), dictionaries_, error));
+        has_dictionaries_ = true;
+      }
+    }
+
+    return NANOARROW_OK;
+  }
+
+  // Reads the text of the next element of "batches" or sets end_of_batches
+  ArrowErrorCode ReadBatchJSON(std::string* out, bool* end_of_batches,
+                               ArrowError* error) {
+    if (scanner_.Peek() == ']') {
+      NANOARROW_RETURN_NOT_OK(scanner_.Expect(']', error));
+      state_ = kStateMembers;
+      out->clear();
+      *end_of_batches = true;
+      return NANOARROW_OK;
+    }
+
+    if (!first_batch_) {
+      NANOARROW_RETURN_NOT_OK(scanner_.Expect(',', error));
+    }
+    first_batch_ = false;
+
+    *end_of_batches = false;
+    return scanner_.ReadValue(out, error);
+  }
+};
+
 }  // namespace
 
 }  // namespace reader_internal
@@ -2350,6 +2727,23 @@ ArrowErrorCode TestingJSONReader::ReadDataFile(const std::string& data_file_json
   }
 }
 
+ArrowErrorCode TestingJSONReader::ReadDataFileStream(std::istream& in,
+                                                     ArrowArrayStream* out,
+                                                     ArrowError* error) {
+  try {
+    std::unique_ptr<reader_internal::DataFileStreamReader> impl(
+        new reader_internal::DataFileStreamReader(in, allocator_));
+    NANOARROW_RETURN_NOT_OK(impl->Init(error));
+    ArrayStreamFactory<reader_internal::DataFileStreamReader>::InitArrayStream(
+        impl.release(), out);
+    return NANOARROW_OK;
+  } catch (nlohmann::json::exception& e) {
+    ArrowErrorSet(error, "Exception in TestingJSONReader::ReadDataFileStream(): %s",
+                  e.what());
+    return EINVAL;
+  }
+}
+
 ArrowErrorCode TestingJSONReader::ReadSchema(const std::string& schema_json,
                                              ArrowSchema* out, ArrowError* error) {
   try {
@@ -2438,17 +2832,7 @@ ArrowErrorCode TestingJSONReader::ReadColumn(const std::string& column_json,
 }
 
 void TestingJSONReader::SetArrayAllocatorRecursive(ArrowArray* array) {
-  for (int i = 0; i < array->n_buffers; i++) {
-    ArrowArrayBuffer(array, i)->allocator = allocator_;
-  }
-
-  for (int64_t i = 0; i < array->n_children; i++) {
-    SetArrayAllocatorRecursive(array->children[i]);
-  }
-
-  if (array->dictionary != nullptr) {
-    SetArrayAllocatorRecursive(array->dictionary);
-  }
+  reader_internal::SetArrayAllocatorRecursive(array, allocator_);
 }
 
 namespace {
@@ -927,6 +927,116 @@ TEST(NanoarrowTestingTest, NanoarrowTestingTestRoundtripDataFileDictionary) {
   EXPECT_EQ(data_file_json_roundtrip.str(), data_file_json);
 }
 
+TEST(NanoarrowTestingTest, NanoarrowTestingTestReadDataFileStream) {
+  nanoarrow::UniqueArrayStream stream;
+  ArrowError error;
+  error.message[0] = '\0';
+
+  std::string data_file_json =
+      R"({"schema": {"fields": [)"
+      R"({"name": "col1", "nullable": true, "type": {"name": "null"}, "children": []}, )"
+      R"({"name": "col2", "nullable": true, "type": {"name": "utf8"}, "children": []}]})"
+      R"(, "batches": [)"
+      R"({"count": 1, "columns": [)"
+      R"({"name": "col1", "count": 1}, )"
+      R"({"name": "col2", "count": 1, "VALIDITY": [1], "OFFSET": [0, 3], "DATA": ["abc"]}]}, )"
+      R"({"count": 2, "columns": [)"
+      R"({"name": "col1", "count": 2}, )"
+      R"({"name": "col2", "count": 2, "VALIDITY": [1, 1], "OFFSET": [0, 3, 6], "DATA": ["a]c", "d\"}"]}]})"
+      R"(]})";
+
+  TestingJSONReader reader;
+  std::stringstream data_file_in(data_file_json);
+  ASSERT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), NANOARROW_OK)
+      << error.message;
+
+  TestingJSONWriter writer;
+  std::stringstream data_file_json_roundtrip;
+  ASSERT_EQ(writer.WriteDataFile(data_file_json_roundtrip, stream.get()), NANOARROW_OK);
+  EXPECT_EQ(data_file_json_roundtrip.str(), data_file_json);
+
+  // Check whitespace, escaped keys, and unknown keys
+  stream.reset();
+  data_file_json_roundtrip.str("");
+  data_file_in.clear();
+  data_file_in.str(
+      "{\n  \"unknown\": {\"a\": [1, \"]}\"]},\n  \"sch\\u0065ma\" : {\"fields\": []},"
+      "\n  \"batches\": [ {\"count\": 3, \"columns\": []} ,{\"count\": 0, \"columns\": "
+      "[]}\n]\n}\n");
+  ASSERT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(writer.WriteDataFile(data_file_json_roundtrip, stream.get()), NANOARROW_OK);
+  EXPECT_EQ(data_file_json_roundtrip.str(),
+            R"({"schema": {"fields": []}, "batches": [{"count": 3, "columns": []}, )"
+            R"({"count": 0, "columns": []}]})");
+
+  // Check dictionaries that are written after the batches
+  std::string data_file_json_dictionary =
+      R"({"schema": {"fields": [{"name": null, "nullable": true, "type": {"name": "utf8"}, )"
+      R"("dictionary": {"id": 0, "indexType": {"name": "int", "bitWidth": 8, "isSigned": true}, "isOrdered": false}, "children": []}]}, )"
+      R"("batches": [{"count": 1, "columns": [{"name": null, "count": 1, "VALIDITY": [1], "DATA": [1]}]}, )"
+      R"({"count": 1, "columns": [{"name": null, "count": 1, "VALIDITY": [1], "DATA": [0]}]}], )"
+      R"("dictionaries": [{"id": 0, "data": {"count": 2, "columns": [{"name": null, "count": 2, "VALIDITY": [1, 1], "OFFSET": [0, 3, 6], "DATA": ["abc", "def"]}]}}]})";
+
+  stream.reset();
+  data_file_json_roundtrip.str("");
+  data_file_in.clear();
+  data_file_in.str(data_file_json_dictionary);
+  ASSERT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), NANOARROW_OK)
+      << error.message;
+  ASSERT_EQ(writer.WriteDataFile(data_file_json_roundtrip, stream.get()), NANOARROW_OK);
+  EXPECT_EQ(data_file_json_roundtrip.str(), data_file_json_dictionary);
+
+  // Check errors that are detected before the first batch is read
+  stream.reset();
+  data_file_in.clear();
+  data_file_in.str("{");
+  EXPECT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Expected '\"' but found end of input");
+
+  data_file_in.clear();
+  data_file_in.str(R"({"batches": []})");
+  EXPECT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "data file key 'schema' must precede 'batches'");
+
+  data_file_in.clear();
+  data_file_in.str(R"({"schema": {"fields": []}})");
+  EXPECT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "data file missing key 'batches'");
+
+  data_file_in.clear();
+  data_file_in.str(R"({"schema": {"fields": [}, "batches": []})");
+  EXPECT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), EINVAL);
+
+  // Check errors that are detected when a batch is read
+  data_file_in.clear();
+  data_file_in.str(R"({"schema": {"fields": []}, "batches": [{"count": 0, )");
+  ASSERT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), NANOARROW_OK)
+      << error.message;
+  nanoarrow::UniqueArray array;
+  EXPECT_EQ(ArrowArrayStreamGetNext(stream.get(), array.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "Unexpected end of input while reading JSON value");
+
+  stream.reset();
+  data_file_in.clear();
+  data_file_in.str(R"({"schema": {"fields": []}, "batches": [{"count": "0"}]})");
+  ASSERT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(ArrowArrayStreamGetNext(stream.get(), array.get(), &error), EINVAL);
+  EXPECT_STREQ(error.message, "RecordBatch count must be integer");
+
+  stream.reset();
+  data_file_in.clear();
+  data_file_in.str(R"({"schema": {"fields": []}, "batches": [{"count": tru}]})");
+  ASSERT_EQ(reader.ReadDataFileStream(data_file_in, stream.get(), &error), NANOARROW_OK)
+      << error.message;
+  EXPECT_EQ(ArrowArrayStreamGetNext(stream.get(), array.get(), &error), EINVAL);
+  EXPECT_EQ(std::string(error.message)
+                .find("Exception in ArrowArrayStream::get_next() of "
+                      "TestingJSONReader::ReadDataFileStream(): "),
+            0);
+}
+
 TEST(NanoarrowTestingTest, NanoarrowTestingTestReadBatch) {
   nanoarrow::UniqueSchema schema;
   nanoarrow::UniqueArray array;